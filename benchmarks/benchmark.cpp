@@ -0,0 +1,193 @@
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#ifndef BML_VERSION
+#define BML_VERSION "unknown"
+#endif
+
+namespace bml::benchmark {
+
+  struct Benchmark {
+    std::string name;
+    Function func;
+  };
+
+  struct Result {
+    std::string name;
+    std::size_t iterations;
+    double nanosPerIteration;
+    double bytesPerSecond;
+    double itemsPerSecond;
+  };
+
+  static std::vector<Benchmark> &registry() {
+    static std::vector<Benchmark> benchmarks{};
+    return benchmarks;
+  }
+
+  bool registerBenchmark(std::string name, Function func) {
+    registry().push_back(Benchmark{std::move(name), std::move(func)});
+    return true;
+  }
+
+  static Result run(const Benchmark &benchmark, std::chrono::nanoseconds minTime) {
+    std::size_t numIterations = 1;
+    while (true) {
+      State state{numIterations};
+      benchmark.func(state);
+      auto elapsed = state.elapsed();
+      // Stop on reaching the minimum time or when the next run would overflow the iteration count
+      if (elapsed >= minTime || numIterations > (std::size_t{1} << 40U)) {
+        auto seconds = std::chrono::duration<double>(elapsed).count();
+        auto totalIterations = static_cast<double>(numIterations);
+        return Result{benchmark.name, numIterations,
+                      static_cast<double>(elapsed.count()) / totalIterations,
+                      seconds > 0.0 ? static_cast<double>(state.bytesProcessed()) * totalIterations / seconds : 0.0,
+                      seconds > 0.0 ? static_cast<double>(state.itemsProcessed()) * totalIterations / seconds : 0.0};
+      }
+      // Estimate the number of iterations required, but grow by at most 10 times per run
+      auto factor = elapsed.count() > 0
+                        ? static_cast<double>(minTime.count()) * 1.2 / static_cast<double>(elapsed.count())
+                        : 10.0;
+      numIterations = static_cast<std::size_t>(static_cast<double>(numIterations) * std::clamp(factor, 2.0, 10.0));
+    }
+  }
+
+  static std::string escapeJson(std::string_view text) {
+    std::string result{};
+    for (char c : text) {
+      if (c == '"' || c == '\\') {
+        result.push_back('\\');
+      }
+      result.push_back(c);
+    }
+    return result;
+  }
+
+  static void printText(std::ostream &os, const std::vector<Result> &results) {
+    std::size_t nameWidth = 9;
+    for (const auto &result : results) {
+      nameWidth = std::max(nameWidth, result.name.size());
+    }
+    os << std::left << std::setw(static_cast<int>(nameWidth)) << "Benchmark" << std::right << std::setw(14)
+       << "Iterations" << std::setw(16) << "ns/iteration" << std::setw(14) << "MiB/s" << std::setw(16) << "items/s"
+       << '\n';
+    os << std::fixed;
+    for (const auto &result : results) {
+      os << std::left << std::setw(static_cast<int>(nameWidth)) << result.name << std::right << std::setw(14)
+         << result.iterations << std::setw(16) << std::setprecision(1) << result.nanosPerIteration << std::setw(14)
+         << std::setprecision(1) << (result.bytesPerSecond / (1024.0 * 1024.0)) << std::setw(16)
+         << std::setprecision(0) << result.itemsPerSecond << '\n';
+    }
+  }
+
+  static void printCsv(std::ostream &os, const std::vector<Result> &results) {
+    os << "name,iterations,ns_per_iteration,bytes_per_second,items_per_second\n";
+    os << std::fixed << std::setprecision(3);
+    for (const auto &result : results) {
+      os << '"' << result.name << "\"," << result.iterations << ',' << result.nanosPerIteration << ','
+         << result.bytesPerSecond << ',' << result.itemsPerSecond << '\n';
+    }
+  }
+
+  static void printJson(std::ostream &os, const std::vector<Result> &results) {
+    os << "{\n  \"version\": \"" << BML_VERSION << "\",\n  \"benchmarks\": [";
+    os << std::fixed << std::setprecision(3);
+    bool first = true;
+    for (const auto &result : results) {
+      os << (first ? "\n" : ",\n");
+      os << "    {\"name\": \"" << escapeJson(result.name) << "\", \"iterations\": " << result.iterations
+         << ", \"ns_per_iteration\": " << result.nanosPerIteration
+         << ", \"bytes_per_second\": " << result.bytesPerSecond
+         << ", \"items_per_second\": " << result.itemsPerSecond << "}";
+      first = false;
+    }
+    os << "\n  ]\n}\n";
+  }
+
+  static void printHelp(std::ostream &os, const char *program) {
+    os << "Usage: " << program << " [options]\n"
+       << "  --filter=<text>         Only run the benchmarks whose name contains the given text\n"
+       << "  --format=text|json|csv  The output format of the results (defaults to text)\n"
+       << "  --min-time=<ms>         The minimum time to run each benchmark in milliseconds (defaults to 500)\n"
+       << "  --list                  Only list the names of the available benchmarks\n"
+       << "  --help                  Print this help\n";
+  }
+} // namespace bml::benchmark
+
+int main(int argc, char **argv) {
+  using namespace bml::benchmark;
+
+  std::string_view filter{};
+  std::string_view format = "text";
+  std::chrono::nanoseconds minTime = std::chrono::milliseconds{500};
+  bool listOnly = false;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string_view arg{argv[i]};
+    if (arg.starts_with("--filter=")) {
+      filter = arg.substr(9);
+    } else if (arg.starts_with("--format=")) {
+      format = arg.substr(9);
+    } else if (arg.starts_with("--min-time=")) {
+      minTime = std::chrono::milliseconds{std::strtoll(arg.substr(11).data(), nullptr, 10)};
+    } else if (arg == "--list") {
+      listOnly = true;
+    } else if (arg == "--help") {
+      printHelp(std::cout, argv[0]);
+      return EXIT_SUCCESS;
+    } else {
+      std::cerr << "Unknown argument: " << arg << '\n';
+      printHelp(std::cerr, argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (format != "text" && format != "json" && format != "csv") {
+    std::cerr << "Unknown output format: " << format << '\n';
+    return EXIT_FAILURE;
+  }
+
+  std::vector<Result> results{};
+  for (const auto &benchmark : registry()) {
+    if (!filter.empty() && benchmark.name.find(filter) == std::string::npos) {
+      continue;
+    }
+    if (listOnly) {
+      std::cout << benchmark.name << '\n';
+      continue;
+    }
+    try {
+      results.push_back(run(benchmark, minTime));
+    } catch (const std::exception &err) {
+      std::cerr << "Benchmark '" << benchmark.name << "' failed: " << err.what() << '\n';
+      return EXIT_FAILURE;
+    }
+    if (format == "text") {
+      // Show progress for long-running suites, the tabular output is written at the end
+      std::cerr << "Finished " << benchmark.name << '\n';
+    }
+  }
+
+  if (listOnly) {
+    return EXIT_SUCCESS;
+  }
+
+  if (format == "json") {
+    printJson(std::cout, results);
+  } else if (format == "csv") {
+    printCsv(std::cout, results);
+  } else {
+    printText(std::cout, results);
+  }
+  return EXIT_SUCCESS;
+}
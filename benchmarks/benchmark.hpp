@@ -0,0 +1,127 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/**
+ * Minimal self-contained benchmark harness.
+ *
+ * Benchmarks are registered statically via BML_BENCHMARK or registerBenchmark() and run by the benchmark executable,
+ * which reports the results as text table, CSV or JSON (see the --help output of the executable).
+ */
+namespace bml::benchmark {
+
+  /**
+   * State of a single benchmark run, providing the number of iterations to run.
+   *
+   * The benchmark function is expected to execute the measured code once for every iteration of the range-based for
+   * loop over this object. Only the time spent within this loop is measured, so any preparation can be done before
+   * the loop.
+   */
+  class State {
+  public:
+    using clock = std::chrono::steady_clock;
+
+    class Iterator {
+    public:
+      constexpr bool operator!=(const Iterator & /* end */) {
+        if (remaining) [[likely]] {
+          return true;
+        }
+        state->stop = clock::now();
+        return false;
+      }
+
+      constexpr Iterator &operator++() noexcept {
+        --remaining;
+        return *this;
+      }
+
+      constexpr std::size_t operator*() const noexcept { return remaining; }
+
+    private:
+      constexpr Iterator(State *parent, std::size_t numIterations) noexcept
+          : state(parent), remaining(numIterations) {}
+
+      State *state;
+      std::size_t remaining;
+
+      friend class State;
+    };
+
+    explicit State(std::size_t numIterations) noexcept : numIterations(numIterations) {}
+
+    Iterator begin() noexcept {
+      start = clock::now();
+      return Iterator{this, numIterations};
+    }
+
+    Iterator end() noexcept { return Iterator{this, 0}; }
+
+    /**
+     * Returns the number of iterations to run.
+     */
+    std::size_t iterations() const noexcept { return numIterations; }
+
+    /**
+     * Sets the number of bytes processed per iteration, to report the throughput in bytes per second.
+     */
+    void setBytesPerIteration(std::size_t numBytes) noexcept { bytesPerIteration = numBytes; }
+
+    /**
+     * Sets the number of items (e.g. values, Frames, Blocks) processed per iteration, to report the throughput in
+     * items per second.
+     */
+    void setItemsPerIteration(std::size_t numItems) noexcept { itemsPerIteration = numItems; }
+
+    /**
+     * Returns the time spent in the measured loop.
+     */
+    std::chrono::nanoseconds elapsed() const noexcept {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start);
+    }
+
+    std::size_t bytesProcessed() const noexcept { return bytesPerIteration; }
+    std::size_t itemsProcessed() const noexcept { return itemsPerIteration; }
+
+  private:
+    std::size_t numIterations;
+    std::size_t bytesPerIteration = 0;
+    std::size_t itemsPerIteration = 0;
+    clock::time_point start{};
+    clock::time_point stop{};
+  };
+
+  using Function = std::function<void(State &)>;
+
+  /**
+   * Registers the given benchmark function to be run under the given name.
+   *
+   * Always returns true, to allow registering benchmarks in the initialization of static variables.
+   */
+  bool registerBenchmark(std::string name, Function func);
+
+  /**
+   * Prevents the compiler from optimizing away the computation of the given value.
+   */
+  template <typename T>
+  inline void doNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+  }
+} // namespace bml::benchmark
+
+/**
+ * Defines and registers a benchmark function with the given name.
+ */
+#define BML_BENCHMARK(Name)                                                                                            \
+  static void Name(bml::benchmark::State &state);                                                                      \
+  [[maybe_unused]] static const bool Name##Registered = bml::benchmark::registerBenchmark(#Name, &Name);               \
+  static void Name(bml::benchmark::State &state)
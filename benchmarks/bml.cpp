@@ -0,0 +1,495 @@
+#include "benchmark.hpp"
+
+#include "binary_map.hpp"
+#include "bit_view.hpp"
+#include "bml.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+using namespace bml;
+using bml::benchmark::doNotOptimize;
+using bml::benchmark::State;
+
+static constexpr std::size_t DATA_SIZE = 1024U * 1024U;
+
+static const std::vector<std::byte> &inputData() {
+  static const std::vector<std::byte> data = []() {
+    std::vector<std::byte> bytes(DATA_SIZE);
+    // Simple LCG to get non-trivial but reproducible content
+    uint32_t state = 0x12345678U;
+    for (auto &byte : bytes) {
+      state = state * 1664525U + 1013904223U;
+      byte = static_cast<std::byte>(state >> 24U);
+    }
+    return bytes;
+  }();
+  return data;
+}
+
+static void readAll(BitReader &reader, BitCount numBits) {
+  auto numValues = (DATA_SIZE * 8U) / numBits.value();
+  std::uintmax_t sum = 0;
+  for (std::size_t i = 0; i < numValues; ++i) {
+    sum += reader.read(numBits);
+  }
+  doNotOptimize(sum);
+}
+
+template <std::size_t NumBits>
+static void readSpan(State &state) {
+  const auto &data = inputData();
+  for ([[maybe_unused]] auto _ : state) {
+    BitReader reader{std::span{data}};
+    readAll(reader, BitCount{NumBits});
+  }
+  state.setBytesPerIteration(DATA_SIZE);
+}
+
+BML_BENCHMARK(ReadSpan1Bit) { readSpan<1>(state); }
+BML_BENCHMARK(ReadSpan7Bits) { readSpan<7>(state); }
+BML_BENCHMARK(ReadSpan13Bits) { readSpan<13>(state); }
+BML_BENCHMARK(ReadSpan32Bits) { readSpan<32>(state); }
+BML_BENCHMARK(ReadSpan64Bits) { readSpan<64>(state); }
+
+static std::string inputString() {
+  const auto &data = inputData();
+  return std::string(reinterpret_cast<const char *>(data.data()), data.size());
+}
+
+BML_BENCHMARK(ReadStream13Bits) {
+  auto content = inputString();
+  for ([[maybe_unused]] auto _ : state) {
+    std::istringstream input{content};
+    BitReader reader{input};
+    readAll(reader, 13_bits);
+  }
+  state.setBytesPerIteration(DATA_SIZE);
+}
+
+BML_BENCHMARK(ReadBufferedStream13Bits) {
+  auto content = inputString();
+  for ([[maybe_unused]] auto _ : state) {
+    std::istringstream input{content};
+    BitReader reader{input, BitReader::DEFAULT_READ_AHEAD};
+    readAll(reader, 13_bits);
+  }
+  state.setBytesPerIteration(DATA_SIZE);
+}
+
+BML_BENCHMARK(ReadPrefetchingStream13Bits) {
+  auto content = inputString();
+  for ([[maybe_unused]] auto _ : state) {
+    std::istringstream input{content};
+    BitReader reader{input, BitReader::DEFAULT_READ_AHEAD, 4};
+    readAll(reader, 13_bits);
+  }
+  state.setBytesPerIteration(DATA_SIZE);
+}
+
+BML_BENCHMARK(ReadByteGenerator13Bits) {
+  const auto &data = inputData();
+  for ([[maybe_unused]] auto _ : state) {
+    std::size_t index = 0;
+    BitReader reader{[&data, &index](std::byte &out) {
+      if (index >= data.size()) {
+        return false;
+      }
+      out = data[index++];
+      return true;
+    }};
+    readAll(reader, 13_bits);
+  }
+  state.setBytesPerIteration(DATA_SIZE);
+}
+
+static BitReader::ChunkGenerator chunkGenerator(const std::vector<std::byte> &data, std::size_t &index) {
+  return [&data, &index](std::span<std::byte> out) {
+    auto numBytes = std::min(out.size(), data.size() - index);
+    std::memcpy(out.data(), data.data() + index, numBytes);
+    index += numBytes;
+    return numBytes;
+  };
+}
+
+BML_BENCHMARK(ReadChunkGenerator13Bits) {
+  const auto &data = inputData();
+  for ([[maybe_unused]] auto _ : state) {
+    std::size_t index = 0;
+    BitReader reader{chunkGenerator(data, index)};
+    readAll(reader, 13_bits);
+  }
+  state.setBytesPerIteration(DATA_SIZE);
+}
+
+BML_BENCHMARK(ReadPrefetchingChunkGenerator13Bits) {
+  const auto &data = inputData();
+  for ([[maybe_unused]] auto _ : state) {
+    std::size_t index = 0;
+    BitReader reader{chunkGenerator(data, index), BitReader::DEFAULT_READ_AHEAD, 4};
+    readAll(reader, 13_bits);
+  }
+  state.setBytesPerIteration(DATA_SIZE);
+}
+
+BML_BENCHMARK(ReadBytesInto) {
+  const auto &data = inputData();
+  std::vector<std::byte> output(4096);
+  for ([[maybe_unused]] auto _ : state) {
+    BitReader reader{std::span{data}};
+    for (std::size_t i = 0; i < DATA_SIZE / output.size(); ++i) {
+      reader.readBytesInto(output);
+    }
+    doNotOptimize(output);
+  }
+  state.setBytesPerIteration(DATA_SIZE);
+}
+
+static void writeAll(BitWriter &writer, BitCount numBits) {
+  auto numValues = (DATA_SIZE * 8U) / numBits.value();
+  auto mask = numBits.value() == 64 ? ~std::uintmax_t{0} : ((std::uintmax_t{1} << numBits.value()) - 1U);
+  for (std::size_t i = 0; i < numValues; ++i) {
+    writer.write(i & mask, numBits);
+  }
+  writer.flush();
+}
+
+template <std::size_t NumBits>
+static void writeSpan(State &state) {
+  std::vector<std::byte> output(DATA_SIZE);
+  for ([[maybe_unused]] auto _ : state) {
+    BitWriter writer{std::span{output}};
+    writeAll(writer, BitCount{NumBits});
+    doNotOptimize(output);
+  }
+  state.setBytesPerIteration(DATA_SIZE);
+}
+
+BML_BENCHMARK(WriteSpan1Bit) { writeSpan<1>(state); }
+BML_BENCHMARK(WriteSpan7Bits) { writeSpan<7>(state); }
+BML_BENCHMARK(WriteSpan13Bits) { writeSpan<13>(state); }
+BML_BENCHMARK(WriteSpan32Bits) { writeSpan<32>(state); }
+BML_BENCHMARK(WriteSpan64Bits) { writeSpan<64>(state); }
+
+BML_BENCHMARK(WriteGrowingVector13Bits) {
+  for ([[maybe_unused]] auto _ : state) {
+    std::vector<std::byte> output{};
+    BitWriter writer{output, BitWriter::GROW};
+    writeAll(writer, 13_bits);
+    doNotOptimize(output);
+  }
+  state.setBytesPerIteration(DATA_SIZE);
+}
+
+BML_BENCHMARK(WriteStream13Bits) {
+  for ([[maybe_unused]] auto _ : state) {
+    std::ostringstream output{};
+    BitWriter writer{output};
+    writeAll(writer, 13_bits);
+    doNotOptimize(output);
+  }
+  state.setBytesPerIteration(DATA_SIZE);
+}
+
+BML_BENCHMARK(WriteDiscard13Bits) {
+  for ([[maybe_unused]] auto _ : state) {
+    BitWriter writer{BitWriter::DISCARD};
+    writeAll(writer, 13_bits);
+  }
+  state.setBytesPerIteration(DATA_SIZE);
+}
+
+static constexpr std::size_t NUM_CODED_VALUES = 64U * 1024U;
+
+static std::vector<uint32_t> codedValues() {
+  std::vector<uint32_t> values(NUM_CODED_VALUES);
+  uint32_t state = 0xCAFEBABEU;
+  for (auto &value : values) {
+    state = state * 1664525U + 1013904223U;
+    // Mostly small values with some larger ones, as typically exp-Golomb or Fibonacci coded
+    value = (state >> 20U) % ((state & 0x0F) == 0 ? 100000U : 64U) + 1U;
+  }
+  return values;
+}
+
+template <typename WriteFunc>
+static std::vector<std::byte> encodeAll(const std::vector<uint32_t> &values, WriteFunc &&func) {
+  std::vector<std::byte> data{};
+  BitWriter writer{data, BitWriter::GROW};
+  for (auto value : values) {
+    func(writer, value);
+  }
+  writer.fillToAligment(1_bytes, false);
+  writer.flush();
+  return data;
+}
+
+BML_BENCHMARK(ReadExpGolomb) {
+  auto data = encodeAll(codedValues(), [](BitWriter &writer, uint32_t value) { writer.writeExpGolomb(value); });
+  for ([[maybe_unused]] auto _ : state) {
+    BitReader reader{std::span{data}};
+    std::uintmax_t sum = 0;
+    for (std::size_t i = 0; i < NUM_CODED_VALUES; ++i) {
+      sum += reader.readExpGolomb();
+    }
+    doNotOptimize(sum);
+  }
+  state.setBytesPerIteration(data.size());
+  state.setItemsPerIteration(NUM_CODED_VALUES);
+}
+
+BML_BENCHMARK(ReadExpGolombBatch) {
+  auto data = encodeAll(codedValues(), [](BitWriter &writer, uint32_t value) { writer.writeExpGolomb(value); });
+  std::vector<std::uintmax_t> output(NUM_CODED_VALUES);
+  for ([[maybe_unused]] auto _ : state) {
+    BitReader reader{std::span{data}};
+    reader.readExpGolombInto(output);
+    doNotOptimize(output);
+  }
+  state.setBytesPerIteration(data.size());
+  state.setItemsPerIteration(NUM_CODED_VALUES);
+}
+
+BML_BENCHMARK(WriteExpGolomb) {
+  auto values = codedValues();
+  for ([[maybe_unused]] auto _ : state) {
+    BitWriter writer{BitWriter::DISCARD};
+    for (auto value : values) {
+      writer.writeExpGolomb(value);
+    }
+    writer.flush();
+  }
+  state.setItemsPerIteration(NUM_CODED_VALUES);
+}
+
+BML_BENCHMARK(ReadFibonacci) {
+  auto data = encodeAll(codedValues(), [](BitWriter &writer, uint32_t value) { writer.writeFibonacci(value); });
+  for ([[maybe_unused]] auto _ : state) {
+    BitReader reader{std::span{data}};
+    std::uintmax_t sum = 0;
+    for (std::size_t i = 0; i < NUM_CODED_VALUES; ++i) {
+      sum += reader.readFibonacci();
+    }
+    doNotOptimize(sum);
+  }
+  state.setBytesPerIteration(data.size());
+  state.setItemsPerIteration(NUM_CODED_VALUES);
+}
+
+BML_BENCHMARK(ReadFibonacciBatch) {
+  auto data = encodeAll(codedValues(), [](BitWriter &writer, uint32_t value) { writer.writeFibonacci(value); });
+  std::vector<uint32_t> output(NUM_CODED_VALUES);
+  for ([[maybe_unused]] auto _ : state) {
+    BitReader reader{std::span{data}};
+    reader.readFibonacciInto(output);
+    doNotOptimize(output);
+  }
+  state.setBytesPerIteration(data.size());
+  state.setItemsPerIteration(NUM_CODED_VALUES);
+}
+
+BML_BENCHMARK(WriteFibonacci) {
+  auto values = codedValues();
+  for ([[maybe_unused]] auto _ : state) {
+    BitWriter writer{BitWriter::DISCARD};
+    for (auto value : values) {
+      writer.writeFibonacci(value);
+    }
+    writer.flush();
+  }
+  state.setItemsPerIteration(NUM_CODED_VALUES);
+}
+
+BML_BENCHMARK(ReadUtf8CodePoints) {
+  auto data = encodeAll(codedValues(), [](BitWriter &writer, uint32_t value) {
+    // Mix of 1 to 3 byte code points, skipping the surrogates range
+    writer.writeUtf8CodePoint(static_cast<char32_t>(value % 0xD000U));
+  });
+  for ([[maybe_unused]] auto _ : state) {
+    BitReader reader{std::span{data}};
+    char32_t sum = 0;
+    for (std::size_t i = 0; i < NUM_CODED_VALUES; ++i) {
+      sum += reader.readUtf8CodePoint();
+    }
+    doNotOptimize(sum);
+  }
+  state.setBytesPerIteration(data.size());
+  state.setItemsPerIteration(NUM_CODED_VALUES);
+}
+
+enum class PacketType : uint8_t { DATA = 1, CONTROL = 2 };
+
+struct PacketHeader {
+  uint8_t magic;
+  uint8_t version;
+  bool flag;
+  PacketType type;
+  uint16_t length;
+  uint8_t reserved;
+  uint32_t sequence;
+};
+
+static constexpr auto MAP_HEADER = mapCompound<PacketHeader>(
+    mapMember(&PacketHeader::magic, mapCheckedFixedBits<uint8_t{0xA}, 4_bits>()),
+    mapMemberBits<3_bits>(&PacketHeader::version), mapMemberBits<1_bits>(&PacketHeader::flag),
+    mapMember(&PacketHeader::type, mapBytes<PacketType>()), mapMemberBits<12_bits>(&PacketHeader::length),
+    mapMember(&PacketHeader::reserved, mapUncheckedFixedBits<uint8_t{0}, 4_bits>()),
+    mapMemberBits(&PacketHeader::sequence));
+
+using HeaderView = BitView<mapCheckedFixedBits<uint8_t{0xA}, 4_bits>(), mapBits<uint8_t, 3_bits>(),
+                           mapBits<bool, 1_bits>(), mapBytes<PacketType>(), mapBits<uint16_t, 12_bits>(),
+                           mapUncheckedFixedBits<uint8_t{0}, 4_bits>(), mapBits<uint32_t>()>;
+
+static constexpr std::size_t HEADER_SIZE = 8;
+static constexpr std::size_t NUM_HEADERS = DATA_SIZE / HEADER_SIZE;
+
+static std::vector<std::byte> headerData() {
+  std::vector<std::byte> data{};
+  BitWriter writer{data, BitWriter::GROW};
+  for (std::size_t i = 0; i < NUM_HEADERS; ++i) {
+    PacketHeader header{0xA,
+                        static_cast<uint8_t>(i % 8U),
+                        (i % 3U) == 0,
+                        (i % 2U) ? PacketType::DATA : PacketType::CONTROL,
+                        static_cast<uint16_t>(i % 4096U),
+                        0,
+                        static_cast<uint32_t>(i)};
+    MAP_HEADER(writer, header);
+  }
+  writer.flush();
+  return data;
+}
+
+BML_BENCHMARK(MapCompoundRead) {
+  auto data = headerData();
+  for ([[maybe_unused]] auto _ : state) {
+    BitReader reader{std::span{data}};
+    uint32_t sum = 0;
+    for (std::size_t i = 0; i < NUM_HEADERS; ++i) {
+      sum += MAP_HEADER(reader).length;
+    }
+    doNotOptimize(sum);
+  }
+  state.setBytesPerIteration(data.size());
+  state.setItemsPerIteration(NUM_HEADERS);
+}
+
+BML_BENCHMARK(MapCompoundReadUnaligned) {
+  // Prepend a single bit to disable the packed fast path
+  std::vector<std::byte> data{};
+  {
+    auto aligned = headerData();
+    BitWriter writer{data, BitWriter::GROW};
+    writer.write(true);
+    for (auto byte : aligned) {
+      writer.write(static_cast<std::uintmax_t>(byte), 8_bits);
+    }
+    writer.fillToAligment(1_bytes, false);
+    writer.flush();
+  }
+  static constexpr auto MAP_UNPACKED = mapCompound<PacketHeader>(
+      mapMemberBits<4_bits>(&PacketHeader::magic), mapMemberBits<3_bits>(&PacketHeader::version),
+      mapMemberBits<1_bits>(&PacketHeader::flag), mapMember(&PacketHeader::type, mapBits<PacketType>()),
+      mapMemberBits<12_bits>(&PacketHeader::length), mapMemberBits<4_bits>(&PacketHeader::reserved),
+      mapMemberBits(&PacketHeader::sequence));
+  for ([[maybe_unused]] auto _ : state) {
+    BitReader reader{std::span{data}};
+    std::ignore = reader.read();
+    uint32_t sum = 0;
+    for (std::size_t i = 0; i < NUM_HEADERS; ++i) {
+      sum += MAP_UNPACKED(reader).length;
+    }
+    doNotOptimize(sum);
+  }
+  state.setBytesPerIteration(data.size());
+  state.setItemsPerIteration(NUM_HEADERS);
+}
+
+BML_BENCHMARK(MapCompoundWrite) {
+  PacketHeader header{0xA, 5, true, PacketType::DATA, 0x123, 0, 0x12345678};
+  for ([[maybe_unused]] auto _ : state) {
+    BitWriter writer{BitWriter::DISCARD};
+    for (std::size_t i = 0; i < NUM_HEADERS; ++i) {
+      MAP_HEADER(writer, header);
+    }
+    writer.flush();
+  }
+  state.setBytesPerIteration(NUM_HEADERS * HEADER_SIZE);
+  state.setItemsPerIteration(NUM_HEADERS);
+}
+
+BML_BENCHMARK(MapCompoundWriteMessages) {
+  PacketHeader header{0xA, 5, true, PacketType::DATA, 0x123, 0, 0x12345678};
+  for ([[maybe_unused]] auto _ : state) {
+    for (std::size_t i = 0; i < NUM_HEADERS; ++i) {
+      std::vector<std::byte> buffer{};
+      BitWriter writer{buffer, BitWriter::GROW};
+      MAP_HEADER(writer, header);
+      writer.flush();
+      doNotOptimize(buffer);
+    }
+  }
+  state.setBytesPerIteration(NUM_HEADERS * HEADER_SIZE);
+  state.setItemsPerIteration(NUM_HEADERS);
+}
+
+BML_BENCHMARK(MapCompoundWriteMessagesPooled) {
+  PacketHeader header{0xA, 5, true, PacketType::DATA, 0x123, 0, 0x12345678};
+  auto &pool = WriteBufferPool::threadLocal();
+  for ([[maybe_unused]] auto _ : state) {
+    for (std::size_t i = 0; i < NUM_HEADERS; ++i) {
+      auto buffer = pool.acquire(ByteCount{HEADER_SIZE});
+      BitWriter writer{*buffer, BitWriter::GROW};
+      MAP_HEADER(writer, header);
+      writer.flush();
+      doNotOptimize(*buffer);
+    }
+  }
+  state.setBytesPerIteration(NUM_HEADERS * HEADER_SIZE);
+  state.setItemsPerIteration(NUM_HEADERS);
+}
+
+BML_BENCHMARK(BitViewGet) {
+  auto data = headerData();
+  for ([[maybe_unused]] auto _ : state) {
+    uint32_t sum = 0;
+    for (std::size_t i = 0; i < NUM_HEADERS; ++i) {
+      HeaderView view{std::span<const std::byte>{data}.subspan(i * HEADER_SIZE)};
+      sum += view.get<4>();
+    }
+    doNotOptimize(sum);
+  }
+  state.setBytesPerIteration(data.size());
+  state.setItemsPerIteration(NUM_HEADERS);
+}
+
+BML_BENCHMARK(ReadBulkIntegral) {
+  const auto &data = inputData();
+  std::vector<uint32_t> output(DATA_SIZE / sizeof(uint32_t));
+  for ([[maybe_unused]] auto _ : state) {
+    BitReader reader{std::span{data}};
+    reader.readBigEndianInto(std::span<uint32_t>{output});
+    doNotOptimize(output);
+  }
+  state.setBytesPerIteration(DATA_SIZE);
+  state.setItemsPerIteration(output.size());
+}
+
+BML_BENCHMARK(WriteBulkIntegral) {
+  std::vector<uint32_t> values(DATA_SIZE / sizeof(uint32_t));
+  std::vector<std::byte> output(DATA_SIZE);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<uint32_t>(i * 2654435761U);
+  }
+  for ([[maybe_unused]] auto _ : state) {
+    BitWriter writer{std::span{output}};
+    writer.writeBigEndian(std::span<const uint32_t>{values});
+    writer.flush();
+    doNotOptimize(output);
+  }
+  state.setBytesPerIteration(DATA_SIZE);
+  state.setItemsPerIteration(values.size());
+}
@@ -0,0 +1,196 @@
+#include "benchmark.hpp"
+
+#include "ebml.hpp"
+#include "mkv.hpp"
+#include "mkv_frames.hpp"
+
+#include <array>
+#include <vector>
+
+using namespace bml;
+using namespace bml::ebml;
+using namespace bml::ebml::mkv;
+using bml::benchmark::doNotOptimize;
+using bml::benchmark::State;
+
+static constexpr std::size_t NUM_CLUSTERS = 64;
+static constexpr std::size_t NUM_BLOCKS_PER_CLUSTER = 128;
+static constexpr std::size_t NUM_LACED_FRAMES = 8;
+
+struct Input {
+  std::vector<std::byte> data;
+  Matroska mkv;
+  std::size_t numBlocks;
+  std::size_t numFrames;
+};
+
+static std::vector<std::byte> frameData(std::size_t size, std::size_t seed) {
+  std::vector<std::byte> data(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<std::byte>((i + seed) * 31U);
+  }
+  return data;
+}
+
+/**
+ * Generates a Matroska with a video Track of many small Blocks and an audio Track of laced Blocks, using all lacing
+ * modes.
+ *
+ * If withCRC32 is set, the Segment, Tracks, TrackEntry and Cluster Elements contain a CRC-32 Element.
+ */
+static Input generateInput(bool withCRC32) {
+  Input result{};
+  Matroska &mkv = result.mkv;
+  mkv.header.docType = "matroska";
+  {
+    Tracks tracks{};
+    auto &video = tracks.trackEntries.emplace_back();
+    video.trackNumber = 1U;
+    video.trackType = TrackEntry::Type::VIDEO;
+    video.codecID = "V_UNCOMPRESSED";
+    auto &audio = tracks.trackEntries.emplace_back();
+    audio.trackNumber = 2U;
+    audio.trackType = TrackEntry::Type::AUDIO;
+    audio.codecID = "A_PCM/INT/LIT";
+    if (withCRC32) {
+      // The actual CRC-32 values are calculated on writing
+      tracks.crc32.emplace();
+      for (auto &entry : tracks.trackEntries) {
+        entry.crc32.emplace();
+      }
+    }
+    mkv.segment.tracks = std::move(tracks);
+  }
+
+  std::size_t seed = 0;
+  for (std::size_t i = 0; i < NUM_CLUSTERS; ++i) {
+    Cluster cluster{};
+    cluster.timestamp = SegmentTimestamp<>{1000 * i};
+    if (withCRC32) {
+      cluster.crc32.emplace();
+    }
+    for (std::size_t j = 0; j < NUM_BLOCKS_PER_CLUSTER; ++j) {
+      SimpleBlock block{};
+      block.header.timestampOffset = static_cast<int16_t>(j * 5U);
+      block.header.keyframe = j == 0;
+      if (j % 4U == 3U) {
+        static constexpr std::array LACINGS{BlockHeader::Lacing::XIPH, BlockHeader::Lacing::EBML,
+                                            BlockHeader::Lacing::FIXED_SIZE};
+        auto lacing = LACINGS[(j / 4U) % LACINGS.size()];
+        block.header.trackNumber = 2U;
+        block.header.lacing = lacing;
+        for (std::size_t k = 0; k < NUM_LACED_FRAMES; ++k) {
+          auto size = lacing == BlockHeader::Lacing::FIXED_SIZE ? 200U : 150U + k * 20U;
+          block.frameDataRanges.emplace_back(frameData(size, ++seed));
+        }
+        result.numFrames += NUM_LACED_FRAMES;
+      } else {
+        block.header.trackNumber = 1U;
+        block.frameDataRanges.emplace_back(frameData(512U + (j % 7U) * 100U, ++seed));
+        ++result.numFrames;
+      }
+      cluster.simpleBlocks.push_back(std::move(block));
+      ++result.numBlocks;
+    }
+    mkv.segment.clusters.push_back(std::move(cluster));
+  }
+  if (withCRC32) {
+    mkv.segment.crc32.emplace();
+  }
+
+  BitWriter writer{result.data, BitWriter::GROW};
+  mkv.write(writer);
+  writer.flush();
+  return result;
+}
+
+static const Input &inputData() {
+  static const Input input = generateInput(false);
+  return input;
+}
+
+static const Input &crc32InputData() {
+  static const Input input = generateInput(true);
+  return input;
+}
+
+static void readMatroska(State &state, const ReadOptions &options, const Input &input = inputData()) {
+  for ([[maybe_unused]] auto _ : state) {
+    BitReader reader{std::span{input.data}};
+    Matroska mkv{};
+    mkv.read(reader, options);
+    doNotOptimize(mkv);
+  }
+  state.setBytesPerIteration(input.data.size());
+  state.setItemsPerIteration(input.numBlocks);
+}
+
+BML_BENCHMARK(MkvRead) { readMatroska(state, ReadOptions{}); }
+BML_BENCHMARK(MkvReadMediaData) { readMatroska(state, ReadOptions{.readMediaData = true}); }
+BML_BENCHMARK(MkvReadValidateCRC32) { readMatroska(state, ReadOptions{.validateCRC32 = true}, crc32InputData()); }
+BML_BENCHMARK(MkvReadBorrowedMediaData) {
+  readMatroska(state, ReadOptions{.mediaDataSource = std::span<const std::byte>{inputData().data}});
+}
+
+BML_BENCHMARK(MkvFillFrameData) {
+  const auto &input = inputData();
+  Matroska mkv{};
+  {
+    BitReader reader{std::span{input.data}};
+    mkv.read(reader, ReadOptions{});
+  }
+  for ([[maybe_unused]] auto _ : state) {
+    std::size_t numBytes = 0;
+    for (uint32_t track : {1U, 2U}) {
+      for (const auto &frame : mkv.viewFrames(track) | fillFrameData(std::span<const std::byte>{input.data})) {
+        numBytes += frame.data.size();
+      }
+    }
+    doNotOptimize(numBytes);
+  }
+  state.setBytesPerIteration(input.data.size());
+  state.setItemsPerIteration(input.numFrames);
+}
+
+BML_BENCHMARK(MkvViewFramesSingleTrack) {
+  const auto &input = inputData();
+  std::size_t numFrames = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    numFrames = 0;
+    for (const auto &frame : input.mkv.viewFrames(2U)) {
+      doNotOptimize(frame);
+      ++numFrames;
+    }
+  }
+  state.setItemsPerIteration(numFrames);
+}
+
+BML_BENCHMARK(MkvFrameIndexSingleTrack) {
+  const auto &input = inputData();
+  const auto index = input.mkv.indexFrames(2U);
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto &frame : index.frames()) {
+      doNotOptimize(frame);
+    }
+  }
+  state.setItemsPerIteration(index.size());
+}
+
+BML_BENCHMARK(MkvWrite) {
+  const auto &input = inputData();
+  for ([[maybe_unused]] auto _ : state) {
+    BitWriter writer{BitWriter::DISCARD};
+    input.mkv.write(writer);
+    writer.flush();
+  }
+  state.setBytesPerIteration(input.data.size());
+  state.setItemsPerIteration(input.numBlocks);
+}
+
+BML_BENCHMARK(CRC32Calculate) {
+  const auto &input = inputData();
+  for ([[maybe_unused]] auto _ : state) {
+    doNotOptimize(CRC32::calculate(input.data));
+  }
+  state.setBytesPerIteration(input.data.size());
+}
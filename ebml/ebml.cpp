@@ -1,5 +1,6 @@
 #include "ebml.hpp"
 
+#include "buffer_pool.hpp"
 #include "debug.hpp"
 #include "errors.hpp"
 #include "internal.hpp"
@@ -9,6 +10,8 @@
 #include <map>
 #include <span>
 #include <sstream>
+#include <stdexcept>
+#include <vector>
 
 namespace bml::ebml {
   namespace detail {
@@ -27,8 +30,27 @@ namespace bml::ebml {
       return ByteCount{sizeof(value)} - ByteCount{numLeadingOnes / 1_bytes};
     }
 
-    static ElementId peekElementId(BitReader &reader) {
+    /**
+     * Returns whether peeking more bytes than consumed is allowed for the given reader.
+     *
+     * Readers wrapping a base reader (e.g. for CRC-32 calculation) must not read ahead of the consumed data, since the
+     * base reader is used for peeking the next Elements. Similarly, live (non-seekable) sources are not read beyond the
+     * current Element, e.g. to allow for chunked reading without blocking on input of the next Element.
+     */
+    static bool canPeekAhead(BitReader &reader) noexcept {
+      return &bml::detail::BaseReaderAccess::baseReader(reader) == &reader && reader.isSeekable();
+    }
+
+    ElementId peekElementId(BitReader &reader) {
       static_assert(sizeof(uintmax_t) <= 8, "The current implementation only works for up to 8 bytes read");
+      std::optional<std::uintmax_t> word{};
+      if (canPeekAhead(reader) && (word = reader.peek(4_bytes))) [[likely]] {
+        // Fast path for the common case of IDs of up to 4 bytes with enough input available
+        auto numBytes = static_cast<uint32_t>(std::countl_zero(static_cast<uint32_t>(*word)) + 1 /* 1 bit */);
+        if (numBytes <= 4U) [[likely]] {
+          return static_cast<ElementId>(*word >> (32U - numBytes * 8U));
+        }
+      }
       auto val = reader.peek(1_bytes);
       if (!val) {
         throw EndOfStreamError("Cannot read more bytes, end of input reached");
@@ -89,9 +111,9 @@ namespace bml::ebml {
       if (value == defaultValue) {
         return;
       }
-      writeElement(writer, id, [value{value}](BitWriter &bufWriter) {
-        bufWriter.write(std::bit_cast<uintmax_t>(value), detail::requiredBytes(value));
-      });
+      const auto numBytes = detail::requiredBytes(value);
+      detail::writeElementHeader(writer, id, numBytes);
+      writer.write(std::bit_cast<uintmax_t>(value), numBytes);
     }
 
     template <>
@@ -106,8 +128,9 @@ namespace bml::ebml {
       if (value == defaultValue) {
         return;
       }
-      writeElement(writer, id,
-                   [value{value}](BitWriter &bufWriter) { bufWriter.write(value, detail::requiredBytes(value)); });
+      const auto numBytes = detail::requiredBytes(value);
+      detail::writeElementHeader(writer, id, numBytes);
+      writer.write(value, numBytes);
     }
 
     template <>
@@ -131,9 +154,10 @@ namespace bml::ebml {
       if (value == defaultValue) {
         return;
       }
-      writeElement(writer, id, [value{std::bit_cast<uint64_t>(value)}](BitWriter &bufWriter) {
-        bufWriter.write(value, detail::requiredBytes(value));
-      });
+      const auto bits = std::bit_cast<uint64_t>(value);
+      const auto numBytes = detail::requiredBytes(bits);
+      detail::writeElementHeader(writer, id, numBytes);
+      writer.write(bits, numBytes);
     }
 
     template <>
@@ -157,9 +181,10 @@ namespace bml::ebml {
       if (value == defaultValue) {
         return;
       }
-      writeElement(writer, id, [value{std::bit_cast<uint32_t>(value)}](BitWriter &bufWriter) {
-        bufWriter.write(value, detail::requiredBytes(value));
-      });
+      const auto bits = std::bit_cast<uint32_t>(value);
+      const auto numBytes = detail::requiredBytes(bits);
+      detail::writeElementHeader(writer, id, numBytes);
+      writer.write(bits, numBytes);
     }
 
     template <>
@@ -205,6 +230,72 @@ namespace bml::ebml {
       writer.writeBytes(std::as_bytes(std::span{value}));
     }
 
+    template <>
+    void BaseSimpleElement<std::string_view>::writeValue(BitWriter &writer, ElementId id,
+                                                         const std::string_view &defaultValue) const {
+      if (value == defaultValue) {
+        return;
+      }
+      detail::writeElementHeader(writer, id, ByteCount{value.size()});
+      writer.writeBytes(std::as_bytes(std::span{value}));
+    }
+
+    template <>
+    void BaseSimpleElement<std::u8string_view>::writeValue(BitWriter &writer, ElementId id,
+                                                           const std::u8string_view &defaultValue) const {
+      if (value == defaultValue) {
+        return;
+      }
+      detail::writeElementHeader(writer, id, ByteCount{value.size()});
+      writer.writeBytes(std::as_bytes(std::span{value}));
+    }
+
+    template <>
+    void BaseSimpleElement<BorrowableString<char>>::readValue(BitReader &reader, ElementId id,
+                                                            const BorrowableString<char> &defaultValue) {
+      auto numChars = detail::readElementHeader(reader, id);
+      if (!numChars) {
+        value = defaultValue;
+        return;
+      }
+      std::string tmp(numChars.value(), '\0');
+      reader.readBytesInto(std::as_writable_bytes(std::span{tmp}));
+      value = std::move(tmp);
+    }
+
+    template <>
+    void BaseSimpleElement<BorrowableString<char>>::writeValue(BitWriter &writer, ElementId id,
+                                                             const BorrowableString<char> &defaultValue) const {
+      if (value == defaultValue) {
+        return;
+      }
+      detail::writeElementHeader(writer, id, ByteCount{value.size()});
+      writer.writeBytes(std::as_bytes(std::span{value.view()}));
+    }
+
+    template <>
+    void BaseSimpleElement<BorrowableString<char8_t>>::readValue(BitReader &reader, ElementId id,
+                                                               const BorrowableString<char8_t> &defaultValue) {
+      auto numChars = detail::readElementHeader(reader, id);
+      if (!numChars) {
+        value = defaultValue;
+        return;
+      }
+      std::u8string tmp(numChars.value(), '\0');
+      reader.readBytesInto(std::as_writable_bytes(std::span{tmp}));
+      value = std::move(tmp);
+    }
+
+    template <>
+    void BaseSimpleElement<BorrowableString<char8_t>>::writeValue(BitWriter &writer, ElementId id,
+                                                                const BorrowableString<char8_t> &defaultValue) const {
+      if (value == defaultValue) {
+        return;
+      }
+      detail::writeElementHeader(writer, id, ByteCount{value.size()});
+      writer.writeBytes(std::as_bytes(std::span{value.view()}));
+    }
+
     template <>
     void BaseSimpleElement<Date>::readValue(BitReader &reader, ElementId id, const Date &defaultValue) {
       BaseSimpleElement<intmax_t> tmp{};
@@ -241,6 +332,55 @@ namespace bml::ebml {
       writer.writeBytes(std::span{value});
     }
 
+    DataRange readBinaryData(BitReader &reader, ElementId id, const ReadOptions &options) {
+      auto numBytes = detail::readElementHeader(reader, id);
+      if (!numBytes) {
+        return DataRange{};
+      }
+      // Same as for media data, the position is relative to the start of the underlying byte source
+      const ByteRange range{bml::detail::BaseReaderAccess::baseReader(reader).position().divide<8>(), numBytes};
+      if (options.mediaDataSource.empty() && options.readMediaData) {
+        std::vector<std::byte> data(numBytes.value());
+        reader.readBytesInto(data);
+        return DataRange{std::move(data)};
+      }
+      reader.skip(numBytes);
+      DataRange data{range};
+      if (!options.mediaDataSource.empty()) {
+        fillDataRange(data, options.mediaDataSource, DataRange::Mode::BORROWED);
+      }
+      return data;
+    }
+
+    std::span<const std::byte> readBorrowedValue(BitReader &reader, ElementId id, const ReadOptions &options) {
+      auto numBytes = detail::readElementHeader(reader, id);
+      if (!numBytes) {
+        return {};
+      }
+      // Same as for media data, the position is relative to the start of the underlying byte source
+      const auto offset = bml::detail::BaseReaderAccess::baseReader(reader).position().divide<8>();
+      if (options.mediaDataSource.size() < offset.value() + numBytes.value()) {
+        throw NoReferencedDataError{"Cannot borrow Element value not contained in the media data source"};
+      }
+      reader.skip(numBytes);
+      return options.mediaDataSource.subspan(offset.value(), numBytes.value());
+    }
+
+    void checkUtf8(ElementId id, std::u8string_view value) {
+      if (!isValidUtf8(std::as_bytes(std::span{value}))) {
+        throw InvalidEncodingError("Value of UTF-8 string Element '" + toHexString(static_cast<uintmax_t>(id)) +
+                                   "' is not valid UTF-8");
+      }
+    }
+
+    void writeBinaryData(BitWriter &writer, ElementId id, const DataRange &data) {
+      if (!data.empty() && !data.hasData()) {
+        throw NoReferencedDataError{"Cannot write binary Element without referenced data"};
+      }
+      detail::writeElementHeader(writer, id, data.numBytes());
+      writer.writeBytes(data.data());
+    }
+
     /**
      * Variable-size integer consists of 3 parts:
      *
@@ -264,17 +404,80 @@ namespace bml::ebml {
       return std::make_pair(val & numBits.mask(), numBits);
     }
 
+    /**
+     * The decoded Variable-size integers of an Element header.
+     */
+    struct RawElementHeader {
+      /** The Element ID, including the length prefix */
+      uintmax_t id;
+      /** The Element data size, without the length prefix */
+      uintmax_t size;
+      /** The number of bytes of the encoded Element ID */
+      ByteCount idBytes;
+      /** The number of bytes of the encoded Element data size */
+      ByteCount sizeBytes;
+      /** Whether the Element data size is the reserved "unknown size" value */
+      bool unknownSize;
+
+      ByteCount headerSize() const noexcept { return idBytes + sizeBytes; }
+    };
+
+    /**
+     * Decodes both Variable-size integers of the Element header from a single peeked 64-bit word and skips the
+     * header on success.
+     *
+     * Returns an empty optional value without consuming any input if the reader cannot peek ahead, less than 8 bytes
+     * can be peeked or the header does not fit into 8 bytes (e.g. for 8-byte Element sizes).
+     */
+    static std::optional<RawElementHeader> readRawElementHeaderFast(BitReader &reader) {
+      static_assert(sizeof(uintmax_t) == 8, "The fast path requires a 64-bit word");
+      if (!canPeekAhead(reader)) {
+        return {};
+      }
+      auto word = reader.peek(8_bytes);
+      if (!word) [[unlikely]] {
+        return {};
+      }
+      // A zero first byte (invalid or more than 8 bytes) also yields more than 7 bytes
+      auto idBytes = static_cast<uint32_t>(std::countl_zero(*word) + 1 /* 1 bit */);
+      if (idBytes > 7U) [[unlikely]] {
+        return {};
+      }
+      auto remainder = *word << (idBytes * 8U);
+      auto sizeBytes = static_cast<uint32_t>(std::countl_zero(remainder) + 1 /* 1 bit */);
+      if (idBytes + sizeBytes > 8U) [[unlikely]] {
+        return {};
+      }
+      const BitCount sizeBits = ByteCount{sizeBytes} - BitCount{sizeBytes};
+      auto size = (remainder >> (64U - sizeBytes * 8U)) & sizeBits.mask();
+      reader.skip(ByteCount{idBytes + sizeBytes});
+      return RawElementHeader{*word >> (64U - idBytes * 8U), size, ByteCount{idBytes}, ByteCount{sizeBytes},
+                              size == sizeBits.mask()};
+    }
+
+    /**
+     * Reads the Element ID and the Element data size of the next Element header.
+     */
+    static RawElementHeader readRawElementHeader(BitReader &reader) {
+      if (auto header = readRawElementHeaderFast(reader)) [[likely]] {
+        return *header;
+      }
+      auto id = readVariableSizeInteger(reader, true /* with prefix */);
+      auto size = readVariableSizeInteger(reader, false /* without prefix */);
+      return RawElementHeader{id.first, size.first, id.second.divide<8>(), ByteCount{size.second.num / 7U},
+                              size.first == size.second.mask()};
+    }
+
     ByteCount readElementHeader(BitReader &reader, ElementId id) {
-      auto elementId = readVariableSizeInteger(reader, true /* with prefix */).first;
-      if (elementId != static_cast<uintmax_t>(id)) {
-        throw std::invalid_argument("Element ID '" + toHexString(elementId) +
+      auto header = readRawElementHeader(reader);
+      if (header.id != static_cast<uintmax_t>(id)) {
+        throw std::invalid_argument("Element ID '" + toHexString(header.id) +
                                     "' does not match ID of read element: " + toHexString(static_cast<uintmax_t>(id)));
       }
-      auto elementSize = readVariableSizeInteger(reader, false /* without prefix */);
-      if (elementSize.first == elementSize.second.mask()) {
+      if (header.unknownSize) {
         return UNKNOWN_SIZE;
       }
-      return ByteCount{elementSize.first};
+      return ByteCount{header.size};
     }
 
     static constexpr ByteCount getIdBytes(ElementId id) noexcept {
@@ -288,34 +491,85 @@ namespace bml::ebml {
     }
 
     ByteCount skipElement(BitReader &reader, const std::set<ElementId> &terminatingElementIds) {
-      auto id = readVariableSizeInteger(reader, true /* don't care */);
-      auto size = readVariableSizeInteger(reader, false /* without prefix */);
-      if (size.first == size.second.mask()) {
-        ByteCount numBytesSkipped = id.second.divide<8>() + ByteCount{size.second.num / 7U};
+      auto header = readRawElementHeader(reader);
+      if (header.unknownSize) {
+        ByteCount numBytesSkipped = header.headerSize();
         while (reader.hasMoreBytes() && !terminatingElementIds.contains(peekElementId(reader))) {
           numBytesSkipped += skipElement(reader, terminatingElementIds);
         }
         return numBytesSkipped;
       }
-      reader.skip(ByteCount{size.first});
-      return id.second.divide<8>() + ByteCount{size.second.num / 7U} + ByteCount{size.first};
+      reader.skip(ByteCount{header.size});
+      return header.headerSize() + ByteCount{header.size};
     }
 
     ByteCount copyElement(BitReader &reader, BitWriter &writer, const std::set<ElementId> &terminatingElementIds) {
-      auto id = readVariableSizeInteger(reader, true /* don't care */);
-      auto size = readVariableSizeInteger(reader, false /* without prefix */);
-      if (size.first == size.second.mask()) {
-        writer.write(id.first, id.second);
-        writer.write(UNKNOWN_SIZE.num, ByteCount{size.second.num / 7U});
-        ByteCount numBytesCopied = id.second.divide<8>() + ByteCount{size.second.num / 7U};
+      auto header = readRawElementHeader(reader);
+      if (header.unknownSize) {
+        writer.write(header.id, header.idBytes);
+        writer.write(UNKNOWN_SIZE.num, header.sizeBytes);
+        ByteCount numBytesCopied = header.headerSize();
         while (reader.hasMoreBytes() && !terminatingElementIds.contains(peekElementId(reader))) {
           numBytesCopied += copyElement(reader, writer, terminatingElementIds);
         }
         return numBytesCopied;
       }
-      writeElementHeader(writer, ElementId{id.first}, ByteCount{size.first});
-      bml::copyBits(reader, writer, ByteCount{size.first});
-      return id.second.divide<8>() + ByteCount{size.second.num / 7U} + ByteCount{size.first};
+      writeElementHeader(writer, ElementId{header.id}, ByteCount{header.size});
+      bml::copyBits(reader, writer, ByteCount{header.size});
+      return header.headerSize() + ByteCount{header.size};
+    }
+
+    // Adapted from https://rosettacode.org/wiki/CRC-32#C++, extended with the tables for slicing-by-8, see
+    // https://create.stephan-brumme.com/crc32/#slicing-by-8-overview
+    static constexpr auto CRC_TABLES = [] {
+      std::array<std::array<std::uint32_t, 256>, 8> tables;
+      for (uint32_t i = 0; i < tables[0].size(); ++i) {
+        uint32_t c = i;
+        for (uint8_t k = 0; k < 8; ++k) {
+          if (c & 1) {
+            // IEEE-CRC-32 algorithm, specified in ISO 3309 or ITU-T V.42
+            // This is the "reversed" (little-endian) form as of
+            // https://en.wikipedia.org/wiki/Cyclic_redundancy_check
+            c = 0xEDB88320U ^ (c >> 1);
+          } else {
+            c >>= 1;
+          }
+        }
+        tables[0][i] = c;
+      }
+      for (uint32_t i = 0; i < tables[0].size(); ++i) {
+        for (std::size_t t = 1; t < tables.size(); ++t) {
+          tables[t][i] = (tables[t - 1][i] >> 8) ^ tables[0][tables[t - 1][i] & 0xFF];
+        }
+      }
+      return tables;
+    }();
+
+    // See https://github.com/Matroska-Org/libebml/blob/master/src/EbmlCrc32.cpp
+    static_assert(CRC_TABLES[0][7] == 0x9e6495a3L);
+
+    /**
+     * Updates the given (not yet finalized) CRC-32 calculation state with the given data.
+     *
+     * Processes 8 bytes at a time via slicing-by-8 and only the remaining bytes one by one.
+     */
+    static uint32_t updateCRC32(uint32_t crc, std::span<const std::byte> data) noexcept {
+      const auto load = [&data](std::size_t offset) {
+        return static_cast<uint32_t>(data[offset]) | (static_cast<uint32_t>(data[offset + 1]) << 8U) |
+               (static_cast<uint32_t>(data[offset + 2]) << 16U) | (static_cast<uint32_t>(data[offset + 3]) << 24U);
+      };
+      while (data.size() >= 8) {
+        auto low = load(0) ^ crc;
+        auto high = load(4);
+        crc = CRC_TABLES[7][low & 0xFF] ^ CRC_TABLES[6][(low >> 8) & 0xFF] ^ CRC_TABLES[5][(low >> 16) & 0xFF] ^
+              CRC_TABLES[4][low >> 24] ^ CRC_TABLES[3][high & 0xFF] ^ CRC_TABLES[2][(high >> 8) & 0xFF] ^
+              CRC_TABLES[1][(high >> 16) & 0xFF] ^ CRC_TABLES[0][high >> 24];
+        data = data.subspan<8>();
+      }
+      for (auto b : data) {
+        crc = CRC_TABLES[0][(crc ^ static_cast<uint32_t>(b)) & 0xFF] ^ (crc >> 8);
+      }
+      return crc;
     }
 
     /**
@@ -323,48 +577,65 @@ namespace bml::ebml {
      */
     class CRCScope {
     public:
-      explicit CRCScope(BitReader &reader, bool calculateCRC) {
-        // Top-level CRC reader scope, initialize base underlying reader
-        auto *underlyingReader = &reader;
-        if (auto it = readerMap.find(&reader); it != readerMap.end()) {
-          underlyingReader = it->second;
+      CRCScope(BitReader &reader, bool calculateCRC, ReadStatistics *statistics) {
+        // The base underlying reader of any parent CRC reader scope or the given reader for top-level scopes
+        auto *underlyingReader = &bml::detail::BaseReaderAccess::baseReader(reader);
+        if (underlyingReader == &reader && !calculateCRC) {
+          // Not nested in any CRC-calculating scope, so directly use the base reader, which e.g. keeps it seekable
+          directReader = &reader;
+          return;
         }
 
+        // Read the whole data requested by the wrapping reader at once, but do not read ahead of it, since the base
+        // underlying reader is used for peeking the next member Elements.
         if (calculateCRC) {
-          wrappingReader = BitReader{[underlyingReader, &reader, this](std::byte &out) {
-            // peek in the base underlying reader to not fill the cache of the parent CRC-calculating reader.
-            if (!underlyingReader || !underlyingReader->hasMoreBytes()) {
-              return false;
-            }
-            // read from the direct parent reader to transitively read from all parent CRC-calculating readers.
-            out = reader.readByte();
-            processNextByte(out);
-            return true;
-          }};
+          wrappingReader = BitReader{
+              [underlyingReader, &reader, statistics, this](std::span<std::byte> outBytes) -> std::size_t {
+                // peek in the base underlying reader to not fill the cache of the parent CRC-calculating reader.
+                if (!underlyingReader->hasMoreBytes()) {
+                  return 0;
+                }
+                if (outBytes.size() > 1U && outBytes.size() <= sizeof(std::uintmax_t) &&
+                    !underlyingReader->peek(ByteCount{outBytes.size()})) [[unlikely]] {
+                  // Near the end of the input, only forward the bytes actually available
+                  outBytes = outBytes.first(1);
+                }
+                // read from the direct parent reader to transitively read from all parent CRC-calculating readers.
+                reader.readBytesInto(outBytes);
+                crc32 = updateCRC32(crc32, outBytes);
+                if (statistics) {
+                  statistics->crc32Bytes += ByteCount{outBytes.size()};
+                }
+                return outBytes.size();
+              },
+              NO_READ_AHEAD};
         } else {
           // Simply wrap the base reader
-          wrappingReader = BitReader{[underlyingReader](std::byte &out) {
-            if (!underlyingReader || !underlyingReader->hasMoreBytes()) {
-              return false;
-            }
-            out = underlyingReader->readByte();
-            return true;
-          }};
+          wrappingReader = BitReader{
+              [underlyingReader](std::span<std::byte> outBytes) -> std::size_t {
+                if (!underlyingReader->hasMoreBytes()) {
+                  return 0;
+                }
+                underlyingReader->readBytesInto(outBytes);
+                return outBytes.size();
+              },
+              NO_READ_AHEAD};
         }
 
-        readerMap[&wrappingReader] = underlyingReader;
+        bml::detail::BaseReaderAccess::setBaseReader(wrappingReader, *underlyingReader);
       }
 
       CRCScope(const CRCScope &) = delete;
       CRCScope(CRCScope &&) noexcept = delete;
-
-      ~CRCScope() noexcept { readerMap.erase(&wrappingReader); }
+      ~CRCScope() noexcept = default;
 
       CRCScope &operator=(const CRCScope &) = delete;
       CRCScope &operator=(CRCScope &&) noexcept = delete;
 
-      BitReader &peeker() { return *readerMap.at(&wrappingReader); }
-      BitReader &reader() { return wrappingReader; }
+      BitReader &peeker() {
+        return directReader ? *directReader : bml::detail::BaseReaderAccess::baseReader(wrappingReader);
+      }
+      BitReader &reader() { return directReader ? *directReader : wrappingReader; }
 
       void validateCRC(const MasterElement &master) const {
         auto finalCRC32 = ~crc32;
@@ -377,81 +648,154 @@ namespace bml::ebml {
       }
 
     private:
-      void processNextByte(std::byte b) {
-        auto val = static_cast<uint32_t>(b);
-        crc32 = CRC_TABLE[(crc32 ^ val) & 0xFF] ^ (crc32 >> 8);
-      }
+      /**
+       * A single byte read-ahead buffer, i.e. all reads (also the bytes required to fill the read cache) are directly
+       * forwarded to the parent reader as a whole
+       */
+      static constexpr ByteCount NO_READ_AHEAD = 1_bytes;
 
-    private:
       uint32_t crc32 = 0xFFFFFFFF;
       BitReader wrappingReader;
+      /** The reader used directly without any wrapping reader, if set */
+      BitReader *directReader = nullptr;
+    };
 
-      // Mapping to the original non CRC-calculating BitReader, used for peeking. Multiple mappings to allow for
-      // concurrent reading in one thread (e.g. via chunked reading)
-      static thread_local std::map<BitReader *, BitReader *> readerMap;
-
-      friend BitReader &getUnderlyingReader(BitReader &);
-
-      // Adapted from https://rosettacode.org/wiki/CRC-32#C++
-      static constexpr auto CRC_TABLE = [] {
-        std::array<std::uint32_t, 256> table;
-        for (uint32_t i = 0; i < table.size(); ++i) {
-          uint32_t c = i;
-          for (uint8_t k = 0; k < 8; ++k) {
-            if (c & 1) {
-              // IEEE-CRC-32 algorithm, specified in ISO 3309 or ITU-T V.42
-              // This is the "reversed" (little-endian) form as of
-              // https://en.wikipedia.org/wiki/Cyclic_redundancy_check
-              c = 0xEDB88320U ^ (c >> 1);
-            } else {
-              c >>= 1;
-            }
-          }
-          table[i] = c;
+    ByteCount requiredElementBytes(BitReader &reader) {
+      const auto start = reader.position();
+      ByteCount numBytes{};
+      try {
+        auto header = readRawElementHeader(reader);
+        numBytes = header.headerSize();
+        if (!header.unknownSize) {
+          numBytes += ByteCount{header.size};
         }
-        return table;
-      }();
-
-      // See https://github.com/Matroska-Org/libebml/blob/master/src/EbmlCrc32.cpp
-      static_assert(CRC_TABLE[7] == 0x9e6495a3L);
-    };
+      } catch (const EndOfStreamError &) {
+        numBytes = (reader.position() - start).divide<8>() + 1_bytes;
+      }
+      reader.seek(start);
+      return numBytes;
+    }
 
-    thread_local std::map<BitReader *, BitReader *> CRCScope::readerMap;
+    /**
+     * Skips the unknown member Element with the given ID of the Master Element with the given ID.
+     */
+    static void skipUnknownMember(BitReader &reader, ElementId memberId, ElementId id, ReadStatistics *statistics) {
+      const auto start = reader.position();
+      ByteCount elementSize{readRawElementHeader(reader).size};
+      Debug::error("No member element with ID '" + toHexString(static_cast<uintmax_t>(memberId)) +
+                   "' for current master element '" + toHexString(static_cast<uintmax_t>(id)) +
+                   "', skipping unknown element of size " + elementSize.toString());
+      reader.skip(elementSize);
+      if (statistics) [[unlikely]] {
+        ++statistics->numUnknownElements;
+        statistics->unknownElementBytes += (reader.position() - start).divide<8>();
+      }
+    }
 
-    BitReader &getUnderlyingReader(BitReader &reader) {
-      if (auto it = CRCScope::readerMap.find(&reader); it != CRCScope::readerMap.end()) {
-        return *it->second;
+    void skipFilteredMember(BitReader &reader, ElementId memberId, std::span<const ElementId> terminatingElementIds,
+                            ReadStatistics *statistics) {
+      const auto start = reader.position();
+      auto header = readRawElementHeader(reader);
+      if (header.unknownSize) {
+        // Ends with the next sibling Element or any Element ending the parent Master Element
+        std::set<ElementId> terminatingIds(std::ranges::begin(terminatingElementIds),
+                                           std::ranges::end(terminatingElementIds));
+        terminatingIds.insert(memberId);
+        while (reader.hasMoreBytes() && !terminatingIds.contains(peekElementId(reader))) {
+          skipElement(reader, terminatingIds);
+        }
+      } else {
+        reader.skip(ByteCount{header.size});
+      }
+      if (statistics) [[unlikely]] {
+        ++statistics->numSkippedElements;
+        statistics->skippedElementBytes += (reader.position() - start).divide<8>();
       }
-      return reader;
     }
 
     void readMasterElement(BitReader &reader, ElementId id, MasterElement &master, const ReadOptions &options,
                            std::map<ElementId, std::function<void(BitReader &, const ReadOptions &)>> &&members,
                            std::set<ElementId> &&terminatingElementIds) {
-      auto readMember =
-          readMasterElementChunked(reader, id, master, options, std::move(members), std::move(terminatingElementIds));
+      using MemberReaders = std::map<ElementId, std::function<void(BitReader &, const ReadOptions &)>>;
+      const std::vector<ElementId> terminatingIds(terminatingElementIds.begin(), terminatingElementIds.end());
+      MemberReader readMember{[](void *context, ElementId memberId, BitReader &r, const ReadOptions &o) {
+                                auto &memberReaders = *static_cast<MemberReaders *>(context);
+                                if (auto it = memberReaders.find(memberId); it != memberReaders.end()) {
+                                  it->second(r, o);
+                                  return true;
+                                }
+                                return false;
+                              },
+                              &members};
+      readMasterElement(reader, id, master, options, readMember, terminatingIds);
+    }
 
-      while (readMember) {
-        readMember();
+    void readMasterElement(BitReader &reader, ElementId id, MasterElement &master, const ReadOptions &options,
+                           MemberReader readMember, std::span<const ElementId> terminatingElementIds) {
+      auto masterSize = readElementHeader(reader, id);
+      CRCScope crcScope{reader, options.validateCRC32, options.statistics};
+
+      const auto hasMoreMembers = [masterSize, startPos{crcScope.peeker().position()}](BitReader &r) {
+        return (masterSize == UNKNOWN_SIZE && r.hasMoreBytes()) || (r.position() < startPos + masterSize);
+      };
+
+      // CRC-32 Element (if present) MUST BE the first Element
+      if (options.validateCRC32 && hasMoreMembers(crcScope.peeker()) && peekElementId(crcScope.peeker()) == CRC32::ID) {
+        // don't read with CRC scope, since the CRC-32 itself is not part of its calculated value
+        // but read with given BitReader, which includes the CRC scopes of any parent Element.
+        ElementRecorder recorder{options, reader};
+        recorder.measure([&]() { return readMember(CRC32::ID, reader, options); });
+        recorder.record(CRC32::ID);
+      }
+
+      while (hasMoreMembers(crcScope.peeker())) {
+        auto memberId = peekElementId(crcScope.peeker());
+        if (isSkippedElement(options, memberId)) [[unlikely]] {
+          skipFilteredMember(crcScope.reader(), memberId, terminatingElementIds, options.statistics);
+          continue;
+        }
+        ElementRecorder recorder{options, crcScope.reader()};
+        if (recorder.measure([&]() { return readMember(memberId, crcScope.reader(), options); })) {
+          recorder.record(memberId);
+          continue;
+        }
+        if (masterSize == UNKNOWN_SIZE &&
+            std::ranges::find(terminatingElementIds, memberId) != terminatingElementIds.end()) {
+          // end of element with unknown size
+          break;
+        }
+        skipUnknownMember(crcScope.reader(), memberId, id, options.statistics);
+      }
+
+      if (options.validateCRC32) {
+        crcScope.validateCRC(master);
       }
     }
 
     ChunkedReader
     readMasterElementChunked(BitReader &reader, ElementId id, MasterElement &master, ReadOptions options,
                              std::map<ElementId, std::function<void(BitReader &, const ReadOptions &)>> &&members,
-                             std::set<ElementId> &&terminatingElementIds) {
+                             std::set<ElementId> &&terminatingElementIds,
+                             std::map<ElementId, std::function<ChunkedReader(BitReader &, const ReadOptions &)>>
+                                 &&chunkedMembers) {
 
       // The parameters are only available until the first suspension point (co_yield), so cannot reference any
       // parameter not outliving the coroutine object
       auto memberReaders = std::move(members);
       auto terminatingIds = std::move(terminatingElementIds);
+      const std::vector<ElementId> terminatingIdList(terminatingIds.begin(), terminatingIds.end());
+      auto chunkedMemberReaders = std::move(chunkedMembers);
 
       // "Yield" nothing to allow for lazy reading and initializing the chunked reader before actually having data
       // available
-      co_yield {};
+      co_yield std::optional<ElementId>{};
 
-      auto masterSize = readElementHeader(reader, id);
-      CRCScope crcScope{reader, options.validateCRC32};
+      const bool resumable = options.resumable && !options.validateCRC32 && reader.isSeekable();
+      ByteCount masterSize{};
+      while (auto missing = readResumable(reader, resumable, [&]() { masterSize = readElementHeader(reader, id); })) {
+        co_yield missing;
+      }
+      CRCScope crcScope{reader, options.validateCRC32, options.statistics};
 
       const auto hasMoreMembers = [masterSize, startPos{crcScope.peeker().position()}](BitReader &r) {
         return (masterSize == UNKNOWN_SIZE && r.hasMoreBytes()) || (r.position() < startPos + masterSize);
@@ -463,26 +807,70 @@ namespace bml::ebml {
         if (auto it = memberReaders.find(crcId); crcId == CRC32::ID && it != memberReaders.end()) {
           // don't read with CRC scope, since the CRC-32 itself is not part of its calculated value
           // but read with given BitReader, which includes the CRC scopes of any parent Element.
-          it->second(reader, options);
+          ElementRecorder recorder{options, reader};
+          recorder.measure([&]() { it->second(reader, options); });
+          recorder.record(crcId);
           co_yield it->first;
         }
       }
 
-      while (hasMoreMembers(crcScope.peeker())) {
-        auto memberId = peekElementId(crcScope.peeker());
-        if (auto it = memberReaders.find(memberId); it != memberReaders.end()) {
-          it->second(crcScope.reader(), options);
+      while (true) {
+        if (!hasMoreMembers(crcScope.peeker())) {
+          if (resumable && masterSize == UNKNOWN_SIZE) {
+            // The end of the input cannot be distinguished from a temporary shortage of input data. Re-seek to the
+            // current position to detect any data appended afterwards.
+            co_yield 1_bytes;
+            crcScope.peeker().seek(crcScope.peeker().position());
+            continue;
+          }
+          break;
+        }
+
+        ElementId memberId{};
+        if (auto missing = readResumable(crcScope.peeker(), resumable,
+                                         [&]() { memberId = peekElementId(crcScope.peeker()); })) {
+          co_yield missing;
+          continue;
+        }
+
+        if (isSkippedElement(options, memberId)) [[unlikely]] {
+          if (auto missing = readResumable(crcScope.reader(), resumable, [&]() {
+                skipFilteredMember(crcScope.reader(), memberId, terminatingIdList, options.statistics);
+              })) {
+            co_yield missing;
+          }
+        } else if (auto it = memberReaders.find(memberId); it != memberReaders.end()) {
+          ElementRecorder recorder{options, crcScope.reader()};
+          if (auto missing = recorder.measure([&]() {
+                return readResumable(crcScope.reader(), resumable, [&]() { it->second(crcScope.reader(), options); });
+              })) {
+            co_yield missing;
+            continue;
+          }
+          recorder.record(memberId);
           co_yield it->first;
+        } else if (auto chunkedIt = chunkedMemberReaders.find(memberId); chunkedIt != chunkedMemberReaders.end()) {
+          // Only measure the actual reading, not the time the chunked reader is suspended
+          ElementRecorder recorder{options, crcScope.reader()};
+          auto readMember = chunkedIt->second(crcScope.reader(), options);
+          while (readMember) {
+            recorder.measure([&]() { readMember(); });
+            if (auto missing = readMember.missingBytes()) {
+              co_yield missing;
+            }
+          }
+          recorder.record(memberId);
+          co_yield chunkedIt->first;
         } else if (masterSize == UNKNOWN_SIZE && terminatingIds.contains(memberId)) {
           // end of element with unknown size
           break;
         } else {
-          std::ignore /* skip ID */ = readVariableSizeInteger(crcScope.reader(), true /* don't care */);
-          ByteCount elementSize{readVariableSizeInteger(crcScope.reader(), false /* without prefix */).first};
-          Debug::error("No member element with ID '" + toHexString(static_cast<uintmax_t>(memberId)) +
-                       "' for current master element '" + toHexString(static_cast<uintmax_t>(id)) +
-                       "', skipping unknown element of size " + elementSize.toString());
-          crcScope.reader().skip(elementSize);
+          if (auto missing = readResumable(crcScope.reader(), resumable, [&]() {
+                skipUnknownMember(crcScope.reader(), memberId, id, options.statistics);
+              })) {
+            co_yield missing;
+            continue;
+          }
         }
       }
 
@@ -493,17 +881,131 @@ namespace bml::ebml {
       co_return;
     }
 
+    /**
+     * Content sizes of all (nested) Master Elements written by the outermost writeMasterElement() call of the current
+     * thread, in order of writing.
+     *
+     * NOTE: The sizes are stored as plain number of bytes, since the iterators of a std::vector<ByteCount> trip up
+     * the iterator concept checks of some compilers.
+     */
+    struct MasterElementSizes {
+      std::vector<std::size_t> contentSizes;
+      std::size_t nextIndex = 0;
+      bool measuring = true;
+    };
+
+    static thread_local MasterElementSizes *activeMasterSizes = nullptr;
+
+    /** Maximum number of Master Element sizes whose storage is retained for the next outermost write */
+    static constexpr std::size_t MAX_RETAINED_MASTER_SIZES = 4096;
+
+    struct ActiveMasterSizesScope {
+      explicit ActiveMasterSizesScope(MasterElementSizes &sizes) noexcept { activeMasterSizes = &sizes; }
+      ActiveMasterSizesScope(const ActiveMasterSizesScope &) = delete;
+      ActiveMasterSizesScope(ActiveMasterSizesScope &&) noexcept = delete;
+      ~ActiveMasterSizesScope() noexcept { activeMasterSizes = nullptr; }
+
+      ActiveMasterSizesScope &operator=(const ActiveMasterSizesScope &) = delete;
+      ActiveMasterSizesScope &operator=(ActiveMasterSizesScope &&) noexcept = delete;
+    };
+
+    /**
+     * Returns whether the first of the given members is a present CRC-32 Element.
+     */
+    static bool hasCRC32Member(const std::vector<std::pair<ElementId, std::function<void(BitWriter &)>>> &members) {
+      if (members.empty() || members.front().first != CRC32::ID) {
+        return false;
+      }
+      BitWriter sizeWriter{BitWriter::DISCARD};
+      members.front().second(sizeWriter);
+      return static_cast<bool>(sizeWriter.position());
+    }
+
     void writeMasterElement(BitWriter &writer, ElementId id,
                             const std::vector<std::pair<ElementId, std::function<void(BitWriter &)>>> &members) {
-
-      writeElement(writer, id, [&members](BitWriter &bufWriter) {
+      const auto writeMembers = [&members](BitWriter &memberWriter) {
         for (const auto &member : members) {
-          member.second(bufWriter);
+          member.second(memberWriter);
+        }
+      };
+
+      if (!activeMasterSizes) {
+        // Outermost Master Element, determine the content sizes of all nested Master Elements in a first pass over a
+        // discarding writer. This allows to write all Element headers and contents directly to the output in the
+        // second pass without buffering (and copying) the contents of each nesting level.
+        // The storage is reused across calls to avoid allocating the size list for every (small) Master Element
+        static thread_local MasterElementSizes sizes{};
+        if (sizes.contentSizes.capacity() > MAX_RETAINED_MASTER_SIZES) {
+          sizes.contentSizes = {};
         }
-      });
+        sizes.contentSizes.clear();
+        sizes.nextIndex = 0;
+        sizes.measuring = true;
+        ActiveMasterSizesScope scope{sizes};
+        BitWriter sizeWriter{BitWriter::DISCARD};
+        writeMasterElement(sizeWriter, id, members);
+        sizes.measuring = false;
+        writeMasterElement(writer, id, members);
+        return;
+      }
+
+      if (activeMasterSizes->measuring) {
+        // The discarding writer only counts the written bytes, so the header can be written after the content
+        auto index = activeMasterSizes->contentSizes.size();
+        activeMasterSizes->contentSizes.push_back(0);
+        const auto start = writer.position();
+        writeMembers(writer);
+        const auto contentSize = (writer.position() - start).divide<8>();
+        activeMasterSizes->contentSizes[index] = contentSize.num;
+        writeElementHeader(writer, id, contentSize);
+        return;
+      }
+
+      const ByteCount contentSize{activeMasterSizes->contentSizes.at(activeMasterSizes->nextIndex++)};
+      writeElementHeader(writer, id, contentSize);
+      const auto start = writer.position();
+      if (hasCRC32Member(members)) {
+        // The CRC-32 is calculated over the encoded following members, so write them into a temporary buffer first
+        auto buffer = WriteBufferPool::threadLocal().acquire(contentSize);
+        BitWriter bufferWriter{*buffer, BitWriter::GROW};
+        for (auto it = std::next(members.begin()); it != members.end(); ++it) {
+          it->second(bufferWriter);
+        }
+        bufferWriter.flush();
+        CRC32::calculate(buffer.bytes()).write(writer);
+        writer.writeBytes(buffer.bytes());
+      } else {
+        writeMembers(writer);
+      }
+      if (writer.position() - start != BitCount{contentSize}) [[unlikely]] {
+        throw std::logic_error("Master Element content size does not match size determined before writing");
+      }
     }
   } // namespace detail
 
+  void ReadStatistics::record(ElementId id, ByteCount numBytes, std::chrono::nanoseconds duration) {
+    auto &entry = elements[id];
+    ++entry.count;
+    entry.numBytes += numBytes;
+    entry.duration += duration;
+  }
+
+  ReadStatistics &ReadStatistics::operator+=(const ReadStatistics &other) {
+    for (const auto &[id, entry] : other.elements) {
+      auto &ownEntry = elements[id];
+      ownEntry.count += entry.count;
+      ownEntry.numBytes += entry.numBytes;
+      ownEntry.duration += entry.duration;
+    }
+    numUnknownElements += other.numUnknownElements;
+    unknownElementBytes += other.unknownElementBytes;
+    numSkippedElements += other.numSkippedElements;
+    skippedElementBytes += other.skippedElementBytes;
+    crc32Bytes += other.crc32Bytes;
+    numFrames += other.numFrames;
+    return *this;
+  }
+
   void VariableSizeInteger::read(bml::BitReader &reader, const ReadOptions &) {
     value = detail::readVariableSizeInteger(reader, false).first;
   }
@@ -523,6 +1025,10 @@ namespace bml::ebml {
     }
   }
 
+  CRC32 CRC32::calculate(std::span<const std::byte> data, CRC32 previous) noexcept {
+    return CRC32{~detail::updateCRC32(~previous.get(), data)};
+  }
+
   void CRC32::write(BitWriter &writer) const {
     detail::writeElementHeader(writer, ID, 4_bytes);
     const auto BYTE = 1_bytes;
@@ -557,6 +1063,26 @@ namespace bml::ebml {
     writer.fillBytes(std::byte{0x00}, skipBytes);
   }
 
+  void Void::fill(BitWriter &writer, ByteCount numBytes) {
+    // Element ID and the largest single-byte Element Data Size VINT
+    constexpr auto MAX_SHORT_VOID = 2_bytes + 126_bytes;
+    constexpr auto LONG_SIZE_BYTES = 8_bytes;
+    if (numBytes < 2_bytes) {
+      throw std::invalid_argument("Cannot fill less than 2 bytes with a Void Element");
+    }
+    writer.write(static_cast<std::underlying_type_t<ElementId>>(ID), 1_bytes);
+    if (numBytes <= MAX_SHORT_VOID) {
+      const auto numContentBytes = numBytes - 2_bytes;
+      writer.write(0x80U | numContentBytes.value(), 1_bytes);
+      writer.fillBytes(std::byte{0x00}, numContentBytes);
+    } else {
+      // Use a non-minimal Element Data Size VINT, since the minimal size might not add up to the exact number of bytes
+      const auto numContentBytes = numBytes - 1_bytes - LONG_SIZE_BYTES;
+      writer.write((uint64_t{1} << (LONG_SIZE_BYTES.value() * 7U)) | numContentBytes.value(), LONG_SIZE_BYTES);
+      writer.fillBytes(std::byte{0x00}, numContentBytes);
+    }
+  }
+
   void Void::skip(BitReader &reader) { detail::skipElement(reader); }
   void Void::copy(BitReader &reader, BitWriter &writer) { detail::copyElement(reader, writer); }
 
@@ -586,6 +1112,7 @@ namespace bml::ebml {
 
   ElementId ChunkedReader::operator()() {
     if (handle && !handle.done() && !handle.promise().lastId) {
+      handle.promise().missingBytes = 0_bytes;
       handle.resume();
     }
     if (handle.promise().error) {
@@ -598,4 +1125,6 @@ namespace bml::ebml {
     }
     return id;
   }
+
+  ByteCount ChunkedReader::missingBytes() const noexcept { return handle ? handle.promise().missingBytes : 0_bytes; }
 } // namespace bml::ebml
@@ -9,9 +9,15 @@
 #include <cstdint>
 #include <limits>
 #include <map>
+#include <memory_resource>
 #include <optional>
 #include <set>
+#include <span>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <variant>
 #include <vector>
 
 /**
@@ -27,6 +33,80 @@ namespace bml::ebml {
 
   using Date = std::chrono::utc_time<std::chrono::nanoseconds>;
 
+  /**
+   * Statistics collected while reading Elements, see ReadOptions#statistics.
+   *
+   * This allows to e.g. determine where the time for parsing an input is spent or to spot pathological inputs (e.g.
+   * lots of tiny Frames or unknown Elements).
+   */
+  struct ReadStatistics {
+    struct ElementStatistics {
+      /** The number of Elements read */
+      std::size_t count = 0;
+      /** The total number of bytes read for these Elements, including their Element headers */
+      ByteCount numBytes;
+      /**
+       * The total wall time spent reading these Elements, including the time spent reading their members.
+       *
+       * NOTE: This is only measured if the ReadStatistics#measureTime flag is set.
+       */
+      std::chrono::nanoseconds duration{};
+    };
+
+    /**
+     * Whether to also measure the time spent reading the Elements, see ElementStatistics#duration.
+     */
+    bool measureTime = false;
+
+    /**
+     * The statistics of all read member Elements of Master Elements by their Element ID.
+     *
+     * NOTE: Top-level Elements which are not a member of any Master Element (e.g. the EBML header) are not recorded,
+     * only their members are.
+     */
+    std::map<ElementId, ElementStatistics> elements;
+
+    /**
+     * The number of unknown member Elements skipped while reading their Master Elements.
+     */
+    std::size_t numUnknownElements = 0;
+
+    /**
+     * The total number of bytes skipped for unknown member Elements, including their Element headers.
+     */
+    ByteCount unknownElementBytes;
+
+    /**
+     * The number of member Elements skipped due to the ReadOptions#skipElements filter.
+     */
+    std::size_t numSkippedElements = 0;
+
+    /**
+     * The total number of bytes skipped due to the ReadOptions#skipElements filter, including the Element headers.
+     */
+    ByteCount skippedElementBytes;
+
+    /**
+     * The number of bytes the CRC-32 is calculated over for validating CRC-32 Elements, see ReadOptions#validateCRC32.
+     */
+    ByteCount crc32Bytes;
+
+    /**
+     * The number of Frames read from Elements containing media data (e.g. Matroska Blocks).
+     */
+    std::size_t numFrames = 0;
+
+    /**
+     * Records a single read Element of the given ID with the given size and duration.
+     */
+    void record(ElementId id, ByteCount numBytes, std::chrono::nanoseconds duration = {});
+
+    /**
+     * Adds all counters of the given statistics to this statistics.
+     */
+    ReadStatistics &operator+=(const ReadStatistics &other);
+  };
+
   struct ReadOptions {
     /**
      * If set to true, will validate CRC-32 Elements in Master Elements (if present) and throw an ChecksumMismatchError
@@ -44,6 +124,163 @@ namespace bml::ebml {
      * only be used for displaying or container analysis.
      */
     bool readMediaData = false;
+
+    /**
+     * The complete in-memory data the Elements are read from (e.g. the contents of a MappedFile), if available.
+     *
+     * If set, the binary blobs of Elements containing media data are neither copied nor only sized, but directly
+     * reference (borrow) the corresponding bytes of this data, independent of the readMediaData flag.
+     *
+     * NOTE: This needs to be the same data the BitReader reads from (starting at the same position) and needs to
+     * outlive any access to the read media data!
+     */
+    std::span<const std::byte> mediaDataSource{};
+
+    /**
+     * The memory resource to allocate the copied media data (Frame payloads) from, if set.
+     *
+     * If set and the media data is read (see readMediaData), the media data of all Frames is allocated from this
+     * resource and the Frames' DataRanges borrow the allocated memory. This allows to e.g. use a
+     * std::pmr::monotonic_buffer_resource as arena to avoid one allocation per Frame for reading Clusters and to
+     * release all Frame payloads at once.
+     *
+     * NOTE: Only the Frame payloads are allocated from this resource! The parsed Element tree itself (e.g. the
+     * std::vector of Clusters, Blocks and DataRanges, the std::string values of string Elements, the std::vector values
+     * of other binary Elements) still uses the global allocator and is freed piece by piece on destruction.
+     *
+     * NOTE: The allocated memory is never deallocated individually, so the memory resource needs to outlive any access
+     * to the read media data and should release its memory on destruction!
+     *
+     * NOTE: This only applies for media data copied from the input, not for media data borrowed from the
+     * mediaDataSource.
+     *
+     * NOTE: The memory resource is not required to be thread-safe, Segment::readParallel() synchronizes the accesses
+     * of all its worker threads.
+     */
+    std::pmr::memory_resource *frameDataResource = nullptr;
+
+    /**
+     * If set to true and the media data is read (see readMediaData), the media data of all Frames of a single Block is
+     * read into a single reference-counted memory chunk and the Frames' DataRanges share the ownership of (their part
+     * of) this chunk.
+     *
+     * This reduces the number of allocations for laced Blocks and allows for the Frame data to outlive the read
+     * Elements, e.g. to pass it to decoders running on other threads without copying.
+     *
+     * NOTE: The frameDataResource takes precedence over this flag, if set.
+     */
+    bool shareMediaData = false;
+
+    /**
+     * If set to true, running out of input data while reading chunked (see ChunkedReader) does not abort reading, but
+     * suspends the chunked reader at the start of the incomplete Element until more data is available.
+     *
+     * This allows for push-style reading of partially available input, e.g. when the data is received over the
+     * network. See ChunkedReader#missingBytes() for how to determine the amount of data required to continue.
+     *
+     * NOTE: Since the reader needs to be reset to the start of the incomplete Element, this requires a seekable
+     * BitReader (see BitReader::isSeekable()) and is not supported when validating CRC-32 Elements.
+     *
+     * NOTE: Since the end of the input cannot be distinguished from a temporary shortage of input data, Master
+     * Elements with Unknown Data Size are never finished when reaching the end of the input.
+     */
+    bool resumable = false;
+
+    /**
+     * The IDs of the member Elements to skip instead of reading them into their Master Elements.
+     *
+     * Skipped Elements (and all their members) are not decoded at all, but skipped based on their Element size. This
+     * allows to only read the parts of the Element tree actually needed, e.g. to only read the Info and Tracks as well
+     * as the Cluster timestamps of a Matroska file by skipping the Cues, Chapters, Attachments, Tags and all Blocks.
+     * Skipped Elements are also not seeked to when reading via the SeekHead (see Segment::readIndexed()).
+     *
+     * NOTE: The members of skipped Elements retain their previous (e.g. default) values, so Master Elements with
+     * skipped mandatory members cannot be written back correctly. These objects can only be used for displaying or
+     * container analysis.
+     *
+     * NOTE: This does not apply to CRC-32 Elements read for validation, see validateCRC32.
+     *
+     * NOTE: The IDs are only referenced (to keep copying the options cheap), so the given list needs to outlive any
+     * reading with these options!
+     */
+    std::span<const ElementId> skipElements{};
+
+    /**
+     * The statistics object to record the read Elements into, if set.
+     *
+     * NOTE: The statistics object needs to outlive any reading with these options. Since the counters are NOT
+     * synchronized, the same statistics object must not be used for reading on different threads at the same time.
+     * Matroska::readParallel() collects the statistics per thread and adds them to this object afterwards.
+     *
+     * NOTE: To also count the accesses to the underlying byte source, see BitReader::setStatistics().
+     */
+    ReadStatistics *statistics = nullptr;
+
+    /**
+     * If set to true, will validate the values of UTF-8 string Elements (see Utf8StringElement) and throw an
+     * InvalidEncodingError if the read value is not valid UTF-8.
+     *
+     * The values are validated in bulk via bml::isValidUtf8() instead of decoding them one code point at a time.
+     */
+    bool validateUtf8 = false;
+  };
+
+  /**
+   * String value either owning its characters or borrowing them from external memory, e.g. the
+   * ReadOptions#mediaDataSource.
+   *
+   * String Elements with this value type borrow their values from the mediaDataSource if it is set and fall back to
+   * copying their values into owned memory otherwise, see StringElement and Utf8StringElement. This allows for the
+   * same Element types to be used for zero-copy reading from in-memory data as well as for reading from any other
+   * input.
+   *
+   * NOTE: Copies of a borrowed value borrow the same memory, so the borrowed memory needs to outlive any access to the
+   * value and all its copies!
+   */
+  template <typename CharT>
+  class BorrowableString {
+  public:
+    using view_type = std::basic_string_view<CharT>;
+    using string_type = std::basic_string<CharT>;
+
+    constexpr BorrowableString() noexcept = default;
+    constexpr BorrowableString(const CharT *str) : content(string_type{str}) {}
+    constexpr BorrowableString(string_type str) noexcept : content(std::move(str)) {}
+
+    /**
+     * Creates a value borrowing the given characters.
+     */
+    static constexpr BorrowableString borrow(view_type str) noexcept {
+      BorrowableString result{};
+      result.content = str;
+      return result;
+    }
+
+    constexpr view_type view() const noexcept {
+      return std::visit([](const auto &str) { return view_type{str}; }, content);
+    }
+    constexpr operator view_type() const noexcept { return view(); }
+
+    constexpr bool isBorrowed() const noexcept { return std::holds_alternative<view_type>(content); }
+    constexpr std::size_t size() const noexcept { return view().size(); }
+    constexpr bool empty() const noexcept { return view().empty(); }
+
+    friend constexpr bool operator==(const BorrowableString &one, const BorrowableString &other) noexcept {
+      return one.view() == other.view();
+    }
+    friend constexpr auto operator<=>(const BorrowableString &one, const BorrowableString &other) noexcept {
+      return one.view() <=> other.view();
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const BorrowableString &str) {
+      return os << bml::printView(str.view());
+    }
+    std::ostream &printYAML(std::ostream &os, const bml::yaml::Options &options) const {
+      return bml::yaml::print(os, options, view());
+    }
+
+  private:
+    std::variant<view_type, string_type> content;
   };
 
   inline namespace literals {
@@ -145,6 +382,60 @@ namespace bml::ebml {
       friend struct bml::yaml::YAMLTraits;
     };
 
+    /**
+     * Reads the content of the binary Element with the given ID as DataRange, see BinaryDataElement.
+     */
+    DataRange readBinaryData(BitReader &reader, ElementId id, const ReadOptions &options);
+
+    /**
+     * Writes the binary Element with the given ID and the given content, see BinaryDataElement.
+     *
+     * NOTE: Throws a NoReferencedDataError if the given content does not directly reference its raw bytes.
+     */
+    void writeBinaryData(BitWriter &writer, ElementId id, const DataRange &data);
+
+    /**
+     * Reads the header of the Element with the given ID and returns its content, borrowed from the
+     * ReadOptions#mediaDataSource.
+     *
+     * NOTE: Throws a NoReferencedDataError if the content is not contained in the mediaDataSource.
+     */
+    std::span<const std::byte> readBorrowedValue(BitReader &reader, ElementId id, const ReadOptions &options);
+
+    template <typename T>
+    concept BorrowedString = std::same_as<T, std::string_view> || std::same_as<T, std::u8string_view>;
+
+    template <BorrowedString T>
+    T readBorrowedString(BitReader &reader, ElementId id, const ReadOptions &options, T defaultValue) {
+      static_assert(sizeof(typename T::value_type) == sizeof(std::byte));
+      auto bytes = readBorrowedValue(reader, id, options);
+      if (bytes.empty()) {
+        return defaultValue;
+      }
+      return T{reinterpret_cast<const typename T::value_type *>(bytes.data()), bytes.size()};
+    }
+
+    template <typename T>
+    concept BorrowableStringValue = std::same_as<T, BorrowableString<typename T::view_type::value_type>>;
+
+    /**
+     * Creates the default value of a string Element type, borrowing BorrowableString defaults from the (static) string
+     * literal.
+     */
+    template <typename T, typename CharT>
+    constexpr T makeDefaultString(const CharT *value) {
+      if constexpr (BorrowableStringValue<T>) {
+        return T::borrow(value);
+      } else {
+        return T{value};
+      }
+    }
+
+    /**
+     * Throws an InvalidEncodingError if the given value of the Element with the given ID is not valid UTF-8.
+     */
+    void checkUtf8(ElementId id, std::u8string_view value);
+
     template <typename T>
     concept SimpleEBMLElement = EBMLElement<T> && requires(T val) {
       // Check whether the type T can be converted (and thus extends) to a specialization of BaseSimpleElement
@@ -342,29 +633,60 @@ namespace bml::ebml {
     void write(BitWriter &writer) const { writeValue(writer, ID, detail::DATE_EPOCH); }
   };
 
-  template <ElementId Id, detail::StringLiteral Default = "">
-  struct StringElement : public detail::BaseSimpleElement<std::string> {
+  /**
+   * String Element for ASCII strings.
+   *
+   * If the value type is std::string_view, the string value is not copied into memory, but borrowed from the
+   * ReadOptions#mediaDataSource, which is then required to be set (and to contain the read Element) for reading. If the
+   * value type is BorrowableString, the value is borrowed from the mediaDataSource if set and copied otherwise.
+   *
+   * NOTE: For borrowed values, the mediaDataSource needs to outlive any access to the read string value!
+   */
+  template <ElementId Id, detail::StringLiteral Default = "", typename T = std::string>
+  struct StringElement : public detail::BaseSimpleElement<T> {
     static constexpr ElementId ID = Id;
-    static constexpr std::string DEFAULT = Default.value;
+    static constexpr T DEFAULT = detail::makeDefaultString<T>(Default.value);
     static constexpr ByteCount maxNumBits() { return detail::calcElementSize(ID, detail::VINTMAX); }
 
-    constexpr StringElement() noexcept : detail::BaseSimpleElement<std::string>(DEFAULT) {}
-    explicit constexpr StringElement(std::string val) noexcept
-        : detail::BaseSimpleElement<std::string>(std::move(val)) {}
+    constexpr StringElement() noexcept : detail::BaseSimpleElement<T>(DEFAULT) {}
+    explicit constexpr StringElement(T val) noexcept : detail::BaseSimpleElement<T>(std::move(val)) {}
 
     constexpr ByteCount numBits() const noexcept {
-      return detail::calcElementSize(ID, ByteCount{value.size()}, value == DEFAULT);
+      return detail::calcElementSize(ID, ByteCount{this->value.size()}, this->value == DEFAULT);
     }
 
-    StringElement &operator=(std::string val) {
-      value = std::move(val);
+    StringElement &operator=(T val) {
+      this->value = std::move(val);
       return *this;
     }
 
-    void read(bml::BitReader &reader, const ReadOptions & = {}) { readValue(reader, ID, DEFAULT); }
-    void write(BitWriter &writer) const { writeValue(writer, ID, DEFAULT); }
+    void read(bml::BitReader &reader, const ReadOptions &options = {}) {
+      if constexpr (detail::BorrowedString<T>) {
+        this->value = detail::readBorrowedString<T>(reader, ID, options, DEFAULT);
+      } else if constexpr (detail::BorrowableStringValue<T>) {
+        if (options.mediaDataSource.empty()) {
+          this->readValue(reader, ID, DEFAULT);
+        } else {
+          this->value = T::borrow(detail::readBorrowedString(reader, ID, options, DEFAULT.view()));
+        }
+      } else {
+        this->readValue(reader, ID, DEFAULT);
+      }
+    }
+    void write(BitWriter &writer) const { this->writeValue(writer, ID, DEFAULT); }
   };
 
+  /**
+   * String Element for UTF-8 strings.
+   *
+   * If the value type is std::u8string_view, the string value is not copied into memory, but borrowed from the
+   * ReadOptions#mediaDataSource, which is then required to be set (and to contain the read Element) for reading. If
+   * the value type is BorrowableString, the value is borrowed from the mediaDataSource if set and copied otherwise.
+   *
+   * NOTE: For borrowed values, the mediaDataSource needs to outlive any access to the read string value!
+   *
+   * NOTE: The read string values are only validated to be valid UTF-8 if ReadOptions#validateUtf8 is set.
+   */
   template <ElementId Id, typename T = std::u8string>
   struct Utf8StringElement : public detail::BaseSimpleElement<T> {
     static constexpr ElementId ID = Id;
@@ -383,7 +705,22 @@ namespace bml::ebml {
       return *this;
     }
 
-    void read(bml::BitReader &reader, const ReadOptions & = {}) { this->readValue(reader, ID, DEFAULT); }
+    void read(bml::BitReader &reader, const ReadOptions &options = {}) {
+      if constexpr (detail::BorrowedString<T>) {
+        this->value = detail::readBorrowedString<T>(reader, ID, options, DEFAULT);
+      } else if constexpr (detail::BorrowableStringValue<T>) {
+        if (options.mediaDataSource.empty()) {
+          this->readValue(reader, ID, DEFAULT);
+        } else {
+          this->value = T::borrow(detail::readBorrowedString(reader, ID, options, DEFAULT.view()));
+        }
+      } else {
+        this->readValue(reader, ID, DEFAULT);
+      }
+      if (options.validateUtf8) {
+        detail::checkUtf8(ID, this->value);
+      }
+    }
     void write(BitWriter &writer) const { this->writeValue(writer, ID, DEFAULT); }
   };
 
@@ -404,6 +741,48 @@ namespace bml::ebml {
     void write(BitWriter &writer) const { writeValue(writer, ID, {}); }
   };
 
+  /**
+   * Binary Element for potentially large binary data, e.g. the contents of attached files.
+   *
+   * Other than for the BinaryElement, the content is stored as DataRange and read the same as media data: It is
+   * borrowed from the ReadOptions#mediaDataSource if set, only copied into memory if ReadOptions#readMediaData is set,
+   * and otherwise only its position relative to the start of the read byte source is stored. In the latter case, the
+   * content can be fetched on demand via fillDataRange().
+   *
+   * NOTE: Same as for media data, the content can only be written back if it directly references its raw bytes (i.e.
+   * for BORROWED, OWNED or SHARED data range modes).
+   */
+  template <ElementId Id>
+  struct BinaryDataElement : public detail::BaseSimpleElement<DataRange> {
+    static constexpr ElementId ID = Id;
+    static constexpr ByteCount maxNumBits() { return detail::calcElementSize(ID, detail::VINTMAX); }
+    ByteCount numBits() const noexcept { return detail::calcElementSize(ID, value.numBytes(), value.empty()); }
+
+    constexpr bool operator==(const BinaryDataElement &other) const noexcept { return value == other.value; }
+    constexpr std::weak_ordering operator<=>(const BinaryDataElement &other) const noexcept {
+      if (value == other.value) {
+        return std::weak_ordering::equivalent;
+      }
+      return value < other.value ? std::weak_ordering::less : std::weak_ordering::greater;
+    }
+
+    BinaryDataElement &operator=(DataRange val) noexcept {
+      value = std::move(val);
+      return *this;
+    }
+
+    /**
+     * Provides access to the stored content, e.g. to fill the content via fillDataRange().
+     */
+    const DataRange &data() const noexcept { return value; }
+    DataRange &data() noexcept { return value; }
+
+    void read(bml::BitReader &reader, const ReadOptions &options = {}) {
+      value = detail::readBinaryData(reader, ID, options);
+    }
+    void write(BitWriter &writer) const { detail::writeBinaryData(writer, ID, value); }
+  };
+
   struct CRC32 : public detail::BaseSimpleElement<uint32_t> {
     static constexpr ElementId ID = 0xBF_id;
 
@@ -423,6 +802,15 @@ namespace bml::ebml {
     void read(bml::BitReader &reader, const ReadOptions & = {});
     void write(BitWriter &writer) const;
 
+    /**
+     * Calculates the CRC-32 value over the given data, e.g. the encoded Elements following the CRC-32 Element within
+     * its parent Master Element.
+     *
+     * The optional previous parameter allows to continue the calculation of the CRC-32 value of the preceding data,
+     * e.g. when calculating the value for data written in multiple steps.
+     */
+    static CRC32 calculate(std::span<const std::byte> data, CRC32 previous = CRC32{}) noexcept;
+
     friend std::ostream &operator<<(std::ostream &os, const CRC32 &element);
     std::ostream &printYAML(std::ostream &os, const bml::yaml::Options &options) const;
   };
@@ -446,6 +834,14 @@ namespace bml::ebml {
     static void skip(BitReader &reader);
     static void copy(BitReader &reader, BitWriter &writer);
 
+    /**
+     * Writes a Void Element occupying exactly the given number of bytes (including the Element header), e.g. to fill
+     * space reserved for an Element written afterwards.
+     *
+     * NOTE: Throws an exception if the given number of bytes is too small to fit a Void Element (i.e. below 2 bytes)!
+     */
+    static void fill(BitWriter &writer, ByteCount numBytes);
+
     BML_DEFINE_PRINT(Void, skipBytes)
     std::ostream &printYAML(std::ostream &os, const bml::yaml::Options &options) const;
   };
@@ -515,8 +911,8 @@ namespace bml::ebml {
    * NOTE: Since this reader modifies the associated Master Element in-place, it MUST NOT outlive the Master Element and
    * the Master Element SHOULD NOT be modified/moved in the meantime!
    *
-   * NOTE: In the current implementation, the underlying BitReader needs to have enough data available to read a full
-   * member Element, i.e. its byte source MUST NOT return EOF. Otherwise the chunked reader aborts reading!
+   * NOTE: Unless the ReadOptions#resumable flag is set, the underlying BitReader needs to have enough data available to
+   * read a full member Element, i.e. its byte source MUST NOT return EOF. Otherwise the chunked reader aborts reading!
    *
    * NOTE: When the chunked reader is created with the ReadOptions#validateCRC32 set, it will only be checked if the
    * chunked reader is drained, i.e. read to its end. Partial reading of the associated Master Element will not invoke
@@ -528,8 +924,16 @@ namespace bml::ebml {
     using handle_type = std::coroutine_handle<promise_type>;
 
     ChunkedReader(handle_type h) : handle(h) {}
+    ChunkedReader(const ChunkedReader &) = delete;
+    ChunkedReader(ChunkedReader &&other) noexcept : handle(std::exchange(other.handle, {})) {}
     ~ChunkedReader();
 
+    ChunkedReader &operator=(const ChunkedReader &) = delete;
+    ChunkedReader &operator=(ChunkedReader &&other) noexcept {
+      std::swap(handle, other.handle);
+      return *this;
+    }
+
     /**
      * Checks whether this chunked reader is still active, e.g. there are more member Elements to read or the end of the
      * associated Master Element has not yet been processed.
@@ -553,6 +957,17 @@ namespace bml::ebml {
      */
     ElementId operator()();
 
+    /**
+     * Returns the number of bytes (starting at the current reader position) which need to be available to continue
+     * reading, if the last invocation of the function call operator ran out of input data.
+     *
+     * If the Element header of the incomplete Element could not be read, a lower bound is returned. Returns zero if the
+     * last invocation did not run out of input data.
+     *
+     * NOTE: This is only ever set if the ReadOptions#resumable flag is set.
+     */
+    ByteCount missingBytes() const noexcept;
+
   private:
     handle_type handle;
   };
@@ -560,7 +975,7 @@ namespace bml::ebml {
 /**
  * Defines the implementations of the member functions to read/write the Master Element with the following signatures:
  *
- * void printYAML(BitReader &, const ReadOptions &);
+ * void read(bml::BitReader &reader, const ReadOptions &options);
  * void write(bml::BitWriter &writer) const;
  */
 #define BML_EBML_DEFINE_IO(Type, ...)                                                                                  \
@@ -588,6 +1003,13 @@ namespace bml::ebml {
      */
     ByteCount readElementHeader(BitReader &reader, ElementId id);
 
+    /**
+     * Returns the ID of the next Element in the input reader without consuming it.
+     *
+     * NOTE: This function throws an EndOfStreamError if no Element ID can be read.
+     */
+    ElementId peekElementId(BitReader &reader);
+
     /**
      * Writes the Element header by writing the given Element ID and Element Data Size values.
      */
@@ -625,6 +1047,33 @@ namespace bml::ebml {
     void readMasterElement(BitReader &reader, ElementId id, MasterElement &master, const ReadOptions &options,
                            std::map<ElementId, std::function<void(BitReader &, const ReadOptions &)>> &&members,
                            std::set<ElementId> &&terminatingElementIds = {});
+
+    /**
+     * Non-owning and non-allocating reference to a function reading the member Element with the given ID into its
+     * Master Element.
+     *
+     * The function returns whether the Master Element has a member with the given Element ID.
+     */
+    struct MemberReader {
+      bool (*readMember)(void *context, ElementId id, BitReader &reader, const ReadOptions &options);
+      void *context;
+
+      bool operator()(ElementId id, BitReader &reader, const ReadOptions &options) const {
+        return readMember(context, id, reader, options);
+      }
+    };
+
+    /**
+     * Reads the Master Element with the given ID from the given bit reader and reads all its members via the given
+     * member reader.
+     *
+     * Other than the overload taking a map of member readers, this function does not allocate any memory for looking up
+     * the member Elements.
+     *
+     * See the overload above for the terminatingElementIds parameter.
+     */
+    void readMasterElement(BitReader &reader, ElementId id, MasterElement &master, const ReadOptions &options,
+                           MemberReader readMember, std::span<const ElementId> terminatingElementIds = {});
     /**
      * Reads the Master Element with the given ID from the given bit reader and reads all its given members.
      *
@@ -636,53 +1085,130 @@ namespace bml::ebml {
      * function. See https://www.rfc-editor.org/rfc/rfc8794.html#section-6.2 for which Element IDs need to be passed
      * into this parameter.
      *
+     * The optional chunkedMembers parameter can be used to read member Elements chunked themselves, e.g. to allow for
+     * resuming reading within a large member Element, see ReadOptions#resumable.
+     *
      * NOTE: The parent Master Element as well as the BitReader parameter MUST outlive the returned ChunkedReader
      * object!
      */
     [[nodiscard]] ChunkedReader
     readMasterElementChunked(BitReader &reader, ElementId id, MasterElement &master, ReadOptions options,
                              std::map<ElementId, std::function<void(BitReader &, const ReadOptions &)>> &&members,
-                             std::set<ElementId> &&terminatingElementIds = {});
+                             std::set<ElementId> &&terminatingElementIds = {},
+                             std::map<ElementId, std::function<ChunkedReader(BitReader &, const ReadOptions &)>>
+                                 &&chunkedMembers = {});
 
     /**
      * Writes the Master Element with the given ID to the given bit writer and all its members given.
      *
+     * If the first member is a present CRC-32 Element, its stored value is not written, but the CRC-32 value is
+     * calculated over the encoded following members instead.
+     *
      * NOTE: The members are written in order of listing in the members parameter.
      */
     void writeMasterElement(BitWriter &writer, ElementId id,
                             const std::vector<std::pair<ElementId, std::function<void(BitWriter &)>>> &members);
 
+    /**
+     * Helper type to determine the Element type of a (optional or repeated) Master Element member.
+     */
     template <typename T>
-    std::pair<ElementId, std::function<void(BitReader &, const ReadOptions &)>> wrapMemberReader(T &member)
+    struct MemberElementType {
+      using type = T;
+    };
+
+    template <typename T>
+    struct MemberElementType<std::optional<T>> {
+      using type = T;
+    };
+
+    template <typename T>
+    struct MemberElementType<std::vector<T>> {
+      using type = T;
+    };
+
+    template <typename T>
+    using member_element_t = typename MemberElementType<std::remove_cvref_t<T>>::type;
+
+    template <typename T>
+    concept ReadableMember = ReadableWithOptions<member_element_t<T>> && HasEBMLID<member_element_t<T>>;
+
+    template <typename T>
+    void readMemberElement(T &member, BitReader &reader, const ReadOptions &options)
       requires(ReadableWithOptions<T> && HasEBMLID<T>)
     {
-      return std::make_pair(T::ID,
-                            [&member](BitReader &reader, const ReadOptions &options) { member.read(reader, options); });
+      member.read(reader, options);
     }
 
     template <typename T>
-    std::pair<ElementId, std::function<void(BitReader &, const ReadOptions &)>>
-    wrapMemberReader(std::optional<T> &member)
+    void readMemberElement(std::optional<T> &member, BitReader &reader, const ReadOptions &options)
       requires(ReadableWithOptions<T> && HasEBMLID<T>)
     {
-      return std::make_pair(T::ID, [&member](BitReader &reader, const ReadOptions &options) {
-        T obj{};
-        obj.read(reader, options);
-        member = std::move(obj);
-      });
+      T obj{};
+      obj.read(reader, options);
+      member = std::move(obj);
     }
 
     template <typename T>
-    std::pair<ElementId, std::function<void(BitReader &, const ReadOptions &)>> wrapMemberReader(std::vector<T> &member)
+    void readMemberElement(std::vector<T> &member, BitReader &reader, const ReadOptions &options)
       requires(ReadableWithOptions<T> && HasEBMLID<T>)
+    {
+      T obj{};
+      obj.read(reader, options);
+      member.push_back(std::move(obj));
+    }
+
+    template <typename T>
+    std::pair<ElementId, std::function<void(BitReader &, const ReadOptions &)>> wrapMemberReader(T &member)
+      requires(ReadableMember<T>)
+    {
+      return std::make_pair(member_element_t<T>::ID, [&member](BitReader &reader, const ReadOptions &options) {
+        readMemberElement(member, reader, options);
+      });
+    }
+
+    template <typename T>
+    std::pair<ElementId, std::function<ChunkedReader(BitReader &, const ReadOptions &)>>
+    wrapChunkedMemberReader(std::vector<T> &member)
+      requires(HasEBMLID<T> && requires(T obj, BitReader reader, const ReadOptions &options) {
+        { obj.readChunked(reader, options) } -> std::same_as<ChunkedReader>;
+      })
     {
       return std::make_pair(T::ID, [&member](BitReader &reader, const ReadOptions &options) {
-        T obj{};
-        obj.read(reader, options);
-        member.push_back(std::move(obj));
+        return member.emplace_back().readChunked(reader, options);
       });
     }
 
+    /**
+     * Reads the Master Element with the given ID from the given bit reader and reads all its given members.
+     *
+     * The variadic template parameters whould be references to the members themselves.
+     *
+     * The members are looked up by comparing against the compile-time Element IDs of the member types, without
+     * allocating any memory.
+     *
+     * See the overload taking a map of member readers for the terminatingElementIds parameter.
+     */
+    template <typename... Types>
+    void readMasterElement(BitReader &reader, ElementId id, MasterElement &master, const ReadOptions &options,
+                           std::span<const ElementId> terminatingElementIds, Types &...members)
+      requires(ReadableMember<Types> && ...)
+    {
+      using Members = std::tuple<Types &...>;
+      Members memberRefs{members...};
+      MemberReader readMember{[](void *context, ElementId memberId, BitReader &r, const ReadOptions &o) {
+                                return std::apply(
+                                    [&](auto &...member) {
+                                      return ((memberId == member_element_t<decltype(member)>::ID &&
+                                               (readMemberElement(member, r, o), true)) ||
+                                              ...);
+                                    },
+                                    *static_cast<Members *>(context));
+                              },
+                              &memberRefs};
+      readMasterElement(reader, id, master, options, readMember, terminatingElementIds);
+    }
+
     /**
      * Reads the Master Element with the given ID from the given bit reader and reads all its given members.
      *
@@ -693,8 +1219,10 @@ namespace bml::ebml {
      */
     template <typename... Types>
     void readMasterElement(BitReader &reader, ElementId id, MasterElement &master, const ReadOptions &options,
-                           Types &...members) {
-      return readMasterElement(reader, id, master, options, {wrapMemberReader(members)...});
+                           Types &...members)
+      requires(ReadableMember<Types> && ...)
+    {
+      readMasterElement(reader, id, master, options, std::span<const ElementId>{}, members...);
     }
 
     template <typename T>
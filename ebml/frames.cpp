@@ -5,6 +5,7 @@
 #include "mkv_frames.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <limits>
 
 namespace bml::ebml::mkv {
@@ -17,6 +18,10 @@ namespace bml::ebml::mkv {
   static_assert(!std::ranges::borrowed_range<FillDataRangeView<FrameView, std::reference_wrapper<std::istream>>>);
   static_assert(std::ranges::view<FillDataRangeView<FrameView, std::reference_wrapper<std::istream>>>);
 
+  static_assert(std::ranges::input_range<BufferedFillDataRangeView<FrameView>>);
+  static_assert(!std::ranges::borrowed_range<BufferedFillDataRangeView<FrameView>>);
+  static_assert(std::ranges::view<BufferedFillDataRangeView<FrameView>>);
+
   static void advanceToNextBlockForTrack(std::span<const Cluster> &clusters,
                                          detail::BaseBlockElement const *&currentBlock, uint32_t trackNumber) noexcept;
   static void advanceToFirstBlockForTrack(std::span<const Cluster> &clusters,
@@ -27,13 +32,33 @@ namespace bml::ebml::mkv {
   FrameView::Iterator::Iterator(std::span<const Cluster> clusters, uint32_t trackNum, const TrackTimescale &scale,
                                 const TrackTimestamp<> &start) noexcept
       : pendingClusters(clusters), currentBlock(nullptr), timescale(scale), trackNumber(trackNum), currentLaceIndex(0) {
-    static_assert(sizeof(FrameView::Iterator) <= 5 * sizeof(std::size_t));
+    static_assert(sizeof(FrameView::Iterator) <= 9 * sizeof(std::size_t));
     static_assert(std::input_iterator<FrameView::Iterator>);
     static_assert(std::sentinel_for<Sentinel, Iterator>);
 
     advanceToFirstBlockForTrack(pendingClusters, currentBlock, trackNumber, start, scale);
   }
 
+  FrameView::Iterator::Iterator(ClusterCache &clusters, uint32_t trackNum, const TrackTimescale &scale,
+                                const TrackTimestamp<> &start)
+      : pendingClusters(), currentBlock(nullptr), timescale(scale), trackNumber(trackNum), currentLaceIndex(0),
+        cache(&clusters) {
+    if (start.value != 0) {
+      // Only read the Clusters starting with the last one with a timestamp smaller than the target, see
+      // advanceToFirstBlockForTrack()
+      const auto descriptors = clusters.descriptors();
+      auto it = std::lower_bound(
+          descriptors.begin(), descriptors.end(), start * scale,
+          [](const ClusterDescriptor &cluster, const SegmentTimestamp<> &time) { return cluster.timestamp < time; });
+      it = it != descriptors.begin() ? it - 1 : it;
+      nextClusterIndex = static_cast<std::size_t>(std::distance(descriptors.begin(), it));
+    }
+
+    while (pendingClusters.empty() && loadNextCluster()) {
+      advanceToFirstBlockForTrack(pendingClusters, currentBlock, trackNumber, start, scale);
+    }
+  }
+
   static TrackTimestamp<> getBlockTimestamp(const Cluster &cluster, const detail::BaseBlockElement &block,
                                             const TrackTimescale &scale) noexcept {
     auto timestampValue = static_cast<intmax_t>((cluster.timestamp.get() / scale).value) + block.header.timestampOffset;
@@ -51,7 +76,7 @@ namespace bml::ebml::mkv {
     }
 
     auto range = currentBlock->frameDataRanges.at(currentLaceIndex).borrow();
-    return {timestamp, range};
+    return {timestamp, range, trackNumber};
   }
 
   bool FrameView::Iterator::operator==(const Iterator &other) const noexcept {
@@ -59,49 +84,323 @@ namespace bml::ebml::mkv {
            pendingClusters.data() == other.pendingClusters.data() && currentBlock == other.currentBlock;
   }
 
-  void FrameView::Iterator::advance() noexcept {
+  void FrameView::Iterator::advance() {
     if (!pendingClusters.empty() && !(currentBlock && advanceToNextLaceIndex(*currentBlock, currentLaceIndex))) {
       currentLaceIndex = 0;
       advanceToNextBlockForTrack(pendingClusters, currentBlock, trackNumber);
+      while (pendingClusters.empty() && loadNextCluster()) {
+        advanceToNextBlockForTrack(pendingClusters, currentBlock, trackNumber);
+      }
+    }
+  }
+
+  bool FrameView::Iterator::loadNextCluster() {
+    if (!cache || nextClusterIndex >= cache->size()) {
+      currentCluster.reset();
+      return false;
+    }
+    currentCluster = cache->get(nextClusterIndex++);
+    pendingClusters = std::span{currentCluster.get(), 1};
+    return true;
+  }
+
+  std::vector<FrameView> FrameView::split(std::size_t numParts) const {
+    if (clusterCache || clusters.empty() || numParts <= 1) {
+      return {*this};
+    }
+
+    // Skip all Clusters before the one containing the first Frame
+    auto remaining = clusters;
+    const detail::BaseBlockElement *firstBlock = nullptr;
+    advanceToFirstBlockForTrack(remaining, firstBlock, trackNumber, startTime, timescale);
+    if (!firstBlock) {
+      return {*this};
+    }
+
+    numParts = std::min(numParts, remaining.size());
+    std::vector<FrameView> parts{};
+    parts.reserve(numParts);
+    for (std::size_t i = 0; i < numParts; ++i) {
+      const auto numClusters = remaining.size() / (numParts - i);
+      // Only the first part needs to search for the start Frame (again), all following Frames of the Track are part of
+      // this view anyway
+      parts.emplace_back(remaining.first(numClusters), trackNumber, timescale,
+                         i == 0 ? startTime : TrackTimestamp<>{});
+      remaining = remaining.subspan(numClusters);
+    }
+    return parts;
+  }
+
+  /**
+   * Returns whether the given Block of the given Cluster is a keyframe, i.e. a SimpleBlock with the keyframe flag set
+   * or a BlockGroup without any ReferenceBlocks.
+   */
+  static bool isKeyframeBlock(const Cluster &cluster, const detail::BaseBlockElement &block) noexcept {
+    const std::less<const void *> less{};
+    const std::span<const SimpleBlock> simpleBlocks{cluster.simpleBlocks};
+    if (!simpleBlocks.empty() && !less(&block, simpleBlocks.data()) &&
+        less(&block, simpleBlocks.data() + simpleBlocks.size())) {
+      return block.header.keyframe;
+    }
+    const auto isGroupOfBlock = [&block](const BlockGroup &group) { return &group.block == &block; };
+    // The BlockGroups are ordered by their timestamps (see findNextBlock()), so start searching at the timestamp
+    auto it = std::lower_bound(cluster.blockGroups.begin(), cluster.blockGroups.end(), block.header.timestampOffset,
+                               [](const BlockGroup &group, int16_t offset) {
+                                 return group.block.header.timestampOffset < offset;
+                               });
+    it = std::find_if(it, cluster.blockGroups.end(), isGroupOfBlock);
+    if (it == cluster.blockGroups.end()) [[unlikely]] {
+      it = std::find_if(cluster.blockGroups.begin(), cluster.blockGroups.end(), isGroupOfBlock);
+    }
+    return it != cluster.blockGroups.end() && it->referenceBlocks.empty();
+  }
+
+  FrameIndex::FrameIndex(std::span<const Cluster> clusters, uint32_t track, const TrackTimescale &scale)
+      : timescale(scale), trackNumber(track) {
+    clusterTimestamps.reserve(clusters.size());
+    clusterFrames.reserve(clusters.size());
+    for (std::size_t i = 0; i < clusters.size(); ++i) {
+      const auto &cluster = clusters[i];
+      clusterTimestamps.push_back(cluster.timestamp.get().value);
+      clusterFrames.push_back(timestamps.size());
+
+      // Only process the current Cluster, advancing to the next Block empties the span at the end of the Cluster
+      auto pendingClusters = clusters.subspan(i, 1);
+      const detail::BaseBlockElement *block = nullptr;
+      advanceToNextBlockForTrack(pendingClusters, block, trackNumber);
+      while (!pendingClusters.empty() && block) {
+        const auto blockTimestamp = getBlockTimestamp(cluster, *block, timescale).value;
+        const auto keyframe = static_cast<uint8_t>(isKeyframeBlock(cluster, *block));
+        for (std::size_t lace = 0; lace < block->frameDataRanges.size(); ++lace) {
+          timestamps.push_back(blockTimestamp);
+          frameData.push_back(&block->frameDataRanges[lace]);
+          laceIndices.push_back(static_cast<uint8_t>(lace));
+          keyframes.push_back(keyframe);
+        }
+        advanceToNextBlockForTrack(pendingClusters, block, trackNumber);
+      }
+    }
+  }
+
+  Frame FrameIndex::operator[](std::size_t index) const noexcept {
+    std::optional<TrackTimestamp<>> timestamp{};
+    if (laceIndices[index] == 0) {
+      timestamp = TrackTimestamp<>{timestamps[index]};
+    }
+    return {timestamp, frameData[index]->borrow(), trackNumber};
+  }
+
+  std::size_t FrameIndex::lowerBound(const TrackTimestamp<> &start) const noexcept {
+    // Same as advanceToFirstBlockForTrack(), start with the last Cluster with a timestamp smaller than the target
+    auto it = std::lower_bound(clusterTimestamps.begin(), clusterTimestamps.end(), (start * timescale).value);
+    it = it != clusterTimestamps.begin() ? it - 1 : it;
+    if (it == clusterTimestamps.end()) {
+      return size();
+    }
+    auto index = clusterFrames[static_cast<std::size_t>(std::distance(clusterTimestamps.begin(), it))];
+    while (index < size() && timestamps[index] < start.value) {
+      ++index;
+    }
+    return index;
+  }
+
+  std::optional<std::size_t> FrameIndex::findKeyframe(const TrackTimestamp<> &time) const noexcept {
+    for (auto index = std::min(lowerBound(time) + 1U, size()); index > 0; --index) {
+      if (keyframes[index - 1U] && timestamps[index - 1U] <= time.value) {
+        return index - 1U;
+      }
+    }
+    return {};
+  }
+
+  FrameStream::~FrameStream() {
+    if (handle) {
+      handle.destroy();
+    }
+  }
+
+  FrameStream::operator bool() { return handle && !handle.done(); }
+
+  std::optional<Frame> FrameStream::operator()() {
+    // Skip any resumption not producing a Frame, e.g. the initial lazy suspension or reading of metadata Elements
+    while (handle && !handle.done() && !handle.promise().frame) {
+      handle.resume();
+    }
+    if (!handle) {
+      return {};
     }
+    if (handle.promise().error) {
+      std::rethrow_exception(handle.promise().error);
+    }
+    return std::exchange(handle.promise().frame, std::nullopt);
   }
 
-  static DataRange readDataRange(BitReader &reader, ByteRange range, bool copyFrameData) {
-    if (copyFrameData) {
+  /**
+   * Reads the data of the Frames of a single Block as configured by the ReadOptions.
+   */
+  struct FrameDataReader {
+    DataRange read(BitReader &reader, ByteRange range) {
+      if (!copyFrameData) {
+        reader.skip(range.size);
+        return range;
+      }
+      if (frameDataResource) {
+        // The memory is owned by the resource and released with it, so the Frame only borrows it
+        std::span tmp{static_cast<std::byte *>(frameDataResource->allocate(range.size.num, alignof(std::byte))),
+                      range.size.num};
+        reader.readBytesInto(tmp);
+        return std::span<const std::byte>{tmp};
+      }
+      if (shareFrameData) {
+        if (!sharedChunk) {
+          // All Frames are stored consecutively up to the end of the Block, so they all fit into a single chunk
+          sharedChunkOffset = range.offset;
+          sharedChunk.reset(new std::byte[(blockDataEnd - range.offset).num]);
+        }
+        auto *start = sharedChunk.get() + (range.offset - sharedChunkOffset).num;
+        reader.readBytesInto(std::span{start, range.size.num});
+        return DataRange{std::shared_ptr<const std::byte>{sharedChunk, start}, range.size.num};
+      }
       std::vector<std::byte> tmp(range.size.num);
       reader.readBytesInto(tmp);
       return tmp;
     }
-    reader.skip(range.size);
-    return range;
-  }
+
+    bool copyFrameData;
+    bool shareFrameData;
+    std::pmr::memory_resource *frameDataResource;
+    ByteCount blockDataEnd;
+    std::shared_ptr<std::byte[]> sharedChunk{};
+    ByteCount sharedChunkOffset{};
+  };
 
   static std::vector<DataRange> readFixedSizeFrameRanges(BitReader &reader, std::size_t numFrames,
-                                                         const ByteRange &dataRange, bool copyFrameData) {
+                                                         const ByteRange &dataRange, FrameDataReader &frameData) {
     auto frameSize = dataRange.size / numFrames;
     std::vector<DataRange> frames{};
     frames.reserve(numFrames);
     for (std::size_t i = 0; i < numFrames; ++i) {
-      frames.push_back(readDataRange(reader, dataRange.subRange(i * frameSize, frameSize), copyFrameData));
+      frames.push_back(frameData.read(reader, dataRange.subRange(i * frameSize, frameSize)));
     }
     return frames;
   }
 
-  static std::vector<DataRange> extractFrameRanges(BitReader &reader, const std::vector<std::size_t> &frameSizesMinus1,
-                                                   ByteRange dataRange, bool copyFrameData) {
-    std::vector<DataRange> frames{};
-    frames.reserve(frameSizesMinus1.size() + 1U);
-    for (auto size : frameSizesMinus1) {
-      frames.push_back(readDataRange(reader, dataRange.subRange(0_bytes, ByteCount{size}), copyFrameData));
-      dataRange = dataRange.subRange(ByteCount{size});
+  /**
+   * Accesses the lace header bytes by reading them from the BitReader.
+   */
+  class ReaderLaceHeader {
+  public:
+    explicit ReaderLaceHeader(BitReader &reader) noexcept : reader(reader), start(reader.position()) {}
+
+    uint8_t readByte() { return reader.readBytes<uint8_t>(1_bytes); }
+
+    std::size_t readXiphSize() {
+      std::size_t value = 0;
+
+      while (reader.hasMoreBytes()) {
+        auto tmp = reader.readBytes(1_bytes);
+        value += tmp;
+        if (tmp != 0xFF) {
+          break;
+        }
+      }
+      return value;
+    }
+
+    std::pair<uintmax_t, BitCount> readVariableSizeInteger() {
+      return ebml::detail::readVariableSizeInteger(reader, false);
+    }
+
+    ByteCount finish() { return (reader.position() - start).divide<8>(); }
+
+  private:
+    BitReader &reader;
+    BitCount start;
+  };
+
+  /**
+   * Directly accesses the lace header bytes in the in-memory Block data and skips them in the BitReader when done.
+   */
+  class MemoryLaceHeader {
+  public:
+    MemoryLaceHeader(BitReader &reader, std::span<const std::byte> data) noexcept : reader(reader), bytes(data) {}
+
+    uint8_t readByte() {
+      if (offset >= bytes.size()) {
+        throw EndOfStreamError("Cannot read more bytes, end of input reached");
+      }
+      return static_cast<uint8_t>(bytes[offset++]);
+    }
+
+    std::size_t readXiphSize() {
+      std::size_t value = 0;
+      // Skip whole words of 0xFF bytes at once
+      while (offset + sizeof(uint64_t) <= bytes.size() &&
+             loadBigEndian<uint64_t>(bytes.data() + offset) == std::numeric_limits<uint64_t>::max()) {
+        value += sizeof(uint64_t) * 0xFFU;
+        offset += sizeof(uint64_t);
+      }
+      while (offset < bytes.size()) {
+        auto tmp = static_cast<uint8_t>(bytes[offset++]);
+        value += tmp;
+        if (tmp != 0xFF) {
+          break;
+        }
+      }
+      return value;
+    }
+
+    std::pair<uintmax_t, BitCount> readVariableSizeInteger() {
+      auto prefix = readByte();
+      auto numBytes = static_cast<uint32_t>(std::countl_zero(prefix) + 1 /* 1 bit */);
+      if (numBytes > sizeof(uint64_t)) {
+        throw std::invalid_argument("Invalid EBML lace size prefix: " + toHexString(prefix));
+      }
+      BitCount numBits = ByteCount{numBytes} - BitCount{numBytes};
+      uintmax_t value = prefix;
+      if (numBytes > 1U && offset + sizeof(uint64_t) <= bytes.size()) {
+        // Load all remaining bytes at once instead of byte-wise
+        auto numRemainingBits = (numBytes - 1U) * 8U;
+        value = (value << numRemainingBits) |
+                (loadBigEndian<uint64_t>(bytes.data() + offset) >> (sizeof(uint64_t) * 8U - numRemainingBits));
+        offset += numBytes - 1U;
+      } else {
+        for (uint32_t i = 1; i < numBytes; ++i) {
+          value = (value << 8U) | readByte();
+        }
+      }
+      return std::make_pair(value & numBits.mask(), numBits);
+    }
+
+    ByteCount finish() {
+      reader.skip(ByteCount{offset});
+      return ByteCount{offset};
+    }
+
+  private:
+    BitReader &reader;
+    std::span<const std::byte> bytes;
+    std::size_t offset = 0;
+  };
+
+  /**
+   * Decodes the lace sizes of all but the last Frame and stores them as (relative) byte ranges.
+   */
+  template <typename LaceHeader>
+  static void readXiphLaceSizes(LaceHeader &laceHeader, std::vector<DataRange> &frames, uint32_t numFramesMinus1) {
+    for (uint32_t i = 0; i < numFramesMinus1; ++i) {
+      frames.emplace_back(ByteRange{0_bytes, ByteCount{laceHeader.readXiphSize()}});
     }
-    frames.push_back(readDataRange(reader, dataRange, copyFrameData));
-    return frames;
   }
 
-  static std::vector<DataRange> readEBMLFrameRanges(BitReader &reader, const ByteRange &dataRange, bool copyFrameData) {
-    auto start = reader.position();
-    auto numFramesMinus1 = reader.readBytes<uint8_t>(1_bytes);
+  /**
+   * Decodes the lace sizes of all but the last Frame and stores them as (relative) byte ranges.
+   */
+  template <typename LaceHeader>
+  static void readEBMLLaceSizes(LaceHeader &laceHeader, std::vector<DataRange> &frames, uint32_t numFramesMinus1) {
+    if (numFramesMinus1 == 0) {
+      return;
+    }
 
     /*
      * "The first frame size is encoded as an EBML Variable-Size Integer value [...]. The remaining frame sizes are
@@ -109,58 +408,57 @@ namespace bml::ebml::mkv {
      * values are encoded as VINT, with a mapping from signed to unsigned numbers. Decoding the unsigned number stored
      * in the VINT to a signed number is done by subtracting 2^((7*n)-1)^-1, where n is the octet size of the VINT."
      */
-    std::vector<std::size_t> frameSizesMinus1{};
-    frameSizesMinus1.reserve(numFramesMinus1);
-    frameSizesMinus1.push_back(static_cast<std::size_t>(ebml::detail::readVariableSizeInteger(reader, false).first));
-    for (uint32_t i = 0; i < (numFramesMinus1 - 1U); ++i) {
-      auto [val, numBits] = ebml::detail::readVariableSizeInteger(reader, false);
-      auto difference = static_cast<intmax_t>(val) - ((1LL << (numBits - 1_bits)) - 1);
-      frameSizesMinus1.push_back(static_cast<std::size_t>(static_cast<intmax_t>(frameSizesMinus1.back()) + difference));
+    auto size = static_cast<intmax_t>(laceHeader.readVariableSizeInteger().first);
+    frames.emplace_back(ByteRange{0_bytes, ByteCount{static_cast<std::size_t>(size)}});
+    for (uint32_t i = 1; i < numFramesMinus1; ++i) {
+      auto [val, numBits] = laceHeader.readVariableSizeInteger();
+      size += static_cast<intmax_t>(val) - ((1LL << (numBits - 1_bits)) - 1);
+      frames.emplace_back(ByteRange{0_bytes, ByteCount{static_cast<std::size_t>(size)}});
     }
-
-    auto remainingRange = dataRange.subRange((reader.position() - start).divide<8>());
-    return extractFrameRanges(reader, frameSizesMinus1, remainingRange, copyFrameData);
   }
 
-  static std::size_t readXiphSize(BitReader &reader) {
-    std::size_t value = 0;
-
-    while (reader.hasMoreBytes()) {
-      auto tmp = reader.readBytes(1_bytes);
-      value += tmp;
-      if (tmp != 0xFF) {
-        break;
-      }
+  template <typename LaceHeader>
+  static std::vector<DataRange> readLacedFrameRanges(BitReader &reader, LaceHeader laceHeader,
+                                                     BlockHeader::Lacing lacing, const ByteRange &dataRange,
+                                                     FrameDataReader &frameData) {
+    auto numFramesMinus1 = laceHeader.readByte();
+    std::vector<DataRange> frames{};
+    frames.reserve(numFramesMinus1 + 1U);
+    if (lacing == BlockHeader::Lacing::XIPH) {
+      readXiphLaceSizes(laceHeader, frames, numFramesMinus1);
+    } else {
+      readEBMLLaceSizes(laceHeader, frames, numFramesMinus1);
     }
-    return value;
-  }
-
-  static std::vector<DataRange> readXiphFrameRanges(BitReader &reader, const ByteRange &dataRange, bool copyFrameData) {
-    auto start = reader.position();
-    auto numFramesMinus1 = reader.readBytes<uint8_t>(1_bytes);
-
-    std::vector<std::size_t> frameSizesMinus1{};
-    frameSizesMinus1.reserve(numFramesMinus1);
-    for (uint32_t i = 0; i < numFramesMinus1; ++i) {
-      frameSizesMinus1.push_back(readXiphSize(reader));
+    frames.emplace_back();
+
+    // Fill the Frame ranges in-place, the Frame data directly follows the lace header
+    auto remainingRange = dataRange.subRange(laceHeader.finish());
+    for (std::size_t i = 0; i < numFramesMinus1; ++i) {
+      auto size = frames[i].numBytes();
+      frames[i] = frameData.read(reader, remainingRange.subRange(0_bytes, size));
+      remainingRange = remainingRange.subRange(size);
     }
-
-    auto remainingRange = dataRange.subRange((reader.position() - start).divide<8>());
-    return extractFrameRanges(reader, frameSizesMinus1, remainingRange, copyFrameData);
+    frames.back() = frameData.read(reader, remainingRange);
+    return frames;
   }
 
   std::vector<DataRange> readFrameRanges(BitReader &reader, const BlockHeader &header, const ByteRange &dataRange,
-                                         bool copyFrameData) {
+                                         const ReadOptions &options) {
+    FrameDataReader frameData{options.readMediaData && options.mediaDataSource.empty(), options.shareMediaData,
+                              options.frameDataResource, dataRange.offset + dataRange.size};
     switch (header.lacing) {
     case BlockHeader::Lacing::NONE:
-      return readFixedSizeFrameRanges(reader, 1U, dataRange, copyFrameData);
+      return readFixedSizeFrameRanges(reader, 1U, dataRange, frameData);
     case BlockHeader::Lacing::FIXED_SIZE:
       return readFixedSizeFrameRanges(reader, 1U + reader.readBytes<uint8_t>(1_bytes), dataRange.subRange(1_bytes),
-                                      copyFrameData);
+                                      frameData);
     case BlockHeader::Lacing::EBML:
-      return readEBMLFrameRanges(reader, dataRange, copyFrameData);
     case BlockHeader::Lacing::XIPH:
-      return readXiphFrameRanges(reader, dataRange, copyFrameData);
+      if (auto blockData = dataRange.applyTo(options.mediaDataSource); !blockData.empty()) {
+        // Directly decode the lace sizes from the in-memory data without going through the BitReader
+        return readLacedFrameRanges(reader, MemoryLaceHeader{reader, blockData}, header.lacing, dataRange, frameData);
+      }
+      return readLacedFrameRanges(reader, ReaderLaceHeader{reader}, header.lacing, dataRange, frameData);
     }
     throw std::runtime_error{"Unknown MKV Block header lacing type: " +
                              std::to_string(static_cast<uint32_t>(header.lacing.get()))};
@@ -2,9 +2,16 @@
 
 #include "ebml.hpp"
 #include "mkv.hpp"
+#include "mkv_frames.hpp"
 
+#include "errors.hpp"
+
+#include <algorithm>
+#include <chrono>
 #include <coroutine>
 #include <optional>
+#include <stdexcept>
+#include <type_traits>
 
 namespace bml::ebml {
   class ChunkedReader::promise_type {
@@ -27,30 +34,175 @@ namespace bml::ebml {
       return {};
     }
 
+    /**
+     * Suspends the chunked reader due to the given number of bytes missing in the input data to continue reading.
+     */
+    std::suspend_always yield_value(ByteCount numMissingBytes) noexcept {
+      lastId.reset();
+      missingBytes = numMissingBytes;
+      return {};
+    }
+
     std::optional<ElementId> lastId;
+    ByteCount missingBytes{};
     std::exception_ptr error;
   };
 
+  /**
+   * Writes the Element with the given ID and the content written by the given function.
+   *
+   * The content size is determined up front by writing the content to a discarding writer, which allows to write the
+   * Element header and content directly to the given writer without buffering the content.
+   *
+   * NOTE: The given function is invoked twice and needs to write the same data on both invocations!
+   */
   template <typename Func = void (*)(BitWriter &)>
-  void writeElement(BitWriter &writer, ElementId id, Func &&writeContent,
-                    std::size_t estimatedSize = sizeof(uintmax_t)) {
-    std::vector<std::byte> buffer{};
-    buffer.reserve(estimatedSize);
-    BitWriter bufWriter{buffer, BitWriter::GROW};
-    writeContent(bufWriter);
-    bufWriter.flush();
-
-    detail::writeElementHeader(writer, id, ByteCount{buffer.size()});
-    writer.writeBytes(buffer);
+  void writeElement(BitWriter &writer, ElementId id, Func &&writeContent) {
+    BitWriter sizeWriter{BitWriter::DISCARD};
+    writeContent(sizeWriter);
+    sizeWriter.flush();
+    const auto contentSize = sizeWriter.position().divide<8>();
+
+    detail::writeElementHeader(writer, id, contentSize);
+    const auto start = writer.position();
+    writeContent(writer);
+    writer.fillToAligment(1_bytes, false);
+    if (writer.position() - start != BitCount{contentSize}) [[unlikely]] {
+      throw std::logic_error("Element content size does not match size determined before writing");
+    }
   }
 
   namespace detail {
-    BitReader &getUnderlyingReader(BitReader &reader);
+    /**
+     * Returns the number of bytes required to read the next Element completely, without consuming any input.
+     *
+     * If the Element header cannot be read completely, a lower bound is returned.
+     */
+    ByteCount requiredElementBytes(BitReader &reader);
+
+    /**
+     * Invokes the given function to read an Element and returns the number of bytes missing if the given reader runs
+     * out of input data while reading, in which case the reader is reset to the start of the Element.
+     *
+     * If reading is not resumable, any error is propagated. Returns zero if the Element was read successfully.
+     */
+    template <typename Func>
+    ByteCount readResumable(BitReader &reader, bool resumable, Func &&readElement) {
+      if (!resumable) {
+        readElement();
+        return 0_bytes;
+      }
+      const auto start = reader.position();
+      try {
+        readElement();
+        return 0_bytes;
+      } catch (const EndOfStreamError &) {
+        reader.seek(start);
+      }
+      return std::max(requiredElementBytes(reader), 1_bytes);
+    }
+
+    /**
+     * Returns whether the member Element with the given ID is excluded from reading, see ReadOptions#skipElements.
+     */
+    inline bool isSkippedElement(const ReadOptions &options, ElementId id) noexcept {
+      return std::ranges::find(options.skipElements, id) != options.skipElements.end();
+    }
+
+    /**
+     * Skips the member Element with the given ID excluded from reading via the ReadOptions#skipElements filter and
+     * records it in the given statistics (if any).
+     *
+     * The terminating Element IDs are the ones of the parent Master Element and are only required for skipping member
+     * Elements with Unknown Data Size.
+     */
+    void skipFilteredMember(BitReader &reader, ElementId memberId, std::span<const ElementId> terminatingElementIds,
+                            ReadStatistics *statistics);
+
+    /**
+     * Helper for recording the number of bytes read and the time spent for reading a single Element into the
+     * ReadOptions#statistics.
+     *
+     * If no statistics are collected, this only costs a single check for the statistics object.
+     */
+    class ElementRecorder {
+      using clock = std::chrono::steady_clock;
+
+    public:
+      ElementRecorder(const ReadOptions &options, BitReader &reader) noexcept
+          : statistics(options.statistics), reader(reader), start(statistics ? reader.position() : 0_bits) {}
+
+      /**
+       * Invokes the given function (reading the Element or a part of it) and accumulates the time spent, if
+       * measuring is enabled.
+       */
+      template <typename Func>
+      decltype(auto) measure(Func &&func) {
+        if (!statistics || !statistics->measureTime) [[likely]] {
+          return func();
+        }
+        const auto startTime = clock::now();
+        if constexpr (std::is_void_v<decltype(func())>) {
+          func();
+          duration += clock::now() - startTime;
+        } else {
+          auto result = func();
+          duration += clock::now() - startTime;
+          return result;
+        }
+      }
+
+      /**
+       * Records the Element with the given ID as read from the position of the reader at construction of this object
+       * to its current position.
+       */
+      void record(ElementId id) {
+        if (statistics) [[unlikely]] {
+          statistics->record(id, (reader.position() - start).divide<8>(),
+                             std::chrono::duration_cast<std::chrono::nanoseconds>(duration));
+        }
+      }
+
+    private:
+      ReadStatistics *statistics;
+      BitReader &reader;
+      BitCount start;
+      clock::duration duration{};
+    };
   } // namespace detail
 
   namespace mkv {
+    class FrameStream::promise_type {
+    public:
+      FrameStream get_return_object() { return {std::coroutine_handle<promise_type>::from_promise(*this)}; }
+
+      // NOTE: See ChunkedReader::promise_type for the suspension behavior
+      std::suspend_never initial_suspend() noexcept { return {}; }
+      std::suspend_always final_suspend() noexcept { return {}; }
+      void unhandled_exception() { error = std::current_exception(); }
+
+      void return_void() noexcept { frame.reset(); }
+
+      std::suspend_always yield_value(std::optional<Frame> val) noexcept {
+        frame = std::move(val);
+        return {};
+      }
+
+      std::optional<Frame> frame;
+      std::exception_ptr error;
+    };
+
     std::vector<DataRange> readFrameRanges(BitReader &reader, const BlockHeader &header, const ByteRange &dataRange,
-                                           bool copyFrameData);
+                                           const ReadOptions &options);
     void writeFrameRanges(BitWriter &writer, const std::vector<DataRange> &frameRanges, BlockHeader::Lacing lacing);
+
+    /**
+     * Creates a SeekHead referencing the Elements with the given IDs at the given positions (in bytes relative to the
+     * Segment Data).
+     *
+     * NOTE: The positions are passed as plain numbers, since containers of ByteCount do not satisfy the iterator
+     * concepts of some standard library versions.
+     */
+    SeekHead createSeekHead(std::span<const std::pair<ElementId, uintmax_t>> positions);
   } // namespace mkv
 } // namespace bml::ebml
@@ -1,11 +1,21 @@
 
 #include "mkv.hpp"
 
+#include "debug.hpp"
 #include "internal.hpp"
 #include "mkv_frames.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
 #include <format>
+#include <limits>
+#include <map>
+#include <memory_resource>
+#include <mutex>
+#include <set>
+#include <thread>
 
 namespace bml::ebml::mkv {
   void BlockHeader::read(bml::BitReader &reader, const ReadOptions & /* options */) {
@@ -70,23 +80,24 @@ namespace bml::ebml::mkv {
       header.read(reader);
       auto dataSize = (endPos - reader.position()).divide<8>();
 
-      auto blockDataOffset = bml::ebml::detail::getUnderlyingReader(reader).position().divide<8>();
-      frameDataRanges = readFrameRanges(reader, header, {blockDataOffset, dataSize}, options.readMediaData);
+      auto blockDataOffset = bml::detail::BaseReaderAccess::baseReader(reader).position().divide<8>();
+      frameDataRanges = readFrameRanges(reader, header, {blockDataOffset, dataSize}, options);
+      if (options.statistics) [[unlikely]] {
+        options.statistics->numFrames += frameDataRanges.size();
+      }
+      if (!options.mediaDataSource.empty()) {
+        for (auto &range : frameDataRanges) {
+          fillDataRange(range, options.mediaDataSource, DataRange::Mode::BORROWED);
+        }
+      }
       reader.skip(endPos - reader.position());
     }
 
     void BaseBlockElement::writeValue(BitWriter &writer, ElementId id) const {
-      auto estimatedSize =
-          std::accumulate(frameDataRanges.begin(), frameDataRanges.end(), header.numBits(),
-                          [](ByteCount sum, const DataRange &range) { return sum + range.numBytes(); });
-
-      writeElement(
-          writer, id,
-          [this](BitWriter &w) {
-            header.write(w);
-            writeFrameRanges(w, frameDataRanges, header.lacing);
-          },
-          estimatedSize.num);
+      writeElement(writer, id, [this](BitWriter &w) {
+        header.write(w);
+        writeFrameRanges(w, frameDataRanges, header.lacing);
+      });
     }
 
     std::ostream &BaseBlockElement::printYAML(std::ostream &os, const bml::yaml::Options &options) const {
@@ -103,10 +114,11 @@ namespace bml::ebml::mkv {
   } // namespace detail
 
   void Segment::read(bml::BitReader &reader, const ReadOptions &options) {
-    auto readMember = readChunked(reader, options);
-    while (readMember) {
-      readMember();
-    }
+    using namespace bml::ebml::detail;
+    // Reads all members (including the Clusters) directly without the overhead of the (resumable) chunked reading
+    static constexpr std::array TERMINATING_IDS{EBMLHeader::ID, Segment::ID};
+    readMasterElement(reader, ID, *this, options, TERMINATING_IDS, crc32, seekHeads, info, tracks, cues, chapters,
+                      clusters, attachments, tags, voidElements);
   }
 
   ChunkedReader Segment::readChunked(bml::BitReader &reader, ReadOptions options) & {
@@ -114,9 +126,207 @@ namespace bml::ebml::mkv {
     return readMasterElementChunked(reader, ID, *this, options,
                                     {wrapMemberReader(crc32), wrapMemberReader(seekHeads), wrapMemberReader(info),
                                      wrapMemberReader(tracks), wrapMemberReader(cues), wrapMemberReader(chapters),
-                                     wrapMemberReader(clusters), wrapMemberReader(attachments), wrapMemberReader(tags),
+                                     wrapMemberReader(attachments), wrapMemberReader(tags),
                                      wrapMemberReader(voidElements)},
-                                    {EBMLHeader::ID, Segment::ID});
+                                    {EBMLHeader::ID, Segment::ID}, {wrapChunkedMemberReader(clusters)});
+  }
+
+  static ElementId toElementId(const std::vector<std::byte> &idBytes) noexcept {
+    return static_cast<ElementId>(std::accumulate(idBytes.begin(), idBytes.end(), std::uintmax_t{0},
+                                                  [](std::uintmax_t id, std::byte b) {
+                                                    return (id << 8U) | static_cast<std::uintmax_t>(b);
+                                                  }));
+  }
+
+  BitCount Segment::readIndexed(bml::BitReader &reader, const ReadOptions &options) {
+    using namespace bml::ebml::detail;
+    if (!reader.isSeekable()) {
+      throw std::invalid_argument("Reading the Segment via its SeekHead requires a seekable input");
+    }
+
+    const auto segmentSize = readElementHeader(reader, ID);
+    const auto dataStart = reader.position();
+    const auto hasMoreMembers = [&]() {
+      return (segmentSize == UNKNOWN_SIZE && reader.hasMoreBytes()) || (reader.position() < dataStart + segmentSize);
+    };
+
+    std::map<ElementId, std::function<void(BitReader &, const ReadOptions &)>> memberReaders{
+        wrapMemberReader(crc32),       wrapMemberReader(seekHeads), wrapMemberReader(info),
+        wrapMemberReader(tracks),      wrapMemberReader(cues),      wrapMemberReader(chapters),
+        wrapMemberReader(attachments), wrapMemberReader(tags),      wrapMemberReader(voidElements)};
+    static constexpr std::array TERMINATING_IDS{EBMLHeader::ID, Segment::ID};
+    // Elements which can occur multiple times and therefore need to be read even if one instance is already present
+    const std::set<ElementId> repeatableMembers{SeekHead::ID, Tags::ID};
+    std::set<ElementId> membersRead{};
+    std::set<BitCount> positionsRead{};
+    const auto readMember = [&](ElementId memberId) {
+      auto pos = reader.position();
+      if (isSkippedElement(options, memberId)) [[unlikely]] {
+        skipFilteredMember(reader, memberId, TERMINATING_IDS, options.statistics);
+      } else if (auto it = memberReaders.find(memberId); it != memberReaders.end()) {
+        ElementRecorder recorder{options, reader};
+        recorder.measure([&]() { it->second(reader, options); });
+        recorder.record(memberId);
+        membersRead.insert(memberId);
+      } else {
+        skipElement(reader);
+      }
+      positionsRead.insert(pos);
+    };
+
+    // 1. Linearly read all Elements before the first Cluster, which usually includes the SeekHead, Info and Tracks
+    std::optional<BitCount> firstClusterPosition{};
+    while (hasMoreMembers()) {
+      auto memberId = peekElementId(reader);
+      if (memberId == Cluster::ID) {
+        firstClusterPosition = reader.position();
+        break;
+      } else if (segmentSize == UNKNOWN_SIZE && (memberId == EBMLHeader::ID || memberId == Segment::ID)) {
+        // end of Segment with unknown size
+        break;
+      }
+      readMember(memberId);
+    }
+    const auto continuePosition = reader.position();
+
+    if (seekHeads.empty()) {
+      // 2a. Without an index, read the remaining metadata Elements linearly, skipping all Clusters
+      while (hasMoreMembers()) {
+        auto memberId = peekElementId(reader);
+        if (memberId == Cluster::ID) {
+          Cluster::skip(reader);
+        } else if (segmentSize == UNKNOWN_SIZE && (memberId == EBMLHeader::ID || memberId == Segment::ID)) {
+          break;
+        } else {
+          readMember(memberId);
+        }
+      }
+    } else {
+      // 2b. Directly jump to all referenced metadata Elements not read yet. Following SeekHeads (referenced by the
+      // first SeekHead) add to the list of SeekHeads to process.
+      for (std::size_t i = 0; i < seekHeads.size(); ++i) {
+        const auto seeks = seekHeads[i].seeks;
+        for (const auto &seek : seeks) {
+          const auto seekId = toElementId(seek.seekID.get());
+          const auto seekPosition = dataStart + ByteCount{seek.seekPosition.get()};
+          if (seekId == CRC32::ID || !memberReaders.contains(seekId) || isSkippedElement(options, seekId) ||
+              positionsRead.contains(seekPosition) ||
+              (!repeatableMembers.contains(seekId) && membersRead.contains(seekId))) {
+            // Clusters are read on demand, other Elements are already read or excluded from reading
+            continue;
+          }
+          reader.seek(seekPosition);
+          if (auto actualId = peekElementId(reader); actualId != seekId) [[unlikely]] {
+            Debug::error("SeekHead references Element with ID '" + toHexString(static_cast<uintmax_t>(seekId)) +
+                         "' at " + ByteCount{seek.seekPosition.get()}.toString() + ", but found Element with ID '" +
+                         toHexString(static_cast<uintmax_t>(actualId)) + "', ignoring entry");
+            continue;
+          }
+          readMember(seekId);
+        }
+      }
+    }
+
+    reader.seek(firstClusterPosition.value_or(continuePosition));
+    return dataStart;
+  }
+
+  /**
+   * Memory resource forwarding all (de-)allocations to the given upstream resource while holding a lock. This allows
+   * to share a memory resource which is not thread-safe itself (e.g. a std::pmr::monotonic_buffer_resource) between
+   * multiple threads.
+   *
+   * NOTE: Other than a std::pmr::synchronized_pool_resource, this does not own any memory, so the allocated memory is
+   * still owned by and lives as long as the upstream resource.
+   */
+  class SynchronizedMemoryResource final : public std::pmr::memory_resource {
+  public:
+    explicit SynchronizedMemoryResource(std::pmr::memory_resource &resource) noexcept : upstream(resource) {}
+
+  private:
+    void *do_allocate(std::size_t numBytes, std::size_t alignment) override {
+      std::scoped_lock lock{mutex};
+      return upstream.allocate(numBytes, alignment);
+    }
+
+    void do_deallocate(void *ptr, std::size_t numBytes, std::size_t alignment) override {
+      std::scoped_lock lock{mutex};
+      upstream.deallocate(ptr, numBytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+  private:
+    std::pmr::memory_resource &upstream;
+    std::mutex mutex;
+  };
+
+  void Segment::readParallel(BitReader::ByteRange data, ByteCount offset, const ReadOptions &options,
+                             std::size_t numThreads) {
+    BitReader reader{data};
+    reader.seek(offset);
+    const auto dataStart = readIndexed(reader, options);
+    clusters.clear();
+    if (bml::ebml::detail::isSkippedElement(options, Cluster::ID)) {
+      return;
+    }
+    const auto descriptors = ClusterDescriptor::scan(reader, dataStart);
+    clusters.resize(descriptors.size());
+
+    if (!numThreads) {
+      numThreads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    numThreads = std::min(numThreads, descriptors.size());
+
+    std::atomic_size_t nextIndex{0};
+    std::vector<std::exception_ptr> errors(descriptors.size());
+    // The statistics are not synchronized, so collect them per thread
+    std::vector<ReadStatistics> statistics(options.statistics ? std::max(numThreads, std::size_t{1}) : 0U);
+    // The frame data memory resource is shared by all threads, but is not required to be thread-safe
+    std::optional<SynchronizedMemoryResource> frameDataResource{};
+    if (options.frameDataResource && numThreads > 1) {
+      frameDataResource.emplace(*options.frameDataResource);
+    }
+    const auto readClusters = [&](std::size_t threadIndex) {
+      BitReader clusterReader{data};
+      auto clusterOptions = options;
+      if (frameDataResource) {
+        clusterOptions.frameDataResource = &*frameDataResource;
+      }
+      if (options.statistics) {
+        statistics[threadIndex].measureTime = options.statistics->measureTime;
+        clusterOptions.statistics = &statistics[threadIndex];
+      }
+      for (auto index = nextIndex++; index < descriptors.size(); index = nextIndex++) {
+        try {
+          clusterReader.seek(dataStart + descriptors[index].position);
+          bml::ebml::detail::ElementRecorder recorder{clusterOptions, clusterReader};
+          recorder.measure([&]() { clusters[index].read(clusterReader, clusterOptions); });
+          recorder.record(Cluster::ID);
+        } catch (...) {
+          errors[index] = std::current_exception();
+        }
+      }
+    };
+
+    {
+      std::vector<std::jthread> workers{};
+      // The current thread is one of the workers
+      for (std::size_t i = 1; i < numThreads; ++i) {
+        workers.emplace_back(readClusters, i);
+      }
+      readClusters(0);
+    }
+
+    for (const auto &threadStatistics : statistics) {
+      *options.statistics += threadStatistics;
+    }
+
+    for (const auto &error : errors) {
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
   }
 
   void Segment::write(BitWriter &writer) const {
@@ -128,6 +338,160 @@ namespace bml::ebml::mkv {
                         wrapMemberWriter(voidElements)});
   }
 
+  static std::vector<std::byte> toIdBytes(ElementId id) {
+    auto value = static_cast<std::uintmax_t>(id);
+    std::vector<std::byte> bytes(bml::ebml::detail::requiredBytes(value).value());
+    for (auto it = bytes.rbegin(); it != bytes.rend(); ++it) {
+      *it = static_cast<std::byte>(value & 0xFFU);
+      value >>= 8U;
+    }
+    return bytes;
+  }
+
+  SeekHead createSeekHead(std::span<const std::pair<ElementId, uintmax_t>> positions) {
+    SeekHead seekHead{};
+    for (const auto &position : positions) {
+      Seek seek{};
+      seek.seekID = toIdBytes(position.first);
+      seek.seekPosition = position.second;
+      seekHead.seeks.push_back(std::move(seek));
+    }
+    return seekHead;
+  }
+
+  template <typename T>
+  static ByteCount measureElement(const T &element) {
+    BitWriter sizeWriter{BitWriter::DISCARD};
+    bml::write(sizeWriter, element);
+    return sizeWriter.position().divide<8>();
+  }
+
+  /**
+   * Writes the given Segment with a generated SeekHead referencing all top-level metadata Elements and the given Cues
+   * written after the Clusters.
+   *
+   * The Clusters are written by the given function and need to occupy exactly the given number of bytes. The Cue
+   * Cluster Positions of the given Cues are relative to the first Cluster and adjusted to the Segment Data here.
+   *
+   * NOTE: Since the sizes of all members are determined up front, the Clusters are only written once.
+   *
+   * NOTE: A CRC-32 of the Segment itself is not written, since its calculation would require buffering all Clusters.
+   */
+  static void writeIndexedSegment(BitWriter &writer, const Segment &segment, ByteCount clustersSize, Cues cues,
+                                  const std::function<void(BitWriter &)> &writeClusters) {
+    using namespace bml::ebml::detail;
+    // Reserve the space for the SeekHead with the largest possible positions, since the actual positions depend on the
+    // space reserved for the SeekHead. Any space not used by the actual SeekHead is filled with a Void Element.
+    constexpr auto UNKNOWN_POSITION = std::numeric_limits<uintmax_t>::max();
+    std::vector<std::pair<ElementId, uintmax_t>> seekPositions{{Info::ID, UNKNOWN_POSITION}};
+    if (segment.tracks) {
+      seekPositions.emplace_back(Tracks::ID, UNKNOWN_POSITION);
+    }
+    if (segment.chapters) {
+      seekPositions.emplace_back(Chapters::ID, UNKNOWN_POSITION);
+    }
+    if (segment.attachments) {
+      seekPositions.emplace_back(Attachments::ID, UNKNOWN_POSITION);
+    }
+    if (!segment.tags.empty()) {
+      seekPositions.emplace_back(Tags::ID, UNKNOWN_POSITION);
+    }
+    seekPositions.emplace_back(Cues::ID, UNKNOWN_POSITION);
+    const auto seekHeadSpace = measureElement(createSeekHead(seekPositions)) + 2_bytes;
+
+    // Determine the positions of all Elements (relative to the Segment Data) in the order they are written below
+    auto segmentPosition = seekHeadSpace;
+    const auto placeElement = [&seekPositions, &segmentPosition](ElementId id, ByteCount elementSize) {
+      auto it = std::find_if(seekPositions.begin(), seekPositions.end(),
+                             [id](const auto &position) { return position.first == id; });
+      if (it != seekPositions.end() && it->second == UNKNOWN_POSITION) {
+        it->second = segmentPosition.value();
+      }
+      segmentPosition += elementSize;
+    };
+    placeElement(Info::ID, measureElement(segment.info));
+    placeElement(Tracks::ID, measureElement(segment.tracks));
+    placeElement(Chapters::ID, measureElement(segment.chapters));
+    const auto clustersStart = segmentPosition;
+    segmentPosition += clustersSize;
+    placeElement(Attachments::ID, measureElement(segment.attachments));
+    placeElement(Tags::ID, measureElement(segment.tags));
+
+    std::optional<Cues> indexCues{};
+    if (cues.cuePoints.empty()) {
+      seekPositions.pop_back();
+    } else {
+      for (auto &point : cues.cuePoints) {
+        for (auto &positions : point.cueTrackPositions) {
+          positions.cueClusterPosition = positions.cueClusterPosition.get() + clustersStart.value();
+        }
+      }
+      indexCues = std::move(cues);
+      placeElement(Cues::ID, measureElement(indexCues));
+    }
+    const auto contentSize = segmentPosition + measureElement(segment.voidElements);
+
+    const auto seekHead = createSeekHead(seekPositions);
+    writeElementHeader(writer, Segment::ID, contentSize);
+    const auto start = writer.position();
+    seekHead.write(writer);
+    Void::fill(writer, seekHeadSpace - (writer.position() - start).divide<8>());
+    bml::write(writer, segment.info);
+    bml::write(writer, segment.tracks);
+    bml::write(writer, segment.chapters);
+    writeClusters(writer);
+    bml::write(writer, segment.attachments);
+    bml::write(writer, segment.tags);
+    bml::write(writer, indexCues);
+    bml::write(writer, segment.voidElements);
+    if (writer.position() - start != BitCount{contentSize}) [[unlikely]] {
+      throw std::logic_error("Segment content size does not match size determined before writing");
+    }
+  }
+
+  void Segment::write(BitWriter &writer, const WriteOptions &options) const {
+    using namespace bml::ebml::detail;
+    if (!options.generateIndex) {
+      write(writer);
+      return;
+    }
+
+    // Determine the Cue positions relative to the first Cluster, which are adjusted when writing the Segment
+    Cues generatedCues{};
+    ByteCount clustersSize{};
+    for (const auto &cluster : clusters) {
+      auto relativePosition = measureElement(cluster.crc32) + measureElement(cluster.timestamp) +
+                              measureElement(cluster.position) + measureElement(cluster.prevSize);
+      std::vector<uintmax_t> indexedTracks{};
+      for (const auto &block : cluster.simpleBlocks) {
+        const auto trackNumber = static_cast<uintmax_t>(block.header.trackNumber.get());
+        if (block.header.keyframe &&
+            std::find(indexedTracks.begin(), indexedTracks.end(), trackNumber) == indexedTracks.end()) {
+          // Index the first keyframe of every Track within each Cluster
+          CueTrackPositions positions{};
+          positions.cueTrack = trackNumber;
+          positions.cueClusterPosition = clustersSize.value();
+          positions.cueRelativePosition = relativePosition.value();
+          CuePoint point{};
+          // The Cue Time is written in Segment Ticks, just like the Cluster Timestamp
+          const auto blockTimestamp =
+              static_cast<intmax_t>(cluster.timestamp.get().value) + block.header.timestampOffset.get();
+          point.cueTime = MatroskaTimestamp{static_cast<uintmax_t>(std::max(blockTimestamp, intmax_t{0}))};
+          point.cueTrackPositions.push_back(std::move(positions));
+          generatedCues.cuePoints.push_back(std::move(point));
+          indexedTracks.push_back(trackNumber);
+        }
+        relativePosition += measureElement(block);
+      }
+      const auto contentSize =
+          relativePosition + measureElement(cluster.blockGroups) + measureElement(cluster.voidElements);
+      clustersSize += calcElementSize(Cluster::ID, contentSize);
+    }
+
+    writeIndexedSegment(writer, *this, clustersSize, std::move(generatedCues),
+                        [this](BitWriter &w) { bml::write(w, clusters); });
+  }
+
   void Segment::skip(BitReader &reader) { bml::ebml::detail::skipElement(reader, {EBMLHeader::ID, Segment::ID}); }
 
   void Segment::copy(BitReader &reader, BitWriter &writer) {
@@ -137,14 +501,208 @@ namespace bml::ebml::mkv {
   BML_YAML_DEFINE_PRINT(Segment, crc32, seekHeads, info, tracks, cues, chapters, clusters, attachments, tags,
                         voidElements)
 
+  const ClusterIndex::Entry *ClusterIndex::find(const SegmentTimestamp<> &timestamp) const noexcept {
+    if (entries.empty()) {
+      return nullptr;
+    }
+    auto it = std::upper_bound(
+        entries.begin(), entries.end(), timestamp,
+        [](const SegmentTimestamp<> &time, const Entry &entry) { return time < entry.timestamp; });
+    return it == entries.begin() ? &entries.front() : &*std::prev(it);
+  }
+
+  ClusterIndex ClusterIndex::fromCues(const Cues &cues, uint32_t trackNumber) {
+    ClusterIndex index{};
+    index.entries.reserve(cues.cuePoints.size());
+    for (const auto &point : cues.cuePoints) {
+      auto it = std::find_if(point.cueTrackPositions.begin(), point.cueTrackPositions.end(),
+                             [trackNumber](const CueTrackPositions &pos) { return pos.cueTrack.get() == trackNumber; });
+      if (it != point.cueTrackPositions.end()) {
+        // The Cue Time is written in Segment Ticks, just like the Cluster Timestamp
+        index.entries.push_back(
+            Entry{SegmentTimestamp<>{point.cueTime.get().value}, ByteCount{it->cueClusterPosition.get()}});
+      }
+    }
+    // Cue Points should already be ordered, but make sure the binary search works
+    std::stable_sort(index.entries.begin(), index.entries.end(),
+                     [](const Entry &one, const Entry &other) { return one.timestamp < other.timestamp; });
+    return index;
+  }
+
+  /**
+   * Scans the next Cluster starting at the current position of the given seekable reader, skipping any preceding
+   * non-Cluster Element.
+   *
+   * Returns an empty value if the end of the input or the start of the next EBML Document or Segment is reached.
+   */
+  static std::optional<ClusterDescriptor> scanNextCluster(BitReader &reader, BitCount segmentDataStart) {
+    using namespace bml::ebml::detail;
+    while (reader.hasMoreBytes()) {
+      auto memberId = peekElementId(reader);
+      if (memberId == EBMLHeader::ID || memberId == Segment::ID) {
+        break;
+      } else if (memberId != Cluster::ID) {
+        skipElement(reader);
+        continue;
+      }
+
+      const auto clusterStart = reader.position();
+      readElementHeader(reader, Cluster::ID);
+      Cluster cluster{};
+      // The Cluster Timestamp is the first child Element, unless preceded by a CRC-32 Element
+      if (peekElementId(reader) == CRC32::ID) {
+        skipElement(reader);
+      }
+      if (reader.hasMoreBytes() && peekElementId(reader) == cluster.timestamp.ID) {
+        cluster.timestamp.read(reader);
+      }
+      // Restart at the Cluster start to also support Clusters with unknown size
+      reader.seek(clusterStart);
+      Cluster::skip(reader);
+      return ClusterDescriptor{(clusterStart - segmentDataStart).divide<8>(),
+                               (reader.position() - clusterStart).divide<8>(), cluster.timestamp.get()};
+    }
+    return {};
+  }
+
+  std::vector<ClusterDescriptor> ClusterDescriptor::scan(BitReader &reader, BitCount segmentDataStart) {
+    std::vector<ClusterDescriptor> descriptors{};
+    while (auto descriptor = scanNextCluster(reader, segmentDataStart)) {
+      descriptors.push_back(*descriptor);
+    }
+    return descriptors;
+  }
+
+  std::vector<ClusterDescriptor> ClusterDescriptor::fromCues(const Cues &cues) {
+    std::vector<ClusterDescriptor> descriptors{};
+    descriptors.reserve(cues.cuePoints.size());
+    for (const auto &point : cues.cuePoints) {
+      // The Cue Time is written in Segment Ticks, just like the Cluster Timestamp
+      const SegmentTimestamp<> time{point.cueTime.get().value};
+      for (const auto &pos : point.cueTrackPositions) {
+        descriptors.push_back(ClusterDescriptor{ByteCount{pos.cueClusterPosition.get()}, 0_bytes, time});
+      }
+    }
+    // Keep a single descriptor per Cluster with the earliest Cue Time referencing it
+    std::sort(descriptors.begin(), descriptors.end(), [](const ClusterDescriptor &one, const ClusterDescriptor &other) {
+      return std::tie(one.position, one.timestamp) < std::tie(other.position, other.timestamp);
+    });
+    auto last = std::unique(
+        descriptors.begin(), descriptors.end(),
+        [](const ClusterDescriptor &one, const ClusterDescriptor &other) { return one.position == other.position; });
+    descriptors.erase(last, descriptors.end());
+    return descriptors;
+  }
+
+  ClusterIndex ClusterIndex::fromDescriptors(std::span<const ClusterDescriptor> descriptors) {
+    ClusterIndex index{};
+    index.entries.reserve(descriptors.size());
+    for (const auto &descriptor : descriptors) {
+      index.entries.push_back(Entry{descriptor.timestamp, descriptor.position});
+    }
+    std::stable_sort(index.entries.begin(), index.entries.end(),
+                     [](const Entry &one, const Entry &other) { return one.timestamp < other.timestamp; });
+    return index;
+  }
+
+  ClusterCache::ClusterCache(BitReader &input, BitCount segmentDataStart, std::vector<ClusterDescriptor> descriptors,
+                             std::size_t capacity, ReadOptions options)
+      : reader(&input), dataStart(segmentDataStart), clusterDescriptors(std::move(descriptors)),
+        maxCached(std::max(capacity, std::size_t{1})), readOptions(options) {
+    if (!input.isSeekable()) {
+      throw std::invalid_argument("Reading Clusters on demand requires a seekable input");
+    }
+  }
+
+  ClusterCache::ClusterCache(BitReader &input, BitCount segmentDataStart, std::size_t capacity, ReadOptions options)
+      : ClusterCache(input, segmentDataStart,
+                     input.isSeekable() ? ClusterDescriptor::scan(input, segmentDataStart)
+                                        : std::vector<ClusterDescriptor>{},
+                     capacity, options) {}
+
+  ClusterCache::ClusterCache(BitReader &input, BitCount segmentDataStart, const Segment &segment,
+                             std::size_t capacity, ReadOptions options)
+      : ClusterCache(input, segmentDataStart,
+                     segment.cues && !segment.cues->cuePoints.empty()
+                         ? ClusterDescriptor::fromCues(*segment.cues)
+                         : (input.isSeekable() ? ClusterDescriptor::scan(input, segmentDataStart)
+                                               : std::vector<ClusterDescriptor>{}),
+                     capacity, options) {}
+
+  std::shared_ptr<const Cluster> ClusterCache::get(std::size_t index) {
+    const auto position = clusterDescriptors.at(index).position;
+    // The cache is small, so a linear search is faster than any additional lookup structure
+    auto it = std::find_if(cachedClusters.begin(), cachedClusters.end(),
+                           [index](const auto &entry) { return entry.first == index; });
+    if (it != cachedClusters.end()) {
+      cachedClusters.splice(cachedClusters.begin(), cachedClusters, it);
+      return cachedClusters.front().second;
+    }
+
+    reader->seek(dataStart + position);
+    auto cluster = std::make_shared<Cluster>();
+    cluster->read(*reader, readOptions);
+    if (!clusterDescriptors[index].size) {
+      completeDescriptor(index, *cluster);
+    }
+    cachedClusters.emplace_front(index, std::move(cluster));
+    while (cachedClusters.size() > maxCached) {
+      cachedClusters.pop_back();
+    }
+    return cachedClusters.front().second;
+  }
+
+  void ClusterCache::completeDescriptor(std::size_t index, const Cluster &cluster) {
+    // The reader is positioned directly after the Cluster just read
+    auto &descriptor = clusterDescriptors[index];
+    const auto end = (reader->position() - dataStart).divide<8>();
+    descriptor.size = end - descriptor.position;
+    descriptor.timestamp = cluster.timestamp.get();
+
+    std::optional<ByteCount> nextPosition{};
+    if (index + 1 < clusterDescriptors.size()) {
+      nextPosition = clusterDescriptors[index + 1].position;
+      if (*nextPosition <= end) {
+        return;
+      }
+    }
+
+    // Scan for any Cluster between this and the next known Cluster, e.g. Clusters not referenced by the Cues
+    std::vector<ClusterDescriptor> missing{};
+    while (auto next = scanNextCluster(*reader, dataStart)) {
+      if (nextPosition && next->position >= *nextPosition) {
+        break;
+      }
+      missing.push_back(*next);
+    }
+    if (missing.empty()) {
+      return;
+    }
+    const auto offset = static_cast<std::ptrdiff_t>(index + 1);
+    clusterDescriptors.insert(clusterDescriptors.begin() + offset, missing.begin(), missing.end());
+    for (auto &entry : cachedClusters) {
+      if (entry.first > index) {
+        entry.first += missing.size();
+      }
+    }
+  }
+
   void Cluster::read(bml::BitReader &reader, const ReadOptions &options) {
     using namespace bml::ebml::detail;
-    readMasterElement(reader, ID, *this, options,
-                      {wrapMemberReader(crc32), wrapMemberReader(timestamp), wrapMemberReader(position),
-                       wrapMemberReader(prevSize), wrapMemberReader(simpleBlocks), wrapMemberReader(blockGroups),
-                       wrapMemberReader(voidElements)},
-                      {EBMLHeader::ID, Segment::ID, SeekHead::ID, Info::ID, Tracks::ID, Cues::ID, Chapters::ID,
-                       Cluster::ID, Attachments::ID, Tags::ID});
+    static constexpr std::array TERMINATING_IDS{EBMLHeader::ID, Segment::ID,  SeekHead::ID,    Info::ID, Tracks::ID,
+                                                Cues::ID,       Chapters::ID, Cluster::ID, Attachments::ID, Tags::ID};
+    readMasterElement(reader, ID, *this, options, TERMINATING_IDS, crc32, timestamp, position, prevSize, simpleBlocks,
+                      blockGroups, voidElements);
+  }
+
+  ChunkedReader Cluster::readChunked(bml::BitReader &reader, ReadOptions options) & {
+    using namespace bml::ebml::detail;
+    return readMasterElementChunked(reader, ID, *this, options,
+                                    {wrapMemberReader(crc32), wrapMemberReader(timestamp), wrapMemberReader(position),
+                                     wrapMemberReader(prevSize), wrapMemberReader(simpleBlocks),
+                                     wrapMemberReader(blockGroups), wrapMemberReader(voidElements)},
+                                    {EBMLHeader::ID, Segment::ID, SeekHead::ID, Info::ID, Tracks::ID, Cues::ID,
+                                     Chapters::ID, Cluster::ID, Attachments::ID, Tags::ID});
   }
 
   void Cluster::write(BitWriter &writer) const {
@@ -195,14 +753,115 @@ namespace bml::ebml::mkv {
     segment.read(reader, options);
   }
 
-  ChunkedReader Matroska::readChunked(bml::BitReader &reader, ReadOptions options) & {
+  BitCount Matroska::readIndexed(BitReader &reader, const ReadOptions &options) {
     header.read(reader, options);
+    return segment.readIndexed(reader, options);
+  }
+
+  void Matroska::readParallel(BitReader::ByteRange data, const ReadOptions &options, std::size_t numThreads) {
+    BitReader reader{data};
+    header.read(reader, options);
+    segment.readParallel(data, reader.position().divide<8>(), options, numThreads);
+  }
+
+  bool ProbeResult::isMatroska() const noexcept {
+    return header && (header->docType.get() == "matroska" || header->docType.get() == "webm");
+  }
+
+  template <typename T>
+  static T readProbed(BitReader &reader) {
+    // Read into a temporary object to not store partially read Elements on errors
+    T element{};
+    element.read(reader);
+    return element;
+  }
+
+  static void probeSegment(BitReader &reader, ByteCount numBytes, ProbeResult &result) {
+    using namespace bml::ebml::detail;
+    // Whether the next Element is completely contained in the probed data
+    const auto isComplete = [&]() { return reader.position() + requiredElementBytes(reader) <= numBytes; };
+    if (!reader.hasMoreBytes() || peekElementId(reader) != EBMLHeader::ID || !isComplete()) {
+      return;
+    }
+    result.header = readProbed<EBMLHeader>(reader);
+
+    if (!reader.hasMoreBytes() || peekElementId(reader) != Segment::ID) {
+      return;
+    }
+    const auto segmentSize = readElementHeader(reader, Segment::ID);
+    const auto dataStart = reader.position().divide<8>();
+    result.segmentDataStart = dataStart;
+
+    // Linearly read all metadata before the first Cluster, as far as contained in the probed data
+    while (reader.hasMoreBytes() && (segmentSize == UNKNOWN_SIZE || reader.position() < dataStart + segmentSize)) {
+      auto memberId = peekElementId(reader);
+      if (memberId == Cluster::ID) {
+        result.firstClusterPosition = reader.position().divide<8>();
+        break;
+      } else if (memberId == EBMLHeader::ID || memberId == Segment::ID || !isComplete()) {
+        break;
+      }
+
+      if (memberId == SeekHead::ID) {
+        result.seekHeads.push_back(readProbed<SeekHead>(reader));
+      } else if (memberId == Info::ID && !result.info) {
+        result.info = readProbed<Info>(reader);
+      } else if (memberId == Tracks::ID && !result.tracks) {
+        result.tracks = readProbed<Tracks>(reader);
+      } else {
+        skipElement(reader);
+      }
+    }
+
+    // Read the Info and Tracks referenced by the SeekHeads, if located (completely) within the probed data
+    for (const auto &seekHead : result.seekHeads) {
+      for (const auto &seek : seekHead.seeks) {
+        const auto seekId = toElementId(seek.seekID.get());
+        const auto position = dataStart + ByteCount{seek.seekPosition.get()};
+        if ((seekId != Info::ID || result.info) && (seekId != Tracks::ID || result.tracks)) {
+          continue;
+        } else if (position >= numBytes) {
+          continue;
+        }
+        reader.seek(position);
+        if (peekElementId(reader) != seekId || !isComplete()) {
+          continue;
+        }
+        if (seekId == Info::ID) {
+          result.info = readProbed<Info>(reader);
+        } else {
+          result.tracks = readProbed<Tracks>(reader);
+        }
+      }
+    }
+  }
+
+  ProbeResult Matroska::probe(std::span<const std::byte> data, ByteCount maxBytes) {
+    data = data.first(std::min(data.size(), maxBytes.value()));
+    ProbeResult result{};
+    BitReader reader{data};
+    try {
+      probeSegment(reader, ByteCount{data.size()}, result);
+    } catch (const std::exception &) {
+      // Malformed or truncated data, return the information found so far
+    }
+    return result;
+  }
+
+  ChunkedReader Matroska::readChunked(bml::BitReader &reader, ReadOptions options) & {
+    using namespace bml::ebml::detail;
+    const bool resumable = options.resumable && !options.validateCRC32 && reader.isSeekable();
+    while (auto missing = readResumable(reader, resumable, [&]() { header = {}; header.read(reader, options); })) {
+      co_yield missing;
+    }
     co_yield header.ID;
 
     auto readSegmentMember = segment.readChunked(reader, options);
     while (readSegmentMember) {
       if (auto id = readSegmentMember(); id != ElementId{}) {
         co_yield id;
+      } else if (auto missing = readSegmentMember.missingBytes()) {
+        co_yield missing;
       }
     }
     // segment is read
@@ -210,13 +869,275 @@ namespace bml::ebml::mkv {
     co_return;
   }
 
+  FrameStream Matroska::readFrames(bml::BitReader &reader, ReadOptions options) & {
+    using namespace bml::ebml::detail;
+    // "Yield" nothing to allow for lazy reading and initializing the frame stream before actually having data available
+    co_yield std::optional<Frame>{};
+
+    header.read(reader, options);
+    const auto segmentSize = readElementHeader(reader, Segment::ID);
+    const auto segmentStart = reader.position();
+
+    std::map<ElementId, std::function<void(BitReader &, const ReadOptions &)>> memberReaders{
+        wrapMemberReader(segment.crc32),       wrapMemberReader(segment.seekHeads),
+        wrapMemberReader(segment.info),        wrapMemberReader(segment.tracks),
+        wrapMemberReader(segment.cues),        wrapMemberReader(segment.chapters),
+        wrapMemberReader(segment.attachments), wrapMemberReader(segment.tags),
+        wrapMemberReader(segment.voidElements)};
+    static constexpr std::array TERMINATING_IDS{EBMLHeader::ID, Segment::ID};
+    const std::set<ElementId> clusterTerminatingIds{EBMLHeader::ID, Segment::ID, SeekHead::ID, Info::ID,
+                                                    Tracks::ID, Cues::ID, Chapters::ID, Cluster::ID,
+                                                    Attachments::ID, Tags::ID};
+
+    // Cache the scale of the last Track, since the Blocks of a single Track are usually grouped together
+    uint32_t lastTrackNumber = 0;
+    TrackTimescale lastTrackScale{1.0F};
+    const auto getTrackScale = [&](uint32_t trackNumber) {
+      if (trackNumber != lastTrackNumber) {
+        const auto *track = getTrackEntry(trackNumber);
+        lastTrackNumber = trackNumber;
+        lastTrackScale = track ? track->trackTimestampScale.get() : TrackTimescale{1.0F};
+      }
+      return lastTrackScale;
+    };
+
+    while ((segmentSize == UNKNOWN_SIZE && reader.hasMoreBytes()) || reader.position() < segmentStart + segmentSize) {
+      auto memberId = peekElementId(reader);
+      if (memberId == Cluster::ID) {
+        const auto clusterSize = readElementHeader(reader, Cluster::ID);
+        const auto clusterStart = reader.position();
+        SegmentTimestampElement<0xE7_id> clusterTimestamp{};
+        while ((clusterSize == UNKNOWN_SIZE && reader.hasMoreBytes()) ||
+               reader.position() < clusterStart + clusterSize) {
+          auto clusterMemberId = peekElementId(reader);
+          detail::BaseBlockElement *block = nullptr;
+          SimpleBlock simpleBlock{};
+          BlockGroup blockGroup{};
+          ElementRecorder recorder{options, reader};
+          if (clusterMemberId == clusterTimestamp.ID) {
+            recorder.measure([&]() { clusterTimestamp.read(reader, options); });
+            recorder.record(clusterMemberId);
+          } else if (clusterMemberId == SimpleBlock::ID) {
+            recorder.measure([&]() { simpleBlock.read(reader, options); });
+            recorder.record(clusterMemberId);
+            block = &simpleBlock;
+          } else if (clusterMemberId == BlockGroup::ID) {
+            recorder.measure([&]() { blockGroup.read(reader, options); });
+            recorder.record(clusterMemberId);
+            block = &blockGroup.block;
+          } else if (clusterSize == UNKNOWN_SIZE && clusterTerminatingIds.contains(clusterMemberId)) {
+            // end of Cluster with unknown size
+            break;
+          } else {
+            skipElement(reader);
+          }
+
+          if (block) {
+            const auto trackNumber = static_cast<uint32_t>(block->header.trackNumber.get());
+            auto timestampValue = static_cast<intmax_t>((clusterTimestamp.get() / getTrackScale(trackNumber)).value) +
+                                  block->header.timestampOffset;
+            std::optional<TrackTimestamp<>> timestamp{TrackTimestamp<>{static_cast<uintmax_t>(timestampValue)}};
+            for (auto &range : block->frameDataRanges) {
+              // NOTE: Don't construct the Frame within the co_yield expression, GCC 12 destroys that temporary twice
+              std::optional<Frame> frame{Frame{std::exchange(timestamp, std::nullopt), std::move(range), trackNumber}};
+              co_yield std::move(frame);
+            }
+          }
+        }
+      } else if (segmentSize == UNKNOWN_SIZE && (memberId == EBMLHeader::ID || memberId == Segment::ID)) {
+        // end of Segment with unknown size
+        break;
+      } else if (isSkippedElement(options, memberId)) [[unlikely]] {
+        skipFilteredMember(reader, memberId, TERMINATING_IDS, options.statistics);
+      } else if (auto it = memberReaders.find(memberId); it != memberReaders.end()) {
+        ElementRecorder recorder{options, reader};
+        recorder.measure([&]() { it->second(reader, options); });
+        recorder.record(memberId);
+      } else {
+        skipElement(reader);
+      }
+    }
+    co_return;
+  }
+
   void Matroska::write(BitWriter &writer) const {
     header.write(writer);
     segment.write(writer);
   }
 
+  void Matroska::write(BitWriter &writer, const WriteOptions &options) const {
+    header.write(writer);
+    segment.write(writer, options);
+  }
+
   BML_YAML_DEFINE_PRINT(Matroska, header, segment)
 
+  /**
+   * Invokes the given function with the ID of every member of the Master Element with the given ID until the end of the
+   * Master Element is reached. The function needs to consume the member.
+   */
+  template <typename Func>
+  static void visitMembers(BitReader &reader, ElementId id, const std::set<ElementId> &terminatingIds, Func &&visit) {
+    using namespace bml::ebml::detail;
+    const auto size = readElementHeader(reader, id);
+    const auto start = reader.position();
+    while ((size == UNKNOWN_SIZE && reader.hasMoreBytes()) || reader.position() < start + size) {
+      auto memberId = peekElementId(reader);
+      if (size == UNKNOWN_SIZE && terminatingIds.contains(memberId)) {
+        // end of Master Element with unknown size
+        break;
+      }
+      visit(memberId);
+    }
+  }
+
+  static const std::set<ElementId> SEGMENT_TERMINATING_IDS{EBMLHeader::ID, Segment::ID};
+  static const std::set<ElementId> CLUSTER_TERMINATING_IDS{EBMLHeader::ID, Segment::ID,     SeekHead::ID,
+                                                           Info::ID,       Tracks::ID,      Cues::ID,
+                                                           Chapters::ID,   Cluster::ID,     Attachments::ID,
+                                                           Tags::ID};
+
+  /**
+   * Prints the given value as single-entry mapping with the given name into the sequence with the given options.
+   */
+  template <typename T>
+  static void printYAMLEntry(std::ostream &os, const bml::yaml::Options &sequenceOptions, std::string_view name,
+                             const T &value) {
+    const auto entryOptions = sequenceOptions.nextLevel(true /* sequence */);
+    os << sequenceOptions.nextLevel().sequenceIndentation() << entryOptions.indentation(true /* first member */)
+       << name << ':';
+    bml::yaml::print(os, entryOptions.nextLevel(), value);
+  }
+
+  template <typename T>
+  static void readAndPrintYAMLEntry(std::ostream &os, BitReader &reader, const ReadOptions &readOptions,
+                                    const bml::yaml::Options &sequenceOptions, std::string_view name) {
+    T element{};
+    element.read(reader, readOptions);
+    printYAMLEntry(os, sequenceOptions, name, element);
+  }
+
+  std::ostream &Matroska::printYAML(std::ostream &os, BitReader &reader, const ReadOptions &readOptions,
+                                    const bml::yaml::Options &options) {
+    {
+      EBMLHeader header{};
+      header.read(reader, readOptions);
+      os << options.indentation(true /* first member */) << "header:";
+      bml::yaml::print(os, options.nextLevel(), header);
+    }
+
+    os << options.indentation(false /* second member */) << "segment:";
+    const auto segmentOptions = options.nextLevel();
+    visitMembers(reader, Segment::ID, SEGMENT_TERMINATING_IDS, [&](ElementId memberId) {
+      if (memberId == Cluster::ID) {
+        const auto clusterOptions = segmentOptions.nextLevel(true /* sequence */).nextLevel();
+        os << segmentOptions.nextLevel().sequenceIndentation()
+           << segmentOptions.nextLevel(true /* sequence */).indentation(true /* first member */) << "cluster:";
+        std::size_t numBlocks = 0;
+        std::size_t numSkippedBlocks = 0;
+        visitMembers(reader, Cluster::ID, CLUSTER_TERMINATING_IDS, [&](ElementId clusterMemberId) {
+          const auto isBlock = clusterMemberId == SimpleBlock::ID || clusterMemberId == BlockGroup::ID;
+          if (isBlock && numBlocks >= options.truncateSequenceLimit) {
+            ebml::detail::skipElement(reader);
+            ++numSkippedBlocks;
+          } else if (clusterMemberId == SimpleBlock::ID) {
+            readAndPrintYAMLEntry<SimpleBlock>(os, reader, readOptions, clusterOptions, "simpleBlock");
+          } else if (clusterMemberId == BlockGroup::ID) {
+            readAndPrintYAMLEntry<BlockGroup>(os, reader, readOptions, clusterOptions, "blockGroup");
+          } else if (clusterMemberId == decltype(Cluster::timestamp)::ID) {
+            readAndPrintYAMLEntry<decltype(Cluster::timestamp)>(os, reader, readOptions, clusterOptions, "timestamp");
+          } else if (clusterMemberId == decltype(Cluster::position)::value_type::ID) {
+            readAndPrintYAMLEntry<decltype(Cluster::position)::value_type>(os, reader, readOptions, clusterOptions,
+                                                                           "position");
+          } else if (clusterMemberId == decltype(Cluster::prevSize)::value_type::ID) {
+            readAndPrintYAMLEntry<decltype(Cluster::prevSize)::value_type>(os, reader, readOptions, clusterOptions,
+                                                                           "prevSize");
+          } else if (clusterMemberId == CRC32::ID) {
+            readAndPrintYAMLEntry<CRC32>(os, reader, readOptions, clusterOptions, "crc32");
+          } else if (clusterMemberId == Void::ID) {
+            readAndPrintYAMLEntry<Void>(os, reader, readOptions, clusterOptions, "void");
+          } else {
+            ebml::detail::skipElement(reader);
+          }
+          numBlocks += isBlock ? 1U : 0U;
+        });
+        if (numSkippedBlocks) {
+          printYAMLEntry(os, clusterOptions, "skippedBlocks", numSkippedBlocks);
+        }
+      } else if (memberId == SeekHead::ID) {
+        readAndPrintYAMLEntry<SeekHead>(os, reader, readOptions, segmentOptions, "seekHead");
+      } else if (memberId == Info::ID) {
+        readAndPrintYAMLEntry<Info>(os, reader, readOptions, segmentOptions, "info");
+      } else if (memberId == Tracks::ID) {
+        readAndPrintYAMLEntry<Tracks>(os, reader, readOptions, segmentOptions, "tracks");
+      } else if (memberId == Cues::ID) {
+        readAndPrintYAMLEntry<Cues>(os, reader, readOptions, segmentOptions, "cues");
+      } else if (memberId == Chapters::ID) {
+        readAndPrintYAMLEntry<Chapters>(os, reader, readOptions, segmentOptions, "chapters");
+      } else if (memberId == Attachments::ID) {
+        readAndPrintYAMLEntry<Attachments>(os, reader, readOptions, segmentOptions, "attachments");
+      } else if (memberId == Tags::ID) {
+        readAndPrintYAMLEntry<Tags>(os, reader, readOptions, segmentOptions, "tags");
+      } else if (memberId == CRC32::ID) {
+        readAndPrintYAMLEntry<CRC32>(os, reader, readOptions, segmentOptions, "crc32");
+      } else if (memberId == Void::ID) {
+        readAndPrintYAMLEntry<Void>(os, reader, readOptions, segmentOptions, "void");
+      } else {
+        ebml::detail::skipElement(reader);
+      }
+    });
+    return os;
+  }
+
+  template <typename T>
+  static void readAndPrintElement(std::ostream &os, BitReader &reader, const ReadOptions &readOptions) {
+    T element{};
+    element.read(reader, readOptions);
+    os << element;
+  }
+
+  std::ostream &Matroska::print(std::ostream &os, BitReader &reader, const ReadOptions &readOptions) {
+    {
+      EBMLHeader header{};
+      header.read(reader, readOptions);
+      os << "Matroska{header = " << header;
+    }
+
+    os << ", segment = [";
+    bool firstMember = true;
+    visitMembers(reader, Segment::ID, SEGMENT_TERMINATING_IDS, [&](ElementId memberId) {
+      if (!firstMember) {
+        os << ", ";
+      }
+      firstMember = false;
+      if (memberId == Cluster::ID) {
+        readAndPrintElement<Cluster>(os, reader, readOptions);
+      } else if (memberId == SeekHead::ID) {
+        readAndPrintElement<SeekHead>(os, reader, readOptions);
+      } else if (memberId == Info::ID) {
+        readAndPrintElement<Info>(os, reader, readOptions);
+      } else if (memberId == Tracks::ID) {
+        readAndPrintElement<Tracks>(os, reader, readOptions);
+      } else if (memberId == Cues::ID) {
+        readAndPrintElement<Cues>(os, reader, readOptions);
+      } else if (memberId == Chapters::ID) {
+        readAndPrintElement<Chapters>(os, reader, readOptions);
+      } else if (memberId == Attachments::ID) {
+        readAndPrintElement<Attachments>(os, reader, readOptions);
+      } else if (memberId == Tags::ID) {
+        readAndPrintElement<Tags>(os, reader, readOptions);
+      } else if (memberId == CRC32::ID) {
+        readAndPrintElement<CRC32>(os, reader, readOptions);
+      } else if (memberId == Void::ID) {
+        readAndPrintElement<Void>(os, reader, readOptions);
+      } else {
+        os << "(unknown element " << toHexString(static_cast<uintmax_t>(memberId)) << ")";
+        ebml::detail::skipElement(reader);
+      }
+    });
+    return os << "]}";
+  }
+
   const TrackEntry *Matroska::getTrackEntry(uint32_t trackNumber) const {
     if (!segment.tracks) {
       return nullptr;
@@ -234,7 +1155,194 @@ namespace bml::ebml::mkv {
     if (const auto *track = getTrackEntry(trackNumber)) {
       return FrameView{std::span{segment.clusters}, trackNumber, track->trackTimestampScale, start};
     }
-    return FrameView{{}, 0, {}, {}};
+    return FrameView{std::span<const Cluster>{}, 0, {}, {}};
+  }
+
+  FrameView Matroska::viewFrames(ClusterCache &clusters, uint32_t trackNumber, const TrackTimestamp<> &start) const {
+    if (const auto *track = getTrackEntry(trackNumber)) {
+      return FrameView{clusters, trackNumber, track->trackTimestampScale, start};
+    }
+    return FrameView{std::span<const Cluster>{}, 0, {}, {}};
+  }
+
+  FrameIndex Matroska::indexFrames(uint32_t trackNumber) const {
+    if (const auto *track = getTrackEntry(trackNumber)) {
+      return FrameIndex{std::span{segment.clusters}, trackNumber, track->trackTimestampScale};
+    }
+    return FrameIndex{};
+  }
+
+  FrameView Matroska::seekFrames(BitReader &reader, BitCount segmentDataStart, uint32_t trackNumber,
+                                 const TrackTimestamp<> &start, const ReadOptions &options) const {
+    if (!reader.isSeekable()) {
+      throw std::invalid_argument("Seeking to a Frame requires a seekable input");
+    }
+    const auto *track = getTrackEntry(trackNumber);
+    if (!track) {
+      return FrameView{std::span<const Cluster>{}, 0, {}, {}};
+    }
+    // The Cluster to start at is found via the (Cue) descriptors, see FrameView::Iterator
+    auto clusters =
+        std::make_shared<ClusterCache>(reader, segmentDataStart, segment, ClusterCache::DEFAULT_CAPACITY, options);
+    return FrameView{std::move(clusters), trackNumber, track->trackTimestampScale, start};
+  }
+
+  /**
+   * Appends Cue Points for the first keyframe of every Track within the Cluster described by the given descriptor to
+   * the given Cues, the same as done by Segment::write(WriteOptions).
+   *
+   * The Cue Cluster Positions are set to the given position of the Cluster relative to the first Cluster written. The
+   * Cue Relative Positions are determined from the actual positions of the SimpleBlocks in the input, which is why the
+   * SimpleBlocks are read without media data and all other Cluster members are skipped.
+   */
+  static void indexClusterKeyframes(BitReader &reader, BitCount segmentDataStart, const ClusterDescriptor &descriptor,
+                                    uintmax_t clusterPosition, Cues &cues) {
+    using namespace bml::ebml::detail;
+    reader.seek(segmentDataStart + descriptor.position);
+    readElementHeader(reader, Cluster::ID);
+    const auto dataStart = reader.position();
+    const auto clusterEnd = segmentDataStart + descriptor.position + descriptor.size;
+    std::vector<uintmax_t> indexedTracks{};
+    while (reader.position() < clusterEnd && reader.hasMoreBytes()) {
+      const auto memberStart = reader.position();
+      if (peekElementId(reader) != SimpleBlock::ID) {
+        skipElement(reader);
+        continue;
+      }
+      SimpleBlock block{};
+      block.read(reader);
+      const auto trackNumber = static_cast<uintmax_t>(block.header.trackNumber.get());
+      if (block.header.keyframe &&
+          std::find(indexedTracks.begin(), indexedTracks.end(), trackNumber) == indexedTracks.end()) {
+        CueTrackPositions positions{};
+        positions.cueTrack = trackNumber;
+        positions.cueClusterPosition = clusterPosition;
+        positions.cueRelativePosition = (memberStart - dataStart).divide<8>().value();
+        CuePoint point{};
+        const auto blockTimestamp =
+            static_cast<intmax_t>(descriptor.timestamp.value) + block.header.timestampOffset.get();
+        point.cueTime = MatroskaTimestamp{static_cast<uintmax_t>(std::max(blockTimestamp, intmax_t{0}))};
+        point.cueTrackPositions.push_back(std::move(positions));
+        cues.cuePoints.push_back(std::move(point));
+        indexedTracks.push_back(trackNumber);
+      }
+    }
+  }
+
+  void Matroska::extract(BitReader &reader, BitWriter &writer, const MatroskaTimestamp &start,
+                         const MatroskaTimestamp &end, const ReadOptions &options) {
+    if (!reader.isSeekable()) {
+      throw std::invalid_argument("Extracting a time range requires a seekable input");
+    }
+    if (end <= start) {
+      throw std::invalid_argument("The end of the time range to extract needs to be after its start");
+    }
+
+    Matroska source{};
+    const auto dataStart = source.readIndexed(reader, options);
+    const auto &sourceSegment = source.segment;
+    const auto startTicks = start / sourceSegment.info.timestampScale.get();
+
+    // Start at the first Cluster containing a keyframe at or before the start for all Tracks indexed by the Cues
+    std::optional<ByteCount> startPosition{};
+    if (sourceSegment.cues) {
+      std::set<uintmax_t> indexedTracks{};
+      for (const auto &point : sourceSegment.cues->cuePoints) {
+        for (const auto &positions : point.cueTrackPositions) {
+          indexedTracks.insert(positions.cueTrack.get());
+        }
+      }
+      for (auto trackNumber : indexedTracks) {
+        const auto index = ClusterIndex::fromCues(*sourceSegment.cues, static_cast<uint32_t>(trackNumber));
+        if (const auto *entry = index.find(startTicks)) {
+          startPosition = std::min(startPosition.value_or(entry->position), entry->position);
+        }
+      }
+    }
+    if (startPosition) {
+      reader.seek(dataStart + *startPosition);
+    }
+
+    std::vector<ClusterDescriptor> descriptors{};
+    std::optional<SegmentTimestamp<>> coveredEnd{};
+    while (auto descriptor = scanNextCluster(reader, dataStart)) {
+      // Compare in Matroska Ticks, since a Cluster starting at the floored end Segment Tick is still before the end
+      if (descriptor->timestamp * sourceSegment.info.timestampScale.get() >= end) {
+        coveredEnd = descriptor->timestamp;
+        break;
+      }
+      if (!startPosition && descriptor->timestamp <= startTicks) {
+        // Without Cues, every Cluster is assumed to start with a keyframe
+        descriptors.clear();
+      }
+      descriptors.push_back(*descriptor);
+    }
+
+    Segment segment{};
+    segment.info = sourceSegment.info;
+    segment.info.duration.reset();
+    if (!descriptors.empty() && (coveredEnd || sourceSegment.info.duration)) {
+      const auto endValue =
+          coveredEnd ? static_cast<float>(coveredEnd->value) : sourceSegment.info.duration->get().value;
+      segment.info.duration =
+          SegmentTimestamp<float>{std::max(endValue - static_cast<float>(descriptors.front().timestamp.value), 0.0F)};
+    }
+    segment.tracks = sourceSegment.tracks;
+    segment.attachments = sourceSegment.attachments;
+    if (segment.attachments) {
+      // Unless read with the media data, the attached file contents only refer to their position in the input
+      for (auto &file : segment.attachments->attachedFiles) {
+        auto &fileData = file.fileData.data();
+        if (fileData && !fileData.hasData()) {
+          std::vector<std::byte> content(fileData.size());
+          reader.seek(BitCount{fileData.byteRange().offset});
+          reader.readBytesInto(content);
+          fileData = DataRange{std::move(content)};
+        }
+      }
+    }
+    segment.tags = sourceSegment.tags;
+
+    // The Clusters are copied as-is, so only the Cue Cluster Positions need to be adjusted
+    std::map<uintmax_t, uintmax_t> clusterPositions{};
+    ByteCount clustersSize{};
+    for (const auto &descriptor : descriptors) {
+      clusterPositions.emplace(descriptor.position.value(), clustersSize.value());
+      clustersSize += descriptor.size;
+    }
+    Cues cues{};
+    if (sourceSegment.cues) {
+      for (const auto &point : sourceSegment.cues->cuePoints) {
+        CuePoint copiedPoint{};
+        copiedPoint.cueTime = point.cueTime;
+        for (auto positions : point.cueTrackPositions) {
+          if (auto it = clusterPositions.find(positions.cueClusterPosition.get()); it != clusterPositions.end()) {
+            positions.crc32.reset();
+            positions.cueClusterPosition = it->second;
+            // The referenced codec states and Cue References are not necessarily copied
+            positions.cueCodecState = 0U;
+            positions.cueReferences.clear();
+            copiedPoint.cueTrackPositions.push_back(std::move(positions));
+          }
+        }
+        if (!copiedPoint.cueTrackPositions.empty()) {
+          cues.cuePoints.push_back(std::move(copiedPoint));
+        }
+      }
+    } else {
+      for (const auto &descriptor : descriptors) {
+        indexClusterKeyframes(reader, dataStart, descriptor, clusterPositions.at(descriptor.position.value()), cues);
+      }
+    }
+
+    source.header.write(writer);
+    writeIndexedSegment(writer, segment, clustersSize, std::move(cues), [&](BitWriter &clusterWriter) {
+      for (const auto &descriptor : descriptors) {
+        // Copy the complete Cluster Elements without re-encoding, to keep all relative positions and CRC-32 values
+        reader.seek(dataStart + descriptor.position);
+        bml::copyBits(reader, clusterWriter, descriptor.size);
+      }
+    });
   }
 
   BML_EBML_DEFINE_IO(SeekHead, crc32, seeks, voidElements)
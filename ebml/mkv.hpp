@@ -3,6 +3,8 @@
 #include "ebml.hpp"
 #include "mkv_common.hpp"
 
+#include <list>
+#include <memory>
 #include <optional>
 
 /**
@@ -11,6 +13,26 @@
  * See: https://www.matroska.org/technical/elements.html
  */
 namespace bml::ebml::mkv {
+  /**
+   * Options for writing a Segment.
+   */
+  struct WriteOptions {
+    /**
+     * If set to true, a Cues Element indexing the first keyframe SimpleBlock of each Track in every Cluster and a
+     * SeekHead referencing all top-level metadata Elements are generated while writing the Segment. Any Cues and
+     * SeekHead Elements stored in the Segment are not written.
+     *
+     * The SeekHead is written at the start of the Segment (with a Void Element filling the space not required for the
+     * actual positions) and the Cues are written after the last Cluster, which allows to write the Segment in a single
+     * pass.
+     *
+     * NOTE: BlockGroups are not indexed.
+     *
+     * NOTE: A CRC-32 of the Segment itself is not written, since calculating it would require buffering all Clusters.
+     */
+    bool generateIndex = false;
+  };
+
   struct Seek : MasterElement {
     static constexpr ElementId ID{0x4DBB};
 
@@ -162,6 +184,7 @@ namespace bml::ebml::mkv {
     constexpr auto operator<=>(const Cluster &) const noexcept = default;
 
     void read(bml::BitReader &reader, const ReadOptions &options = {});
+    [[nodiscard]] ChunkedReader readChunked(bml::BitReader &reader, ReadOptions options = {}) &;
     void write(bml::BitWriter &writer) const;
 
     static void skip(BitReader &reader);
@@ -695,7 +718,7 @@ namespace bml::ebml::mkv {
     std::optional<Utf8StringElement<0x467E_id>> fileDescription;
     Utf8StringElement<0x466E_id> fileName;
     StringElement<0x4660_id> fileMediaType;
-    BinaryElement<0x465C_id> fileData;
+    BinaryDataElement<0x465C_id> fileData;
     UnsignedIntElement<0x46AE_id> fileUID;
 
     constexpr auto operator<=>(const AttachedFile &) const noexcept = default;
@@ -724,8 +747,8 @@ namespace bml::ebml::mkv {
   struct EditionDisplay : MasterElement {
     static constexpr ElementId ID{0x4520};
 
-    Utf8StringElement<0x4521_id> editionString;
-    std::vector<StringElement<0x45E4_id>> editionLanguageIETFs;
+    Utf8StringElement<0x4521_id, BorrowableString<char8_t>> editionString;
+    std::vector<StringElement<0x45E4_id, "", BorrowableString<char>>> editionLanguageIETFs;
 
     constexpr auto operator<=>(const EditionDisplay &) const noexcept = default;
 
@@ -753,10 +776,10 @@ namespace bml::ebml::mkv {
   struct ChapterDisplay : MasterElement {
     static constexpr ElementId ID{0x80};
 
-    Utf8StringElement<0x85_id> chapString;
-    std::vector<StringElement<0x437C_id, "eng">> chapLanguages;
-    std::vector<StringElement<0x437D_id>> chapLanguageBCP47s;
-    std::vector<StringElement<0x437E_id>> chapCountries;
+    Utf8StringElement<0x85_id, BorrowableString<char8_t>> chapString;
+    std::vector<StringElement<0x437C_id, "eng", BorrowableString<char>>> chapLanguages;
+    std::vector<StringElement<0x437D_id, "", BorrowableString<char>>> chapLanguageBCP47s;
+    std::vector<StringElement<0x437E_id, "", BorrowableString<char>>> chapCountries;
 
     constexpr auto operator<=>(const ChapterDisplay &) const noexcept = default;
 
@@ -812,7 +835,7 @@ namespace bml::ebml::mkv {
     };
 
     UnsignedIntElement<0x73C4_id> chapterUID;
-    std::optional<Utf8StringElement<0x5654_id>> chapterStringUID;
+    std::optional<Utf8StringElement<0x5654_id, BorrowableString<char8_t>>> chapterStringUID;
     MatroskaTimestampElement<0x91_id> chapterTimeStart;
     std::optional<MatroskaTimestampElement<0x92_id>> chapterTimeEnd;
     BoolElement<0x98_id, false> chapterFlagHidden;
@@ -885,7 +908,7 @@ namespace bml::ebml::mkv {
     };
 
     EnumElement<0x68CA_id, Type, Type::ALBUM> targetTypeValue;
-    std::optional<StringElement<0x63CA_id>> targetType;
+    std::optional<StringElement<0x63CA_id, "", BorrowableString<char>>> targetType;
     std::vector<UnsignedIntElement<0x63C5_id, 0>> tagTrackUIDs;
     std::vector<UnsignedIntElement<0x63C9_id, 0>> tagEditionUIDs;
     std::vector<UnsignedIntElement<0x63C4_id, 0>> tagChapterUIDs;
@@ -904,11 +927,11 @@ namespace bml::ebml::mkv {
   struct SimpleTag : MasterElement {
     static constexpr ElementId ID{0x67C8};
 
-    Utf8StringElement<0x45A3_id> tagName;
-    StringElement<0x447A_id, "und"> tagLanguage;
-    std::optional<StringElement<0x447B_id>> tagLanguageBCP47;
+    Utf8StringElement<0x45A3_id, BorrowableString<char8_t>> tagName;
+    StringElement<0x447A_id, "und", BorrowableString<char>> tagLanguage;
+    std::optional<StringElement<0x447B_id, "", BorrowableString<char>>> tagLanguageBCP47;
     BoolElement<0x4484_id, true> tagDefault;
-    std::optional<Utf8StringElement<0x4487_id>> tagString;
+    std::optional<Utf8StringElement<0x4487_id, BorrowableString<char8_t>>> tagString;
     std::optional<BinaryElement<0x4485_id>> tagBinary;
 
     constexpr auto operator<=>(const SimpleTag &) const noexcept = default;
@@ -968,6 +991,55 @@ namespace bml::ebml::mkv {
     [[nodiscard]] ChunkedReader readChunked(bml::BitReader &reader, ReadOptions options = {}) &;
     void write(bml::BitWriter &writer) const;
 
+    /**
+     * Writes this Segment to the given writer, applying the given options.
+     *
+     * See WriteOptions for details.
+     */
+    void write(bml::BitWriter &writer, const WriteOptions &options) const;
+
+    /**
+     * Reads the metadata of this Segment from the given seekable reader by following the SeekHead Elements instead of
+     * linearly reading all contained Elements.
+     *
+     * All Elements up to the first Cluster are read linearly. Any other metadata Element (e.g. Cues or Tags)
+     * referenced by a SeekHead is read by directly seeking to its position. Clusters are not read at all, afterwards
+     * the reader is positioned at the first Cluster (if any) to allow reading the Clusters on demand.
+     *
+     * If no SeekHead is present, the remaining Elements are read linearly with all Clusters being skipped.
+     *
+     * Returns the position of the Segment Data in the given reader, which all positions stored in SeekHead and Cues
+     * Elements are relative to.
+     *
+     * NOTE: Throws an exception if the reader is not seekable, see BitReader::isSeekable().
+     *
+     * NOTE: The CRC-32 of the Segment itself is not validated, since not all its members are read.
+     */
+    BitCount readIndexed(bml::BitReader &reader, const ReadOptions &options = {});
+
+    /**
+     * Reads this Segment starting at the given offset of the given in-memory (e.g. memory-mapped) input data, parsing
+     * the Clusters in parallel on the given number of threads.
+     *
+     * The metadata Elements are read via readIndexed() and the Cluster positions are determined by skipping over all
+     * Clusters (see ClusterDescriptor::scan()). Afterwards, the Clusters are distributed across the worker threads,
+     * where each worker reads its Clusters with its own BitReader over the input data. The Clusters are stored in
+     * order of their occurrence, the result is the same as reading the Segment linearly via read().
+     *
+     * If a numThreads value of zero is given, the number of hardware threads is used.
+     *
+     * If reading any Cluster fails (including CRC-32 validation), the error of the first such Cluster is rethrown after
+     * all workers have finished.
+     *
+     * If a frameDataResource is set in the options, all allocations from it are synchronized between the worker
+     * threads, so the resource itself does not need to be thread-safe. As for read(), only the Frame payloads are
+     * allocated from this resource, not the Cluster and Block objects themselves.
+     *
+     * NOTE: The CRC-32 of the Segment itself is not validated, see readIndexed().
+     */
+    void readParallel(BitReader::ByteRange data, ByteCount offset, const ReadOptions &options = {},
+                      std::size_t numThreads = 0);
+
     static void skip(BitReader &reader);
     static void copy(BitReader &reader, BitWriter &writer);
 
@@ -975,7 +1047,218 @@ namespace bml::ebml::mkv {
     std::ostream &printYAML(std::ostream &os, const bml::yaml::Options &options) const;
   };
 
+  /**
+   * Lightweight description of a single Cluster within a Segment, allowing to read the Cluster on demand.
+   */
+  struct ClusterDescriptor {
+    /** The position of the Cluster Element, relative to the Segment Data start */
+    ByteCount position;
+    /** The size of the complete Cluster Element, including the Element header, zero if not known (yet) */
+    ByteCount size;
+    /**
+     * The Timestamp of the Cluster, for descriptors determined from the Cues (see fromCues()) the earliest Cue Time
+     * referencing the Cluster instead
+     */
+    SegmentTimestamp<> timestamp;
+
+    constexpr auto operator<=>(const ClusterDescriptor &) const noexcept = default;
+
+    /**
+     * Scans all Clusters starting at the current position of the given seekable reader and returns their descriptors
+     * in the order of their occurrence.
+     *
+     * Only the Element header and the Timestamp of each Cluster are read, any other Element Data is skipped. Any
+     * non-Cluster Element is skipped as well. The scan stops at the end of the input or at the start of the next EBML
+     * Document or Segment.
+     *
+     * The segmentDataStart parameter is the position of the Segment Data in the given reader, as returned by
+     * Segment::readIndexed().
+     */
+    static std::vector<ClusterDescriptor> scan(BitReader &reader, BitCount segmentDataStart);
+
+    /**
+     * Returns the descriptors of all Clusters referenced by any Cue Point of the given Cues, ordered by their position.
+     *
+     * No Cluster is accessed for this, so the Cluster sizes are not known (set to zero) and the timestamps are set to
+     * the earliest Cue Time referencing the Cluster, which is never before the actual Cluster Timestamp.
+     *
+     * NOTE: The returned descriptors only cover the Clusters referenced by the Cues, which are not necessarily all
+     * Clusters of the Segment!
+     */
+    static std::vector<ClusterDescriptor> fromCues(const Cues &cues);
+  };
+
+  /**
+   * Index of the positions of the Clusters within a Segment, ordered by timestamp.
+   *
+   * The index allows to find the Cluster containing the Frame at a given timestamp by binary search without needing to
+   * read any of the preceding Clusters.
+   */
+  struct ClusterIndex {
+    struct Entry {
+      /** The timestamp of the indexed position, i.e. of the referenced Frame or the Cluster start */
+      SegmentTimestamp<> timestamp;
+      /** The position of the Cluster Element, relative to the Segment Data start */
+      ByteCount position;
+
+      constexpr auto operator<=>(const Entry &) const noexcept = default;
+    };
+
+    std::vector<Entry> entries;
+
+    constexpr auto operator<=>(const ClusterIndex &) const noexcept = default;
+
+    /**
+     * Returns the entry with the largest timestamp not greater than the given timestamp.
+     *
+     * If all entries are located after the given timestamp, the first entry is returned. Returns a nullptr if this
+     * index is empty.
+     */
+    const Entry *find(const SegmentTimestamp<> &timestamp) const noexcept;
+
+    /**
+     * Creates the index of all Cue Points referencing the Track with the given number.
+     */
+    static ClusterIndex fromCues(const Cues &cues, uint32_t trackNumber);
+
+    /**
+     * Creates the index of the given Cluster descriptors.
+     */
+    static ClusterIndex fromDescriptors(std::span<const ClusterDescriptor> descriptors);
+
+    /**
+     * Creates the index by scanning all Clusters starting at the current position of the given seekable reader.
+     *
+     * See ClusterDescriptor::scan() for details.
+     */
+    static ClusterIndex scan(BitReader &reader, BitCount segmentDataStart) {
+      return fromDescriptors(ClusterDescriptor::scan(reader, segmentDataStart));
+    }
+  };
+
+  /**
+   * On-demand reader and cache for the Clusters of a Segment.
+   *
+   * Only the lightweight ClusterDescriptors are kept for all Clusters of the Segment. The complete Cluster objects are
+   * read from the underlying seekable reader on access, of which only the given maximum number of recently used
+   * Clusters are kept in memory. This bounds the memory usage by the working set instead of the Segment size.
+   *
+   * Descriptors without a known size (e.g. as determined from the Cues, see ClusterDescriptor::fromCues()) are
+   * completed with the actual size and Cluster Timestamp when the Cluster is read. If the Cluster is not directly
+   * followed by the Cluster of the next descriptor, the Clusters in between (e.g. not referenced by any Cue Point) are
+   * scanned and inserted after the read Cluster. This way, all Clusters are accessible by iterating the indices in
+   * order, while only the accessed parts of the Segment are read.
+   *
+   * NOTE: Accessing a Cluster which is not cached repositions the underlying reader, so the reader SHOULD NOT be used
+   * otherwise while this object is in use!
+   *
+   * NOTE: Since reading a Cluster may insert further descriptors, the indices of all following Clusters may change and
+   * previously returned descriptors are invalidated!
+   */
+  class ClusterCache {
+  public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 8;
+
+    /**
+     * Creates a cache reading the Clusters described by the given descriptors from the given seekable reader.
+     *
+     * The segmentDataStart parameter is the position of the Segment Data in the given reader, as returned by
+     * Segment::readIndexed().
+     *
+     * NOTE: Throws an exception if the reader is not seekable, see BitReader::isSeekable().
+     */
+    ClusterCache(BitReader &input, BitCount segmentDataStart, std::vector<ClusterDescriptor> descriptors,
+                 std::size_t capacity = DEFAULT_CAPACITY, ReadOptions options = {});
+
+    /**
+     * Creates a cache reading the Clusters from the given seekable reader, starting at its current position.
+     *
+     * See ClusterDescriptor::scan() for how the Clusters are determined.
+     */
+    ClusterCache(BitReader &input, BitCount segmentDataStart, std::size_t capacity = DEFAULT_CAPACITY,
+                 ReadOptions options = {});
+
+    /**
+     * Creates a cache reading the Clusters of the given Segment (e.g. as read by Segment::readIndexed()) from the given
+     * seekable reader.
+     *
+     * If the Segment contains any Cue Points, the Clusters are determined from the Cues without reading any Cluster
+     * (see ClusterDescriptor::fromCues()) and completed on access. Otherwise, all Clusters are scanned starting at the
+     * current position of the reader, see ClusterDescriptor::scan().
+     */
+    ClusterCache(BitReader &input, BitCount segmentDataStart, const Segment &segment,
+                 std::size_t capacity = DEFAULT_CAPACITY, ReadOptions options = {});
+
+    /**
+     * Returns the descriptors of all Clusters accessible via this cache.
+     */
+    std::span<const ClusterDescriptor> descriptors() const noexcept { return clusterDescriptors; }
+    std::size_t size() const noexcept { return clusterDescriptors.size(); }
+    bool empty() const noexcept { return clusterDescriptors.empty(); }
+
+    /**
+     * Returns the number of Clusters currently held in memory.
+     */
+    std::size_t numCached() const noexcept { return cachedClusters.size(); }
+
+    /**
+     * Returns the Cluster with the given index, reading it from the underlying reader if it is not cached.
+     *
+     * The returned pointer stays valid even if the Cluster is evicted from the cache in the meantime.
+     *
+     * NOTE: Throws a std::out_of_range error if the index is not valid.
+     */
+    std::shared_ptr<const Cluster> get(std::size_t index);
+
+  private:
+    void completeDescriptor(std::size_t index, const Cluster &cluster);
+
+  private:
+    BitReader *reader;
+    BitCount dataStart;
+    std::vector<ClusterDescriptor> clusterDescriptors;
+    std::size_t maxCached;
+    ReadOptions readOptions;
+    /** The cached Clusters by their index, the most recently used Cluster first */
+    std::list<std::pair<std::size_t, std::shared_ptr<const Cluster>>> cachedClusters;
+  };
+
+  /**
+   * Summary of the information found by probing the start of a Matroska (or other EBML) document, see
+   * Matroska::probe().
+   *
+   * Any information not (completely) contained within the probed data is not set.
+   */
+  struct ProbeResult {
+    /** The default number of bytes to probe */
+    static constexpr ByteCount DEFAULT_PROBE_SIZE{64 * 1024};
+
+    /** The EBML Header, containing the DocType and its versions */
+    std::optional<EBMLHeader> header;
+    /** The position of the Segment Data, relative to the start of the probed data */
+    std::optional<ByteCount> segmentDataStart;
+    /** The SeekHead Elements read before the first Cluster */
+    std::vector<SeekHead> seekHeads;
+    std::optional<Info> info;
+    std::optional<Tracks> tracks;
+    /** The position of the first Cluster, relative to the start of the probed data */
+    std::optional<ByteCount> firstClusterPosition;
+
+    /**
+     * Returns whether the probed data is a Matroska or WebM document, based on the DocType of the EBML Header.
+     */
+    bool isMatroska() const noexcept;
+
+    /**
+     * Returns whether all information required for identifying the tracks of the document (i.e. the EBML Header,
+     * Segment Info and Tracks) was found.
+     */
+    bool isComplete() const noexcept { return header && segmentDataStart && info && tracks; }
+  };
+
   class FrameView;
+  class FrameIndex;
+  class FrameStream;
 
   /**
    * Container for a whole Matroska stream/file.
@@ -988,20 +1271,97 @@ namespace bml::ebml::mkv {
 
     /**
      * Reads the whole Matroska container from the underlying input.
+     *
+     * NOTE: If the ReadOptions#mediaDataSource is set, the string values of the Tags and Chapters are not copied, but
+     * borrowed from the mediaDataSource (see BorrowableString), so it then needs to outlive any access to them!
      */
     void read(BitReader &reader, const ReadOptions &options);
     [[nodiscard]] ChunkedReader readChunked(bml::BitReader &reader, ReadOptions options = {}) &;
 
+    /**
+     * Reads the whole Matroska container from the underlying input and produces the contained Frames of all Tracks
+     * while reading, without retaining any Cluster.
+     *
+     * See FrameStream for details.
+     */
+    [[nodiscard]] FrameStream readFrames(bml::BitReader &reader, ReadOptions options = {}) &;
+
+    /**
+     * Reads the EBML header and the metadata of the Segment from the underlying seekable input without reading any
+     * Cluster.
+     *
+     * Returns the position of the Segment Data in the given reader.
+     *
+     * See Segment::readIndexed() for details.
+     */
+    BitCount readIndexed(BitReader &reader, const ReadOptions &options);
+
+    /**
+     * Reads the whole Matroska container from the given in-memory (e.g. memory-mapped) input data, parsing the
+     * Clusters in parallel on the given number of threads.
+     *
+     * See Segment::readParallel() for details.
+     */
+    void readParallel(BitReader::ByteRange data, const ReadOptions &options = {}, std::size_t numThreads = 0);
+
+    /**
+     * Determines the basic information of the Matroska document starting at the given data, while accessing at most
+     * the given number of bytes.
+     *
+     * The EBML Header, the SeekHead, Info and Tracks Elements before the first Cluster are read if they are completely
+     * contained within the probed bytes. Otherwise, Info and Tracks Elements referenced by a SeekHead are read if they
+     * are contained within the probed bytes. Any other Element is skipped. Thus, the time to probe is bounded by the
+     * probed bytes and does not depend on the size of the complete document.
+     *
+     * NOTE: This function does not throw for malformed or other non-EBML data, but stops probing and only returns the
+     * information found until then.
+     */
+    static ProbeResult probe(std::span<const std::byte> data, ByteCount maxBytes = ProbeResult::DEFAULT_PROBE_SIZE);
+
     /**
      * Writes the whole Matroska container to the underlying output.
      *
      * NOTE: Attempting to write a Matroska object without data will result in an exception being thrown.
      */
     void write(BitWriter &writer) const;
+    void write(BitWriter &writer, const WriteOptions &options) const;
 
     BML_DEFINE_PRINT(Matroska, header, segment)
     std::ostream &printYAML(std::ostream &os, const bml::yaml::Options &options) const;
 
+    /**
+     * Reads the Matroska container from the given reader and directly prints each Element as YAML while reading,
+     * without building the object tree.
+     *
+     * Other than printing a completely read Matroska object, the Segment and all Clusters are printed as sequences of
+     * their members in the order they are read, each listed as single-entry mapping with the name of the member (e.g.
+     * "info" or "simpleBlock"). All other Elements are printed the same as their completely read objects.
+     *
+     * Per Cluster, only the first yaml::Options#truncateSequenceLimit Blocks are read and printed. Any further Block is
+     * skipped without being read and only the number of skipped Blocks is printed.
+     *
+     * NOTE: At most a single top-level Element (or Block) is kept in memory at any time.
+     *
+     * NOTE: Since the Segment and the Clusters are never read completely, their CRC-32 Elements are printed but not
+     * validated, independent of ReadOptions#validateCRC32.
+     */
+    static std::ostream &printYAML(std::ostream &os, BitReader &reader, const ReadOptions &readOptions,
+                                   const bml::yaml::Options &options);
+
+    /**
+     * Reads the Matroska container from the given reader and directly prints each top-level Element while reading,
+     * without building the object tree.
+     *
+     * The Segment is printed as list of its members in the order they are read, each member is printed the same as its
+     * completely read object.
+     *
+     * NOTE: At most a single top-level Element (e.g. a single Cluster) is kept in memory at any time.
+     *
+     * NOTE: Since the Segment is never read completely, its CRC-32 Element is printed but not validated, independent
+     * of ReadOptions#validateCRC32.
+     */
+    static std::ostream &print(std::ostream &os, BitReader &reader, const ReadOptions &readOptions);
+
     /**
      * Returns a pointer to the TrackEntry for the given track number, if present in this Matroska container.
      */
@@ -1017,6 +1377,78 @@ namespace bml::ebml::mkv {
      * effective timestamps of the other laced Frames are not interpolated!
      */
     FrameView viewFrames(uint32_t trackNumber, const TrackTimestamp<> &start = {}) const;
+
+    /**
+     * Returns an input range producing each Frame of the given Track number stored in the Clusters accessible via the
+     * given cache.
+     *
+     * Other than viewFrames() above, the Clusters are read on demand from the underlying input (and not from the
+     * Clusters stored in the Segment).
+     */
+    FrameView viewFrames(ClusterCache &clusters, uint32_t trackNumber, const TrackTimestamp<> &start = {}) const;
+
+    /**
+     * Builds the compact index of all stored Frames of the given Track number.
+     *
+     * Other than viewFrames(), iterating the returned index and searching it by timestamp does not access the Blocks of
+     * any other Track. This is useful when accessing the Frames of the same Track repeatedly or for containers with
+     * many Tracks.
+     *
+     * See FrameIndex for details.
+     */
+    FrameIndex indexFrames(uint32_t trackNumber) const;
+
+    /**
+     * Returns an input range producing the Frames of the given Track number starting at the given timestamp, reading
+     * the Clusters on demand from the given seekable reader.
+     *
+     * The Clusters are determined via the Cues of the Segment (e.g. as read by readIndexed()), so the Cluster to start
+     * at is found by binary search without reading any preceding Cluster. If no Cue Points are present, the Cluster
+     * timestamps are scanned instead (see ClusterDescriptor::scan()), in which case the reader needs to be positioned
+     * at the first Cluster. Starting with the Cluster containing the requested Frame, the following Clusters are read
+     * one at a time while iterating, up to the end of the Segment. See ClusterCache for details.
+     *
+     * The segmentDataStart parameter is the position of the Segment Data in the given reader, as returned by
+     * readIndexed().
+     *
+     * NOTE: The returned view owns the ClusterCache reading the Clusters, so the reader needs to outlive the view and
+     * SHOULD NOT be used otherwise while iterating. The Clusters stored in the Segment are neither used nor modified.
+     *
+     * NOTE: Same as for viewFrames() with a ClusterCache, the Frame data SHOULD only be accessed until the iterator is
+     * advanced.
+     *
+     * NOTE: Throws an exception if the reader is not seekable, see BitReader::isSeekable().
+     */
+    FrameView seekFrames(BitReader &reader, BitCount segmentDataStart, uint32_t trackNumber,
+                         const TrackTimestamp<> &start, const ReadOptions &options = {}) const;
+
+    /**
+     * Extracts the Clusters covering the given time range from the Matroska document in the given seekable reader and
+     * writes them as a new Matroska document to the given writer.
+     *
+     * Only the metadata of the source document (see readIndexed()) and the Clusters covering the time range are read.
+     * The first Cluster copied is looked up via the Cues, such that it contains a keyframe at or before the given start
+     * for each Track indexed by the Cues. The following Clusters are copied until a Cluster starting at or after the
+     * given end is reached. Thus, the time to extract depends on the length of the extracted range and not on the size
+     * of the source document.
+     *
+     * The EBML Header, Info, Tracks, Attachments and Tags are passed through, with the Info Duration set to the time
+     * range covered by the copied Clusters. A new SeekHead (see WriteOptions#generateIndex) and the Cue Points
+     * referencing any of the copied Clusters are written. Chapters are not written, since they refer to the timeline of
+     * the source document.
+     *
+     * If the source document does not contain any Cues, all Clusters are scanned (see ClusterDescriptor::scan()) and
+     * copying starts at the last Cluster starting at or before the given start. In this case, every Cluster is assumed
+     * to start with a keyframe and the Cues are generated for the first keyframe of every Track within each copied
+     * Cluster, the same as for Segment::write(WriteOptions).
+     *
+     * NOTE: The Clusters are copied unmodified, so all timestamps keep their values of the source document.
+     *
+     * NOTE: Throws an exception if the reader is not seekable, see BitReader::isSeekable(), or if the given end is not
+     * after the given start.
+     */
+    static void extract(BitReader &reader, BitWriter &writer, const MatroskaTimestamp &start,
+                        const MatroskaTimestamp &end, const ReadOptions &options = {});
   };
 
 } // namespace bml::ebml::mkv
@@ -3,10 +3,15 @@
 #include "ebml.hpp"
 #include "mkv_common.hpp"
 
+#include <coroutine>
+#include <exception>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <ranges>
 #include <span>
+#include <utility>
+#include <vector>
 
 /**
  * Types for reading/writing the container structure of the Matroska (MKV) media container format.
@@ -16,6 +21,7 @@
 namespace bml::ebml::mkv {
 
   struct Cluster;
+  class ClusterCache;
 
   /**
    * A Frame of data of a single Track, as defined in the Matroska Block specification.
@@ -38,6 +44,11 @@ namespace bml::ebml::mkv {
      * not access this member after freeing the underlying Block Element.
      */
     DataRange data;
+
+    /**
+     * The number of the Track this Frame belongs to.
+     */
+    uint32_t trackNumber;
   };
 
   /**
@@ -57,13 +68,14 @@ namespace bml::ebml::mkv {
       explicit Iterator() noexcept = default;
       Iterator(std::span<const Cluster> clusters, uint32_t trackNum, const TrackTimescale &scale,
                const TrackTimestamp<> &start) noexcept;
+      Iterator(ClusterCache &clusters, uint32_t trackNum, const TrackTimescale &scale, const TrackTimestamp<> &start);
 
-      Iterator &operator++() noexcept {
+      Iterator &operator++() {
         advance();
         return *this;
       }
 
-      Iterator operator++(int) noexcept {
+      Iterator operator++(int) {
         auto copy = *this;
         advance();
         return copy;
@@ -74,7 +86,8 @@ namespace bml::ebml::mkv {
       bool operator==(const Iterator &other) const noexcept;
 
     private:
-      void advance() noexcept;
+      void advance();
+      bool loadNextCluster();
 
       friend bool operator==(const Sentinel &, const Iterator &it) noexcept { return it.pendingClusters.empty(); }
 
@@ -84,21 +97,204 @@ namespace bml::ebml::mkv {
       TrackTimescale timescale;
       uint32_t trackNumber;
       uint8_t currentLaceIndex;
+      /** Only used when reading the Clusters on demand */
+      ClusterCache *cache = nullptr;
+      std::shared_ptr<const Cluster> currentCluster;
+      std::size_t nextClusterIndex = 0;
     };
 
   public:
     constexpr FrameView(std::span<const Cluster> allClusters, uint32_t track, const TrackTimescale &scale,
                         const TrackTimestamp<> &start) noexcept
-        : clusters(allClusters), trackNumber(track), timescale(scale), startTime(start) {}
+        : clusters(allClusters), clusterCache(nullptr), trackNumber(track), timescale(scale), startTime(start) {}
 
-    Iterator begin() const noexcept { return Iterator{clusters, trackNumber, timescale, startTime}; }
+    /**
+     * Creates a view reading the Clusters on demand from the given cache.
+     *
+     * NOTE: The data of the produced Frames might reference the Cluster currently processed by the iterator, which is
+     * released when advancing to the next Cluster. Therefore, the Frame data SHOULD only be accessed until the iterator
+     * is advanced or needs to be copied!
+     */
+    constexpr FrameView(ClusterCache &cache, uint32_t track, const TrackTimescale &scale,
+                        const TrackTimestamp<> &start) noexcept
+        : clusters(), clusterCache(&cache), trackNumber(track), timescale(scale), startTime(start) {}
+
+    /**
+     * Creates a view reading the Clusters on demand from the given cache, sharing the ownership of the cache.
+     *
+     * See the constructor above for details.
+     */
+    FrameView(std::shared_ptr<ClusterCache> cache, uint32_t track, const TrackTimescale &scale,
+              const TrackTimestamp<> &start) noexcept
+        : clusters(), clusterCache(cache.get()), trackNumber(track), timescale(scale), startTime(start),
+          ownedCache(std::move(cache)) {}
+
+    Iterator begin() const {
+      return clusterCache ? Iterator{*clusterCache, trackNumber, timescale, startTime}
+                          : Iterator{clusters, trackNumber, timescale, startTime};
+    }
     constexpr Sentinel end() const noexcept { return Sentinel{}; }
 
+    /**
+     * Splits this view into at most the given number of independent views over consecutive ranges of Clusters.
+     *
+     * Iterating all returned views in order produces the same Frames as iterating this view. Since the Frame
+     * timestamps are calculated from the timestamps of the containing Clusters, the Frames of all views have correct
+     * timestamps. The returned views do not share any state, so they can be iterated concurrently, e.g. to process
+     * the Frames of a Track on multiple threads without copying them first.
+     *
+     * NOTE: Views reading the Clusters on demand from a ClusterCache cannot be split and are returned as-is.
+     */
+    std::vector<FrameView> split(std::size_t numParts) const;
+
   private:
     std::span<const Cluster> clusters;
+    ClusterCache *clusterCache;
     uint32_t trackNumber;
     TrackTimescale timescale;
     TrackTimestamp<> startTime;
+    /** Only set if this view shares the ownership of the ClusterCache */
+    std::shared_ptr<ClusterCache> ownedCache;
+  };
+
+  /**
+   * Compact index of the Frames of a single Track stored in the Clusters of a Matroska object.
+   *
+   * The properties of all Frames are stored as contiguous arrays (struct-of-arrays), which allows for iterating the
+   * Frames of a single Track, looking up keyframes and searching for timestamps without accessing the Blocks of any
+   * other Track. The Frames are indexed in the same order as produced by the FrameView for the same Track.
+   *
+   * NOTE: Since the index references the Frame data of the indexed Blocks, the originating Matroska object SHOULD NOT
+   * be modified/moved while the index is accessed!
+   */
+  class FrameIndex {
+  public:
+    FrameIndex() noexcept = default;
+    FrameIndex(std::span<const Cluster> clusters, uint32_t track, const TrackTimescale &scale);
+
+    /**
+     * Returns the number of indexed Frames.
+     */
+    std::size_t size() const noexcept { return timestamps.size(); }
+    bool empty() const noexcept { return timestamps.empty(); }
+
+    /**
+     * Returns the number of the indexed Track.
+     */
+    uint32_t track() const noexcept { return trackNumber; }
+
+    /**
+     * Returns the timestamp of the Block containing the Frame at the given index.
+     */
+    TrackTimestamp<> timestamp(std::size_t index) const noexcept { return TrackTimestamp<>{timestamps[index]}; }
+
+    /**
+     * Returns whether the Frame at the given index is contained in a keyframe Block, i.e. a SimpleBlock with the
+     * keyframe flag set or a BlockGroup without any ReferenceBlock.
+     */
+    bool isKeyframe(std::size_t index) const noexcept { return keyframes[index] != 0; }
+
+    /**
+     * Returns the index of the Frame at the given index within its (laced) Block.
+     */
+    uint8_t laceIndex(std::size_t index) const noexcept { return laceIndices[index]; }
+
+    /**
+     * Returns the data (or the position of the data) of the Frame at the given index.
+     */
+    const DataRange &data(std::size_t index) const noexcept { return *frameData[index]; }
+
+    /**
+     * Returns the Frame at the given index, same as produced by the FrameView.
+     */
+    Frame operator[](std::size_t index) const noexcept;
+
+    /**
+     * Returns the index of the Frame a FrameView for the given start timestamp starts at, i.e. of the next Frame with
+     * a timestamp not smaller than the given value, or size() if there is no such Frame.
+     *
+     * NOTE: Same as for the FrameView, only the Blocks starting with the last Cluster with a timestamp smaller than
+     * the given value are searched.
+     */
+    std::size_t lowerBound(const TrackTimestamp<> &start) const noexcept;
+
+    /**
+     * Returns the index of the last keyframe not after the Frame returned by lowerBound() for the given timestamp and
+     * with a timestamp not larger than the given value, e.g. to start decoding at to access the Frame at the given
+     * timestamp.
+     *
+     * Returns an empty optional value if there is no such keyframe.
+     */
+    std::optional<std::size_t> findKeyframe(const TrackTimestamp<> &time) const noexcept;
+
+    /**
+     * Returns a random-access view producing the indexed Frames, starting at the Frame returned by lowerBound() for
+     * the given start timestamp.
+     */
+    auto frames(const TrackTimestamp<> &start = {}) const {
+      return std::views::iota(start.value ? lowerBound(start) : 0U, size()) |
+             std::views::transform([this](std::size_t index) { return (*this)[index]; });
+    }
+
+  private:
+    /** The timestamps of the Blocks containing the Frames */
+    std::vector<uintmax_t> timestamps;
+    std::vector<const DataRange *> frameData;
+    std::vector<uint8_t> laceIndices;
+    std::vector<uint8_t> keyframes;
+    /** The timestamps of all indexed Clusters and the index of their first Frame, for searching by timestamp */
+    std::vector<uintmax_t> clusterTimestamps;
+    std::vector<std::size_t> clusterFrames;
+    TrackTimescale timescale{};
+    uint32_t trackNumber = 0;
+  };
+
+  /**
+   * Single-pass reader producing the Frames of all Tracks directly while reading the Matroska stream.
+   *
+   * Other than the FrameView, this reader does not require the whole Matroska container to be read first. The Blocks
+   * are read one-by-one and discarded directly after producing their Frames. All other (metadata) Elements are read
+   * into the associated Matroska object, so e.g. the Tracks are available after the first Frame is produced.
+   *
+   * Depending on the options used for reading, the data of the produced Frames is either owned by the Frame, borrowed
+   * from the ReadOptions#mediaDataSource or only tracks the position of the data relative to the reader's byte source.
+   *
+   * NOTE: Since this reader modifies the associated Matroska object in-place, it MUST NOT outlive the Matroska object
+   * and the underlying BitReader, and the Matroska object SHOULD NOT be modified/moved in the meantime!
+   *
+   * NOTE: No CRC-32 of the Segment and the Clusters is validated, since their members are not retained.
+   */
+  class FrameStream {
+  public:
+    class promise_type;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    FrameStream(handle_type h) : handle(h) {}
+    FrameStream(const FrameStream &) = delete;
+    FrameStream(FrameStream &&other) noexcept : handle(std::exchange(other.handle, {})) {}
+    ~FrameStream();
+
+    FrameStream &operator=(const FrameStream &) = delete;
+    FrameStream &operator=(FrameStream &&other) noexcept {
+      std::swap(handle, other.handle);
+      return *this;
+    }
+
+    /**
+     * Checks whether this reader is still active, i.e. the end of the Matroska container has not yet been reached.
+     */
+    explicit operator bool();
+
+    /**
+     * Reads up to the next Frame and returns it.
+     *
+     * Returns an empty optional if no more Frames can be read, i.e. the end of the Segment or the input data is
+     * reached.
+     */
+    std::optional<Frame> operator()();
+
+  private:
+    handle_type handle;
   };
 
   /**
@@ -116,4 +312,15 @@ namespace bml::ebml::mkv {
     return FillDataRange<Frame, std::reference_wrapper<std::istream>>{std::ref(input), &Frame::data};
   }
 
+  /**
+   * Returns a range adaptor using the given seekable input stream to amend the Frame's data, reading the data of
+   * successive Frames located close to each other with combined sequential reads.
+   *
+   * NOTE: The Frame's data borrows from a reused buffer and thus is only valid until the view's iterator is
+   * incremented!
+   */
+  inline BufferedFillDataRange<Frame> fillFrameDataBuffered(std::istream &input) noexcept {
+    return BufferedFillDataRange<Frame>{DataRangeBuffer{input}, &Frame::data};
+  }
+
 } // namespace bml::ebml::mkv
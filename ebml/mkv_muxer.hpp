@@ -0,0 +1,162 @@
+#pragma once
+
+#include "mkv.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+/**
+ * Types for reading/writing the container structure of the Matroska (MKV) media container format.
+ *
+ * See: https://www.matroska.org/technical/elements.html
+ */
+namespace bml::ebml::mkv {
+
+  /**
+   * Options for incrementally writing a Matroska stream with a Muxer.
+   */
+  struct MuxerOptions {
+    /**
+     * The number of Frame data bytes after which the current Cluster is closed and a new Cluster is started.
+     */
+    ByteCount maxClusterSize = ByteCount{5U * 1024U * 1024U};
+
+    /**
+     * The duration (in Segment Ticks) after which the current Cluster is closed and a new Cluster is started.
+     *
+     * NOTE: Independent of this value, a new Cluster is started whenever the timestamp of a Block cannot be represented
+     * relative to the current Cluster Timestamp.
+     */
+    uintmax_t maxClusterDuration = 5000;
+
+    /**
+     * Whether to write a Cues Element indexing the Clusters and a SeekHead referencing the Info, Tracks and Cues
+     * Elements when finalizing the Segment.
+     *
+     * NOTE: This is only applied for seekable outputs, since the SeekHead needs to be patched after the Cues are
+     * written.
+     */
+    bool writeIndex = true;
+  };
+
+  /**
+   * Incremental writer for a Matroska stream, writing the Blocks as they are added without keeping any Cluster in
+   * memory.
+   *
+   * On creation, the EBML header, the Segment header and the Info and Tracks Elements are written. Afterwards, Frames
+   * are written one at a time as SimpleBlocks into the current Cluster, which is closed on reaching the size or
+   * duration limits of the MuxerOptions.
+   *
+   * For live (non-seekable) outputs, the Segment and all Clusters are written with Unknown Data Size. For seekable
+   * outputs, space for the Element sizes and the SeekHead is reserved and the actual values are patched in when the
+   * Cluster is closed or the Segment is finalized. Until then, the reserved sizes are marked as unknown, so an
+   * incompletely written stream can still be read.
+   *
+   * NOTE: finalize() needs to be called explicitly to close the last Cluster and write the final sizes and the index
+   * Elements.
+   */
+  class Muxer {
+  public:
+    /**
+     * Creates a muxer writing a live stream to the given writer.
+     *
+     * NOTE: The writer needs to outlive this object!
+     */
+    Muxer(BitWriter &writer, const EBMLHeader &header, const Info &info, const Tracks &tracks,
+          MuxerOptions options = {});
+
+    /**
+     * Creates a muxer writing to the given output stream.
+     *
+     * If the output stream is seekable (i.e. tellp() returns a valid position), the sizes are patched into the
+     * written data. Otherwise a live stream is written.
+     *
+     * NOTE: The output stream needs to outlive this object!
+     */
+    Muxer(std::ostream &output, const EBMLHeader &header, const Info &info, const Tracks &tracks,
+          MuxerOptions options = {});
+
+    Muxer(const Muxer &) = delete;
+    Muxer(Muxer &&) noexcept = delete;
+    ~Muxer() noexcept;
+
+    Muxer &operator=(const Muxer &) = delete;
+    Muxer &operator=(Muxer &&) noexcept = delete;
+
+    /**
+     * Returns whether the sizes of the written Elements are patched in afterwards.
+     */
+    bool isSeekable() const noexcept { return output != nullptr; }
+
+    /**
+     * Writes the given Frame data as a SimpleBlock of the Track with the given number.
+     *
+     * The timestamp is the absolute timestamp of the Frame in Segment Ticks.
+     */
+    void writeFrame(uint32_t trackNumber, SegmentTimestamp<> timestamp, std::span<const std::byte> data,
+                    bool keyframe);
+
+    /**
+     * Writes the given SimpleBlock with the given absolute timestamp in Segment Ticks.
+     *
+     * The timestamp offset of the Block header is overwritten with the offset relative to the Cluster the Block is
+     * written to.
+     */
+    void writeBlock(SimpleBlock block, SegmentTimestamp<> timestamp);
+
+    /**
+     * Closes the current Cluster (if any), the next Block is written into a new Cluster.
+     */
+    void closeCluster();
+
+    /**
+     * Closes the current Cluster and finishes the Segment.
+     *
+     * For seekable outputs, this writes the Cues Element and patches the Segment size and the SeekHead.
+     *
+     * NOTE: No more Frames can be written afterwards.
+     */
+    void finalize();
+
+  private:
+    struct OpenCluster {
+      /** The position of the Cluster Element */
+      ByteCount position;
+      /** The position of the Cluster Data */
+      ByteCount dataStart;
+      SegmentTimestamp<> timestamp;
+      /** The number of Frame data bytes written into this Cluster */
+      ByteCount frameDataSize;
+      /** The Tracks which already have a Cue Point for this Cluster */
+      std::vector<uint32_t> indexedTracks;
+    };
+
+    void writeHeader(const EBMLHeader &header, const Info &info, const Tracks &tracks);
+    ByteCount position() const noexcept { return writer->position().divide<8>(); }
+    void openCluster(SegmentTimestamp<> timestamp);
+    void patch(ByteCount offset, std::span<const std::byte> data);
+    void patchSize(ByteCount sizePosition, ByteCount size);
+
+  private:
+    std::unique_ptr<BitWriter> ownedWriter;
+    BitWriter *writer;
+    /** The seekable output to patch the sizes into, if any */
+    std::ostream *output;
+    /** The position of the output stream corresponding to the start of the writer */
+    std::streamoff outputStart;
+    MuxerOptions muxerOptions;
+    ByteCount segmentDataStart;
+    ByteCount seekHeadPosition;
+    ByteCount seekHeadSize;
+    ByteCount infoPosition;
+    ByteCount tracksPosition;
+    std::optional<OpenCluster> cluster;
+    Cues cues;
+    bool finalized;
+  };
+
+} // namespace bml::ebml::mkv
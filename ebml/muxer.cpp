@@ -0,0 +1,191 @@
+#include "mkv_muxer.hpp"
+
+#include "buffer_pool.hpp"
+#include "helper.hpp"
+#include "internal.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace bml::ebml::mkv {
+
+  /** Number of bytes reserved for the Element Data Size of Elements whose size is patched in afterwards */
+  static constexpr ByteCount RESERVED_SIZE_BYTES = 8_bytes;
+  static constexpr uint64_t RESERVED_SIZE_MARKER = 0x0100000000000000ULL;
+
+  static void writeOpenElementHeader(BitWriter &writer, ElementId id, bool reserveSize) {
+    const auto idValue = static_cast<std::underlying_type_t<ElementId>>(id);
+    writer.write(idValue, bml::ebml::detail::requiredBytes(idValue));
+    if (reserveSize) {
+      // Reserve the longest VINT with all value bits set (i.e. Unknown Data Size) to patch in the actual size later
+      writer.write((RESERVED_SIZE_MARKER << 1U) - 1U, RESERVED_SIZE_BYTES);
+    } else {
+      // Single byte VINT with all value bits set, i.e. Unknown Data Size
+      writer.writeByte(std::byte{0xFF});
+    }
+  }
+
+  Muxer::Muxer(BitWriter &writer, const EBMLHeader &header, const Info &info, const Tracks &tracks,
+               MuxerOptions options)
+      : writer(&writer), output(nullptr), outputStart(0), muxerOptions(options), finalized(false) {
+    writeHeader(header, info, tracks);
+  }
+
+  Muxer::Muxer(std::ostream &output, const EBMLHeader &header, const Info &info, const Tracks &tracks,
+               MuxerOptions options)
+      : ownedWriter(std::make_unique<BitWriter>(output)), writer(ownedWriter.get()), output(nullptr), outputStart(0),
+        muxerOptions(options), finalized(false) {
+    if (auto start = output.tellp(); start != std::ostream::pos_type(-1)) {
+      this->output = &output;
+      outputStart = start;
+    }
+    writeHeader(header, info, tracks);
+  }
+
+  Muxer::~Muxer() noexcept = default;
+
+  void Muxer::writeHeader(const EBMLHeader &header, const Info &info, const Tracks &tracks) {
+    header.write(*writer);
+    writeOpenElementHeader(*writer, Segment::ID, isSeekable());
+    segmentDataStart = position();
+
+    if (isSeekable() && muxerOptions.writeIndex) {
+      // Reserve the space for the SeekHead with the largest possible positions, the actual SeekHead is written on
+      // finalize once all positions are known.
+      constexpr auto MAX_POSITION = std::numeric_limits<uintmax_t>::max();
+      const std::array positions{std::make_pair(Info::ID, MAX_POSITION), std::make_pair(Tracks::ID, MAX_POSITION),
+                                 std::make_pair(Cues::ID, MAX_POSITION)};
+      BitWriter sizeWriter{BitWriter::DISCARD};
+      createSeekHead(positions).write(sizeWriter);
+      // Any space not used by the actual SeekHead needs to fit a Void Element of at least 2 bytes
+      seekHeadPosition = position();
+      seekHeadSize = sizeWriter.position().divide<8>() + 2_bytes;
+      Void::fill(*writer, seekHeadSize);
+    }
+
+    infoPosition = position();
+    info.write(*writer);
+    tracksPosition = position();
+    tracks.write(*writer);
+  }
+
+  void Muxer::writeFrame(uint32_t trackNumber, SegmentTimestamp<> timestamp, std::span<const std::byte> data,
+                         bool keyframe) {
+    SimpleBlock block{};
+    block.header.trackNumber = trackNumber;
+    block.header.keyframe = keyframe;
+    block.frameDataRanges.emplace_back(data);
+    writeBlock(std::move(block), timestamp);
+  }
+
+  void Muxer::writeBlock(SimpleBlock block, SegmentTimestamp<> timestamp) {
+    if (finalized) {
+      throw std::logic_error("Cannot write Blocks into an already finalized Segment");
+    }
+
+    if (cluster) {
+      auto offset = static_cast<intmax_t>(timestamp.value) - static_cast<intmax_t>(cluster->timestamp.value);
+      if (offset < std::numeric_limits<int16_t>::min() || offset > std::numeric_limits<int16_t>::max() ||
+          (offset >= 0 && static_cast<uintmax_t>(offset) >= muxerOptions.maxClusterDuration) ||
+          cluster->frameDataSize >= muxerOptions.maxClusterSize) {
+        closeCluster();
+      }
+    }
+    if (!cluster) {
+      openCluster(timestamp);
+    }
+
+    block.header.timestampOffset =
+        static_cast<int16_t>(static_cast<intmax_t>(timestamp.value) - static_cast<intmax_t>(cluster->timestamp.value));
+
+    const auto trackNumber = static_cast<uint32_t>(block.header.trackNumber.get());
+    if (isSeekable() && muxerOptions.writeIndex && block.header.keyframe &&
+        std::find(cluster->indexedTracks.begin(), cluster->indexedTracks.end(), trackNumber) ==
+            cluster->indexedTracks.end()) {
+      // Index the first keyframe of every Track within each Cluster, same as Segment::write()
+      CueTrackPositions positions{};
+      positions.cueTrack = trackNumber;
+      positions.cueClusterPosition = (cluster->position - segmentDataStart).value();
+      positions.cueRelativePosition = (position() - cluster->dataStart).value();
+      CuePoint point{};
+      // The Cue Time is written in Segment Ticks, just like the Cluster Timestamp
+      point.cueTime = MatroskaTimestamp{timestamp.value};
+      point.cueTrackPositions.push_back(std::move(positions));
+      cues.cuePoints.push_back(std::move(point));
+      cluster->indexedTracks.push_back(trackNumber);
+    }
+
+    block.write(*writer);
+    cluster->frameDataSize =
+        std::accumulate(block.frameDataRanges.begin(), block.frameDataRanges.end(), cluster->frameDataSize,
+                        [](ByteCount sum, const DataRange &range) { return sum + range.numBytes(); });
+  }
+
+  void Muxer::openCluster(SegmentTimestamp<> timestamp) {
+    const auto clusterPosition = position();
+    writeOpenElementHeader(*writer, Cluster::ID, isSeekable());
+    cluster = OpenCluster{clusterPosition, position(), timestamp, 0_bytes, {}};
+
+    decltype(Cluster::timestamp) timestampElement{timestamp};
+    timestampElement.write(*writer);
+  }
+
+  void Muxer::closeCluster() {
+    if (!cluster) {
+      return;
+    }
+    if (isSeekable()) {
+      patchSize(cluster->dataStart - RESERVED_SIZE_BYTES, position() - cluster->dataStart);
+    }
+    cluster.reset();
+  }
+
+  void Muxer::finalize() {
+    if (finalized) {
+      return;
+    }
+    closeCluster();
+
+    if (isSeekable()) {
+      if (muxerOptions.writeIndex) {
+        std::vector<std::pair<ElementId, uintmax_t>> positions{
+            {Info::ID, (infoPosition - segmentDataStart).value()},
+            {Tracks::ID, (tracksPosition - segmentDataStart).value()}};
+        if (!cues.cuePoints.empty()) {
+          positions.emplace_back(Cues::ID, (position() - segmentDataStart).value());
+          cues.write(*writer);
+        }
+
+        auto seekHeadData = WriteBufferPool::threadLocal().acquire(seekHeadSize);
+        BitWriter seekHeadWriter{*seekHeadData, BitWriter::GROW};
+        createSeekHead(positions).write(seekHeadWriter);
+        Void::fill(seekHeadWriter, seekHeadSize - seekHeadWriter.position().divide<8>());
+        seekHeadWriter.flush();
+        patch(seekHeadPosition, seekHeadData.bytes());
+      }
+      patchSize(segmentDataStart - RESERVED_SIZE_BYTES, position() - segmentDataStart);
+    }
+    writer->flush();
+    finalized = true;
+  }
+
+  void Muxer::patch(ByteCount offset, std::span<const std::byte> data) {
+    const auto end = output->tellp();
+    output->seekp(outputStart + static_cast<std::streamoff>(offset.value()));
+    output->write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+    output->seekp(end);
+    if (!*output) {
+      throw std::ios_base::failure("Failed to patch the already written output data");
+    }
+  }
+
+  void Muxer::patchSize(ByteCount sizePosition, ByteCount size) {
+    std::array<std::byte, sizeof(uint64_t)> bytes{};
+    storeBigEndian(bytes.data(), RESERVED_SIZE_MARKER | size.value());
+    patch(sizePosition, bytes);
+  }
+} // namespace bml::ebml::mkv
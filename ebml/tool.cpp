@@ -1,13 +1,20 @@
 #include "mkv.hpp"
 
 #include "io.hpp"
+#include "mapped_file.hpp"
 #include "mkv_frames.hpp"
 #include "reader.hpp"
 
+#include <condition_variable>
 #include <cstdlib>
+#include <deque>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace bml::ebml;
 
@@ -16,13 +23,23 @@ static void printHelp() {
 The following options are available:
   -h, --help                  Print this help and exit
   -v, --validate              Validate CRC-32s on read
+  -m, --mmap                  Memory-map the input file and reference its media data without copying
   -p, --print                 Print the internal representation of the media structure
   -y, --yaml                  Print the media structure as YAML document
+  -s, --stream                Print the media structure (-p or -y) while reading, without keeping it in memory
   -i, --info                  Print the general information about the input media
   -l, --list-tracks           List all contained tracks and their generic properties
   -t, --track <num>           Select the given track for track-specific actions
   -tp, --track-private <file> Dump the selected track's codec private data (initialization) to the given file
-  -td, --track-data <file>    Dump the selected track's frame data to the given file)"
+  -td, --track-data <file>    Dump the selected track's frame data to the given file
+  -x, --extract <num>:<file>  Demux the frame data of the given track to the given file, can be given multiple times
+  -xa, --extract-all <prefix> Demux the frame data of all tracks to the files <prefix><track number>
+  -j, --jobs <num>            Write the demuxed frame data on the given number of background threads
+
+All tracks selected via -x and -xa are demuxed in a single sequential pass over the input file.
+
+With -s, the Segment and its Clusters are printed as lists of their members in the order they are read and only
+the first Blocks per Cluster are printed with -y. The CRC-32s of the Segment and the Clusters are not validated.)"
             << std::endl;
 }
 
@@ -36,6 +53,172 @@ static std::ostream *openOutput(std::string_view path, std::unique_ptr<std::ostr
   return cache.get();
 }
 
+/** Number of bytes of Frame data collected per Track before writing them to the output file */
+static constexpr std::size_t DEMUX_CHUNK_SIZE = 4U * 1024U * 1024U;
+/** Number of chunks queued per background thread before the demuxing waits for the writes to finish */
+static constexpr std::size_t MAX_QUEUED_CHUNKS = 8;
+
+/**
+ * Background thread writing the chunks of (multiple) Track outputs in the order they were queued.
+ */
+class WriteWorker {
+public:
+  WriteWorker() : worker([this]() { run(); }) {}
+  WriteWorker(const WriteWorker &) = delete;
+  WriteWorker(WriteWorker &&) noexcept = delete;
+  ~WriteWorker() noexcept {
+    {
+      std::lock_guard guard{mutex};
+      done = true;
+    }
+    condition.notify_all();
+    worker.join();
+  }
+
+  WriteWorker &operator=(const WriteWorker &) = delete;
+  WriteWorker &operator=(WriteWorker &&) noexcept = delete;
+
+  void push(std::ostream &output, std::vector<std::byte> &&chunk) {
+    std::unique_lock lock{mutex};
+    condition.wait(lock, [this]() { return chunks.size() < MAX_QUEUED_CHUNKS; });
+    chunks.emplace_back(&output, std::move(chunk));
+    lock.unlock();
+    condition.notify_all();
+  }
+
+private:
+  void run() {
+    std::unique_lock lock{mutex};
+    while (true) {
+      condition.wait(lock, [this]() { return done || !chunks.empty(); });
+      if (chunks.empty()) {
+        return;
+      }
+      auto [output, chunk] = std::move(chunks.front());
+      chunks.pop_front();
+      lock.unlock();
+      condition.notify_all();
+      output->write(reinterpret_cast<const char *>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+      lock.lock();
+    }
+  }
+
+private:
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::deque<std::pair<std::ostream *, std::vector<std::byte>>> chunks;
+  bool done = false;
+  // NOTE: Needs to be last to be started after all other members are initialized
+  std::thread worker;
+};
+
+/**
+ * Output of the demuxed Frame data of a single Track, collecting the Frame data into large chunks.
+ */
+struct TrackOutput {
+  std::string path;
+  std::unique_ptr<std::ostream> cache;
+  std::ostream *output = nullptr;
+  WriteWorker *worker = nullptr;
+  std::vector<std::byte> chunk;
+
+  void write(std::span<const std::byte> data) {
+    if (chunk.size() + data.size() > DEMUX_CHUNK_SIZE) {
+      flush();
+    }
+    if (data.size() >= DEMUX_CHUNK_SIZE && !worker) {
+      // Large Frames are directly written without copying them into the chunk first
+      output->write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+      return;
+    }
+    chunk.insert(chunk.end(), data.begin(), data.end());
+  }
+
+  void flush() {
+    if (chunk.empty()) {
+      return;
+    }
+    if (worker) {
+      worker->push(*output, std::move(chunk));
+      chunk = {};
+      chunk.reserve(DEMUX_CHUNK_SIZE);
+    } else {
+      output->write(reinterpret_cast<const char *>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+      chunk.clear();
+    }
+  }
+};
+
+/**
+ * Demuxes the Frame data of the selected Tracks (or all Tracks if the output prefix is set) into the associated output
+ * files in a single pass over the input.
+ */
+static bool demuxTracks(mkv::Matroska &mkv, bml::BitReader &reader, const ReadOptions &options,
+                        const std::map<uint32_t, std::string> &trackFiles, std::string_view allTracksPrefix,
+                        std::size_t numThreads) {
+  std::vector<std::unique_ptr<WriteWorker>> workers(numThreads);
+  for (auto &worker : workers) {
+    worker = std::make_unique<WriteWorker>();
+  }
+
+  std::map<uint32_t, TrackOutput> outputs{};
+  const auto openTrackOutput = [&](uint32_t trackNumber, std::string path) {
+    auto &output = outputs[trackNumber];
+    output.path = std::move(path);
+    output.output = openOutput(output.path, output.cache, false /* truncate */);
+    output.worker = workers.empty() ? nullptr : workers[(outputs.size() - 1U) % workers.size()].get();
+    output.chunk.reserve(DEMUX_CHUNK_SIZE);
+  };
+  for (const auto &[trackNumber, path] : trackFiles) {
+    openTrackOutput(trackNumber, path);
+  }
+
+  auto frameOptions = options;
+  // The input is only read sequentially, so the Frame data needs to be read with the Blocks
+  frameOptions.readMediaData = true;
+  auto frames = mkv.readFrames(reader, frameOptions);
+  bool allTracksOpened = allTracksPrefix.empty();
+  while (frames) {
+    auto frame = frames();
+    if (!frame) {
+      continue;
+    }
+    if (!allTracksOpened && mkv.segment.tracks) {
+      // The Tracks are always read before the first Frame
+      for (const auto &track : mkv.segment.tracks->trackEntries) {
+        const auto trackNumber = static_cast<uint32_t>(track.trackNumber.get());
+        if (!outputs.contains(trackNumber)) {
+          openTrackOutput(trackNumber, std::string{allTracksPrefix} + std::to_string(trackNumber));
+        }
+      }
+      allTracksOpened = true;
+    }
+    if (auto it = outputs.find(frame->trackNumber); it != outputs.end()) {
+      it->second.write(frame->data.data());
+    }
+  }
+
+  for (auto &[trackNumber, output] : outputs) {
+    output.flush();
+  }
+  // Wait for all queued chunks to be written
+  workers.clear();
+
+  bool success = true;
+  for (auto &[trackNumber, output] : outputs) {
+    output.output->flush();
+    if (!mkv.getTrackEntry(trackNumber)) {
+      std::cout << "The Track with the number " << trackNumber << " does not exist in the input file!" << std::endl;
+      success = false;
+    } else if (!*output.output) {
+      std::cout << "Failed to write the frame data of Track " << trackNumber << " to '" << output.path << "'!"
+                << std::endl;
+      success = false;
+    }
+  }
+  return success;
+}
+
 static void writeInfo(const mkv::Info &info) {
   std::cout << "Segment Info:" << std::endl;
   if (info.title) {
@@ -167,12 +350,17 @@ int main(int argc, char **argv) {
 
   bool printRaw = false;
   bool printYaml = false;
+  bool printStreaming = false;
   bool printInfo = false;
   bool printTracks = false;
+  bool mapInput = false;
   uint32_t trackNum = 0;
 
   std::string_view codecFile;
   std::string_view dataFile;
+  std::map<uint32_t, std::string> extractFiles;
+  std::string_view extractPrefix;
+  std::size_t numThreads = 0;
 
   ReadOptions options{};
   int i = 1;
@@ -184,12 +372,16 @@ int main(int argc, char **argv) {
       printRaw = true;
     } else if ("-y"sv == argv[i] || "--yaml"sv == argv[i]) {
       printYaml = true;
+    } else if ("-s"sv == argv[i] || "--stream"sv == argv[i]) {
+      printStreaming = true;
     } else if ("-i"sv == argv[i] || "--info"sv == argv[i]) {
       printInfo = true;
     } else if ("-l"sv == argv[i] || "--list-tracks"sv == argv[i]) {
       printTracks = true;
     } else if ("-v"sv == argv[i] || "--validate"sv == argv[i]) {
       options.validateCRC32 = true;
+    } else if ("-m"sv == argv[i] || "--mmap"sv == argv[i]) {
+      mapInput = true;
     } else if ("-t"sv == argv[i] || "--track"sv == argv[i]) {
       trackNum = static_cast<uint32_t>(std::stoul(argv[i + 1]));
       ++i;
@@ -199,6 +391,23 @@ int main(int argc, char **argv) {
     } else if ("-td"sv == argv[i] || "--track-data"sv == argv[i]) {
       dataFile = argv[i + 1];
       ++i;
+    } else if ("-x"sv == argv[i] || "--extract"sv == argv[i]) {
+      std::string_view selection{argv[i + 1]};
+      auto separator = selection.find(':');
+      if (separator == std::string_view::npos || separator == 0 || separator + 1 == selection.size()) {
+        std::cout << "Invalid track extraction, expected <num>:<file>: " << selection << std::endl;
+        printHelp();
+        return EXIT_FAILURE;
+      }
+      extractFiles[static_cast<uint32_t>(std::stoul(std::string{selection.substr(0, separator)}))] =
+          selection.substr(separator + 1);
+      ++i;
+    } else if ("-xa"sv == argv[i] || "--extract-all"sv == argv[i]) {
+      extractPrefix = argv[i + 1];
+      ++i;
+    } else if ("-j"sv == argv[i] || "--jobs"sv == argv[i]) {
+      numThreads = std::stoul(argv[i + 1]);
+      ++i;
     } else {
       std::cout << "Unknown option: " << argv[i] << std::endl;
       printHelp();
@@ -216,11 +425,71 @@ int main(int argc, char **argv) {
     return EXIT_FAILURE;
   }
 
-  std::ifstream fis{argv[argc - 1]};
-  auto &input = argv[argc - 1] == "-"sv || argv[argc - 1] == "/dev/stdin"sv ? std::cin : fis;
-  bml::BitReader reader{input};
+  const auto demux = !extractFiles.empty() || !extractPrefix.empty();
+  if (demux && (printRaw || printYaml || !dataFile.empty())) {
+    std::cout << "Demuxing tracks cannot be combined with printing the media structure or dumping track data!"
+              << std::endl;
+    printHelp();
+    return EXIT_FAILURE;
+  }
+
+  if (printStreaming && (!(printRaw || printYaml) || printInfo || printTracks || trackNum || options.validateCRC32)) {
+    std::cout << "Streaming the media structure requires printing it and cannot be combined with other options or "
+                 "validating CRC-32s!"
+              << std::endl;
+    printHelp();
+    return EXIT_FAILURE;
+  }
+
+  const auto readStdin = argv[argc - 1] == "-"sv || argv[argc - 1] == "/dev/stdin"sv;
+  if (mapInput && readStdin) {
+    std::cout << "Memory-mapping requires a regular input file!" << std::endl;
+    printHelp();
+    return EXIT_FAILURE;
+  }
+
+  bml::MappedFile mapped{};
+  std::ifstream fis{};
+  if (mapInput) {
+    mapped = bml::MappedFile{argv[argc - 1]};
+    options.mediaDataSource = mapped.data();
+  } else if (!readStdin) {
+    fis.open(argv[argc - 1]);
+  }
+  auto &input = readStdin ? std::cin : fis;
+  auto reader = mapInput ? bml::BitReader{mapped.data()} : bml::BitReader{input, bml::BitReader::DEFAULT_READ_AHEAD};
+  if (printStreaming) {
+    // Print the Elements directly while reading the input, without building the object tree
+    std::ios::sync_with_stdio(false);
+    if (printYaml) {
+      bml::yaml::Options opts{};
+      opts.flags = bml::yaml::PrintFlags::HIDE_EMPTY | bml::yaml::PrintFlags::HIDE_DEFAULT;
+      mkv::Matroska::printYAML(std::cout, reader, options, opts) << std::endl;
+    } else {
+      mkv::Matroska::print(std::cout, reader, options) << std::endl;
+    }
+    return EXIT_SUCCESS;
+  }
+
   mkv::Matroska mkv{};
-  mkv.read(reader, options);
+  std::optional<mkv::ClusterCache> clusters{};
+  if (demux) {
+    // Only read the metadata and produce the Frames of all Tracks while reading the Clusters
+    if (!demuxTracks(mkv, reader, options, extractFiles, extractPrefix, numThreads)) {
+      return EXIT_FAILURE;
+    }
+  } else if (!printRaw && !printYaml && reader.isSeekable()) {
+    // Only read the metadata via the SeekHead, any Cluster required is read on demand
+    const auto dataStart = mkv.readIndexed(reader, options);
+    if (!dataFile.empty()) {
+      auto clusterOptions = options;
+      // The input stream is shared with the reader, so the Frame data needs to be read with the Clusters
+      clusterOptions.readMediaData = true;
+      clusters.emplace(reader, dataStart, mkv.segment, mkv::ClusterCache::DEFAULT_CAPACITY, clusterOptions);
+    }
+  } else {
+    mkv.read(reader, options);
+  }
 
   if (trackNum && !codecFile.empty()) {
     if (const auto *track = mkv.getTrackEntry(trackNum)) {
@@ -244,10 +513,19 @@ int main(int argc, char **argv) {
     }
     std::unique_ptr<std::ostream> tmp{};
     auto *out = openOutput(dataFile, tmp, dataFile == codecFile);
-    auto frames = mkv.viewFrames(trackNum) | mkv::fillFrameData(input);
-    for (const auto &frame : frames) {
-      auto data = frame.data.data();
-      out->write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+    auto dumpFrames = [out](auto &&frames) {
+      for (const auto &frame : frames) {
+        auto data = frame.data.data();
+        out->write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+      }
+    };
+    if (clusters) {
+      dumpFrames(mkv.viewFrames(*clusters, trackNum));
+    } else if (mapInput) {
+      // The frame data already references the mapped file contents
+      dumpFrames(mkv.viewFrames(trackNum));
+    } else {
+      dumpFrames(mkv.viewFrames(trackNum) | mkv::fillFrameDataBuffered(input));
     }
 
     out->flush();
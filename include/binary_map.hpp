@@ -7,13 +7,16 @@
 #include "writer.hpp"
 
 #include <array>
+#include <bit>
 #include <concepts>
 #include <cstdint>
 #include <cstdlib>
 #include <limits>
+#include <ranges>
 #include <sstream>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
 
 namespace bml {
 
@@ -23,8 +26,10 @@ namespace bml {
 
   template <typename T>
   struct MapElementary {
-    static T read(BitReader &reader, BitCount numBits);
-    static void write(BitWriter &writer, const T &value, BitCount numBits);
+    template <detail::BitSource Reader>
+    static constexpr T read(Reader &reader, BitCount numBits);
+    template <detail::BitSink Writer>
+    static constexpr void write(Writer &writer, const T &value, BitCount numBits);
     static T readExpGolomb(BitReader &reader);
     static void writeExpGolomb(BitWriter &writer, const T &value);
     static T readFibonacci(BitReader &reader);
@@ -33,8 +38,10 @@ namespace bml {
 
   template <typename T, typename M>
   struct MapContainer {
-    static T read(BitReader &reader, const M &readElement, std::size_t numElements);
-    static void write(BitWriter &writer, const T &value, const M &writeElement, std::size_t numElements);
+    template <detail::BitSource Reader>
+    static constexpr T read(Reader &reader, const M &readElement, std::size_t numElements);
+    template <detail::BitSink Writer>
+    static constexpr void write(Writer &writer, const T &value, const M &writeElement, std::size_t numElements);
   };
 
   template <typename T>
@@ -220,6 +227,81 @@ namespace bml {
       return mapper.fixedSize();
     }
 
+    template <typename T>
+    struct IsCompileTimeValue : std::false_type {};
+
+    template <auto Value>
+    struct IsCompileTimeValue<CompileTimeValueHolder<Value>> : std::true_type {};
+
+    template <typename T>
+    concept PackableType = std::integral<T> || std::is_enum_v<T>;
+
+    /**
+     * Converts the lower bits of the given packed value to the given integral or enum type.
+     *
+     * NOTE: This matches the conversion done by MapElementary<T>::read().
+     */
+    template <PackableType T>
+    constexpr T fromPackedBits(std::uintmax_t bits) noexcept {
+      if constexpr (std::signed_integral<T>) {
+        return std::bit_cast<T>(static_cast<std::make_unsigned_t<T>>(bits));
+      } else {
+        return static_cast<T>(bits);
+      }
+    }
+
+    /**
+     * Converts the given integral or enum value to its lower given number of bits to be packed with other values.
+     */
+    template <PackableType T>
+    constexpr std::uintmax_t toPackedBits(const T &value, BitCount numBits) noexcept {
+      std::uintmax_t bits;
+      if constexpr (std::is_enum_v<T>) {
+        bits = toPackedBits(static_cast<std::underlying_type_t<T>>(value), numBits);
+      } else if constexpr (std::signed_integral<T>) {
+        bits = static_cast<std::uintmax_t>(std::bit_cast<std::make_unsigned_t<T>>(value));
+      } else {
+        bits = static_cast<std::uintmax_t>(value);
+      }
+      return bits & numBits.mask();
+    }
+
+    /**
+     * Mask and expected value of the bits of packed fixed values to check.
+     */
+    struct PackedCheck {
+      std::uintmax_t mask = 0;
+      std::uintmax_t value = 0;
+    };
+
+    /**
+     * Concept checking whether the member mapper reads/writes a value of compile-time fixed size which can be packed
+     * together with the values of adjacent member mappers to be read/written at once.
+     */
+    template <typename T>
+    concept PackedMemberMapper = MemberMapper<T> && FixedSizeMapper<T> &&
+                                 requires(const T mapper, std::uintmax_t bits, typename T::object_type &object) {
+                                   requires IsCompileTimeValue<decltype(mapper.fixedSize())>::value;
+                                   mapper.readPacked(bits, object);
+                                   { mapper.writePacked(std::as_const(object)) } -> std::same_as<std::uintmax_t>;
+                                   { mapper.packedCheck() } -> std::same_as<PackedCheck>;
+                                   mapper.checkPackedBits(bits);
+                                   { T::packedAligned() } -> std::same_as<bool>;
+                                 };
+
+    /**
+     * Concept checking whether the simple value mapper can be used by a packed member mapper.
+     */
+    template <typename T>
+    concept PackedMapper = requires(const T mapper, std::uintmax_t bits, const typename T::type &value) {
+      requires IsCompileTimeValue<decltype(mapper.fixedSize())>::value;
+      { mapper.fromPackedBits(bits) } -> std::convertible_to<typename T::type>;
+      { mapper.toPackedBits(value) } -> std::same_as<std::uintmax_t>;
+      { mapper.packedCheck() } -> std::same_as<PackedCheck>;
+      mapper.checkPackedBits(bits);
+      { T::packedAligned() } -> std::same_as<bool>;
+    };
+
     /**
      * Marker type representing the product of a marker type with a constant.
      */
@@ -292,7 +374,8 @@ namespace bml {
 
       [[no_unique_address]] NumBitsHolder numBits;
 
-      auto operator()(BitReader &reader) const {
+      template <BitSource Reader>
+      constexpr auto operator()(Reader &reader) const {
         if constexpr (AssertByteAligned) {
           reader.assertAlignment(1_bytes);
         }
@@ -300,7 +383,8 @@ namespace bml {
         return MapElementary<T>::read(reader, numBits.value());
       }
 
-      auto operator()(BitWriter &writer, const T &value) const {
+      template <BitSink Writer>
+      constexpr auto operator()(Writer &writer, const T &value) const {
         if constexpr (AssertByteAligned) {
           writer.assertAlignment(1_bytes);
         }
@@ -308,6 +392,23 @@ namespace bml {
       }
 
       constexpr auto fixedSize() const noexcept { return numBits; }
+
+      // Interface for packing with other values, see PackedMapper
+      constexpr T fromPackedBits(std::uintmax_t bits) const noexcept
+        requires(PackableType<T> && IsCompileTimeValue<NumBitsHolder>::value)
+      {
+        return detail::fromPackedBits<T>(bits);
+      }
+
+      constexpr std::uintmax_t toPackedBits(const T &value) const noexcept
+        requires(PackableType<T> && IsCompileTimeValue<NumBitsHolder>::value)
+      {
+        return detail::toPackedBits(value, BitCount{numBits.value()});
+      }
+
+      constexpr PackedCheck packedCheck() const noexcept { return PackedCheck{}; }
+      constexpr void checkPackedBits(std::uintmax_t /* unused */) const noexcept {}
+      static constexpr bool packedAligned() noexcept { return AssertByteAligned; }
     };
 
     /**
@@ -321,17 +422,15 @@ namespace bml {
       [[no_unique_address]] FixedValueHolder fixedValue;
       [[no_unique_address]] NumBitsHolder numBits;
 
-      auto operator()(BitReader &reader) const {
+      template <BitSource Reader>
+      constexpr auto operator()(Reader &reader) const {
         if constexpr (AssertByteAligned) {
           reader.assertAlignment(1_bytes);
         }
         if constexpr (Checked) {
           auto actualValue = MapElementary<type>::read(reader, numBits.value());
           if (actualValue != fixedValue.value()) {
-            std::stringstream ss;
-            ss << "Invalid value in input, got " << printView(actualValue) << ", expected "
-               << printView(fixedValue.value()) << "!";
-            throw Ex{ss.str()};
+            throwInvalidValue(actualValue);
           }
         } else {
           reader.skip(numBits.value());
@@ -339,7 +438,8 @@ namespace bml {
         return fixedValue.value();
       }
 
-      auto operator()(BitWriter &writer, const type & /* ignored */) const {
+      template <BitSink Writer>
+      constexpr auto operator()(Writer &writer, const type & /* ignored */) const {
         if constexpr (AssertByteAligned) {
           writer.assertAlignment(1_bytes);
         }
@@ -347,6 +447,50 @@ namespace bml {
       }
 
       constexpr auto fixedSize() const noexcept { return numBits; }
+
+      // Interface for packing with other values, see PackedMapper
+      constexpr type fromPackedBits(std::uintmax_t /* unused */) const noexcept
+        requires(PackableType<type> && IsCompileTimeValue<NumBitsHolder>::value)
+      {
+        return fixedValue.value();
+      }
+
+      constexpr std::uintmax_t toPackedBits(const type & /* ignored */) const noexcept
+        requires(PackableType<type> && IsCompileTimeValue<NumBitsHolder>::value)
+      {
+        return detail::toPackedBits(fixedValue.value(), BitCount{numBits.value()});
+      }
+
+      constexpr PackedCheck packedCheck() const noexcept
+        requires(PackableType<type> && IsCompileTimeValue<NumBitsHolder>::value)
+      {
+        if constexpr (Checked) {
+          return PackedCheck{BitCount{numBits.value()}.mask(), toPackedBits(fixedValue.value())};
+        } else {
+          return PackedCheck{};
+        }
+      }
+
+      constexpr void checkPackedBits(std::uintmax_t bits) const
+        requires(PackableType<type> && IsCompileTimeValue<NumBitsHolder>::value)
+      {
+        if constexpr (Checked) {
+          auto actualValue = detail::fromPackedBits<type>(bits & BitCount{numBits.value()}.mask());
+          if (actualValue != fixedValue.value()) {
+            throwInvalidValue(actualValue);
+          }
+        }
+      }
+
+      static constexpr bool packedAligned() noexcept { return AssertByteAligned; }
+
+    private:
+      [[noreturn]] void throwInvalidValue(const type &actualValue) const {
+        std::stringstream ss;
+        ss << "Invalid value in input, got " << printView(actualValue) << ", expected " << printView(fixedValue.value())
+           << "!";
+        throw Ex{ss.str()};
+      }
     };
 
     template <typename T>
@@ -387,10 +531,12 @@ namespace bml {
       [[no_unique_address]] MemberHolder member;
       [[no_unique_address]] MapperHolder mapValue;
 
-      auto operator()(BitReader &reader, object_type &object) const {
+      template <BitSource Reader>
+      constexpr auto operator()(Reader &reader, object_type &object) const {
         return object.*(member.value()) = (mapValue.value())(reader);
       }
-      auto operator()(BitWriter &writer, const object_type &object) const {
+      template <BitSink Writer>
+      constexpr auto operator()(Writer &writer, const object_type &object) const {
         return (mapValue.value())(writer, object.*(member.value()));
       }
 
@@ -399,6 +545,37 @@ namespace bml {
       {
         return mapValue.value().fixedSize();
       }
+
+      // Interface for packing with other members, see PackedMemberMapper
+      constexpr void readPacked(std::uintmax_t bits, object_type &object) const
+        requires(PackedMapper<typename MapperHolder::type>)
+      {
+        object.*(member.value()) = mapValue.value().fromPackedBits(bits);
+      }
+
+      constexpr std::uintmax_t writePacked(const object_type &object) const
+        requires(PackedMapper<typename MapperHolder::type>)
+      {
+        return mapValue.value().toPackedBits(object.*(member.value()));
+      }
+
+      constexpr PackedCheck packedCheck() const noexcept
+        requires(PackedMapper<typename MapperHolder::type>)
+      {
+        return mapValue.value().packedCheck();
+      }
+
+      constexpr void checkPackedBits(std::uintmax_t bits) const
+        requires(PackedMapper<typename MapperHolder::type>)
+      {
+        mapValue.value().checkPackedBits(bits);
+      }
+
+      static constexpr bool packedAligned() noexcept
+        requires(PackedMapper<typename MapperHolder::type>)
+      {
+        return MapperHolder::type::packedAligned();
+      }
     };
 
     /**
@@ -412,15 +589,34 @@ namespace bml {
       [[no_unique_address]] MemberHolder member;
       [[no_unique_address]] NumBitsHolder numBits;
 
-      auto operator()(BitReader &reader, object_type &object) const {
+      template <BitSource Reader>
+      constexpr auto operator()(Reader &reader, object_type &object) const {
         return object.*(member.value()) = MapElementary<member_type>::read(reader, BitCount{numBits.value()});
       }
 
-      auto operator()(BitWriter &writer, const object_type &object) const {
+      template <BitSink Writer>
+      constexpr auto operator()(Writer &writer, const object_type &object) const {
         return MapElementary<member_type>::write(writer, object.*(member.value()), BitCount{numBits.value()});
       }
 
       constexpr auto fixedSize() const noexcept { return numBits; }
+
+      // Interface for packing with other members, see PackedMemberMapper
+      constexpr void readPacked(std::uintmax_t bits, object_type &object) const
+        requires(PackableType<member_type> && IsCompileTimeValue<NumBitsHolder>::value)
+      {
+        object.*(member.value()) = detail::fromPackedBits<member_type>(bits);
+      }
+
+      constexpr std::uintmax_t writePacked(const object_type &object) const
+        requires(PackableType<member_type> && IsCompileTimeValue<NumBitsHolder>::value)
+      {
+        return detail::toPackedBits(object.*(member.value()), BitCount{numBits.value()});
+      }
+
+      constexpr PackedCheck packedCheck() const noexcept { return PackedCheck{}; }
+      constexpr void checkPackedBits(std::uintmax_t /* unused */) const noexcept {}
+      static constexpr bool packedAligned() noexcept { return false; }
     };
 
     /**
@@ -436,11 +632,13 @@ namespace bml {
       [[no_unique_address]] SetterHolder setter;
       [[no_unique_address]] MapperHolder mapValue;
 
-      auto operator()(BitReader &reader, object_type &object) const {
+      template <BitSource Reader>
+      constexpr auto operator()(Reader &reader, object_type &object) const {
         return (object.*(setter.value()))((mapValue.value())(reader));
       }
 
-      auto operator()(BitWriter &writer, const object_type &object) const {
+      template <BitSink Writer>
+      constexpr auto operator()(Writer &writer, const object_type &object) const {
         return (mapValue.value())(writer, (object.*(getter.value()))());
       }
 
@@ -449,6 +647,37 @@ namespace bml {
       {
         return mapValue.value().fixedSize();
       }
+
+      // Interface for packing with other members, see PackedMemberMapper
+      constexpr void readPacked(std::uintmax_t bits, object_type &object) const
+        requires(PackedMapper<typename MapperHolder::type>)
+      {
+        (object.*(setter.value()))(mapValue.value().fromPackedBits(bits));
+      }
+
+      constexpr std::uintmax_t writePacked(const object_type &object) const
+        requires(PackedMapper<typename MapperHolder::type>)
+      {
+        return mapValue.value().toPackedBits((object.*(getter.value()))());
+      }
+
+      constexpr PackedCheck packedCheck() const noexcept
+        requires(PackedMapper<typename MapperHolder::type>)
+      {
+        return mapValue.value().packedCheck();
+      }
+
+      constexpr void checkPackedBits(std::uintmax_t bits) const
+        requires(PackedMapper<typename MapperHolder::type>)
+      {
+        mapValue.value().checkPackedBits(bits);
+      }
+
+      static constexpr bool packedAligned() noexcept
+        requires(PackedMapper<typename MapperHolder::type>)
+      {
+        return MapperHolder::type::packedAligned();
+      }
     };
 
     /**
@@ -464,15 +693,34 @@ namespace bml {
       [[no_unique_address]] SetterHolder setter;
       [[no_unique_address]] NumBitsHolder numBits;
 
-      auto operator()(BitReader &reader, object_type &object) const {
+      template <BitSource Reader>
+      constexpr auto operator()(Reader &reader, object_type &object) const {
         return (object.*(setter.value()))(MapElementary<member_type>::read(reader, BitCount{numBits.value()}));
       }
 
-      auto operator()(BitWriter &writer, const object_type &object) const {
+      template <BitSink Writer>
+      constexpr auto operator()(Writer &writer, const object_type &object) const {
         return MapElementary<member_type>::write(writer, (object.*(getter.value()))(), BitCount{numBits.value()});
       }
 
       constexpr auto fixedSize() const noexcept { return numBits; }
+
+      // Interface for packing with other members, see PackedMemberMapper
+      constexpr void readPacked(std::uintmax_t bits, object_type &object) const
+        requires(PackableType<member_type> && IsCompileTimeValue<NumBitsHolder>::value)
+      {
+        (object.*(setter.value()))(detail::fromPackedBits<member_type>(bits));
+      }
+
+      constexpr std::uintmax_t writePacked(const object_type &object) const
+        requires(PackableType<member_type> && IsCompileTimeValue<NumBitsHolder>::value)
+      {
+        return detail::toPackedBits((object.*(getter.value()))(), BitCount{numBits.value()});
+      }
+
+      constexpr PackedCheck packedCheck() const noexcept { return PackedCheck{}; }
+      constexpr void checkPackedBits(std::uintmax_t /* unused */) const noexcept {}
+      static constexpr bool packedAligned() noexcept { return false; }
     };
 
     /**
@@ -488,12 +736,14 @@ namespace bml {
       [[no_unique_address]] MapperHolder mapElement;
       [[no_unique_address]] SizeMemberHolder sizeMember;
 
-      auto operator()(BitReader &reader, object_type &object) const {
+      template <BitSource Reader>
+      constexpr auto operator()(Reader &reader, object_type &object) const {
         return object.*(member.value()) = MapContainer<member_type, typename MapperHolder::type>::read(
                    reader, mapElement.value(), object.*(sizeMember.value()));
       }
 
-      auto operator()(BitWriter &writer, const object_type &object) const {
+      template <BitSink Writer>
+      constexpr auto operator()(Writer &writer, const object_type &object) const {
         return MapContainer<member_type, typename MapperHolder::type>::write(
             writer, object.*(member.value()), mapElement.value(), object.*(sizeMember.value()));
       }
@@ -511,12 +761,14 @@ namespace bml {
       [[no_unique_address]] MemberHolder member;
       [[no_unique_address]] MapperHolder mapElement;
 
-      auto operator()(BitReader &reader, object_type &object) const {
+      template <BitSource Reader>
+      constexpr auto operator()(Reader &reader, object_type &object) const {
         return object.*(member.value()) =
                    MapContainer<member_type, typename MapperHolder::type>::read(reader, mapElement.value(), N);
       }
 
-      auto operator()(BitWriter &writer, const object_type &object) const {
+      template <BitSink Writer>
+      constexpr auto operator()(Writer &writer, const object_type &object) const {
         return MapContainer<member_type, typename MapperHolder::type>::write(writer, object.*(member.value()),
                                                                              mapElement.value(), N);
       }
@@ -540,6 +792,102 @@ namespace bml {
 
     template <Enum T>
     struct TypeBits<T> : TypeBits<std::underlying_type_t<T>> {};
+
+    template <typename Mapper>
+    constexpr BitCount packedNumBits() noexcept {
+      return BitCount{decltype(std::declval<const Mapper &>().fixedSize()){}};
+    }
+
+    /**
+     * Checks whether all given member mappers can be combined to read/write their values with a single access.
+     *
+     * This requires all members to be packable, to fit into a single std::uintmax_t value and any member asserting byte
+     * alignment to start at a byte boundary relative to the compound start.
+     */
+    template <typename... Mappers>
+    constexpr bool canPackMembers() noexcept {
+      if constexpr (sizeof...(Mappers) > 1 && (PackedMemberMapper<Mappers> && ...)) {
+        constexpr std::array<BitCount, sizeof...(Mappers)> SIZES{packedNumBits<Mappers>()...};
+        constexpr std::array<bool, sizeof...(Mappers)> ALIGNED{Mappers::packedAligned()...};
+        BitCount offset{};
+        for (std::size_t i = 0; i < sizeof...(Mappers); ++i) {
+          if (ALIGNED[i] && offset.value() % 8U != 0) {
+            return false;
+          }
+          offset += SIZES[i];
+        }
+        return offset <= BitCount{bits<std::uintmax_t>()};
+      } else {
+        return false;
+      }
+    }
+
+    /**
+     * Returns the number of bits the value of the member mapper at the given index needs to be shifted to the right
+     * within the combined packed value.
+     */
+    template <typename... Mappers>
+    constexpr std::array<std::size_t, sizeof...(Mappers)> packedShifts() noexcept {
+      constexpr std::array<BitCount, sizeof...(Mappers)> SIZES{packedNumBits<Mappers>()...};
+      std::array<std::size_t, sizeof...(Mappers)> shifts{};
+      BitCount remaining = (packedNumBits<Mappers>() + ...);
+      for (std::size_t i = 0; i < sizeof...(Mappers); ++i) {
+        remaining -= SIZES[i];
+        shifts[i] = remaining.value();
+      }
+      return shifts;
+    }
+
+    template <typename T, BitSource Reader, std::size_t... Indices, typename... Mappers>
+    constexpr T readPackedMembers(Reader &reader, std::index_sequence<Indices...> /* unused */,
+                                  const Mappers &...mappers) {
+      constexpr std::array<std::size_t, sizeof...(Mappers)> SHIFTS = packedShifts<Mappers...>();
+      if constexpr ((Mappers::packedAligned() || ...)) {
+        reader.assertAlignment(1_bytes);
+      }
+      auto bits = reader.read((packedNumBits<Mappers>() + ...));
+
+      PackedCheck check{};
+      (..., (check.mask |= mappers.packedCheck().mask << SHIFTS[Indices],
+             check.value |= mappers.packedCheck().value << SHIFTS[Indices]));
+      if ((bits & check.mask) != check.value) [[unlikely]] {
+        // Let the first mismatching member throw its error
+        (..., mappers.checkPackedBits(bits >> SHIFTS[Indices]));
+      }
+
+      T obj{};
+      (..., mappers.readPacked((bits >> SHIFTS[Indices]) & packedNumBits<Mappers>().mask(), obj));
+      return obj;
+    }
+
+    template <typename T, BitSink Writer, std::size_t... Indices, typename... Mappers>
+    constexpr void writePackedMembers(Writer &writer, const T &obj, std::index_sequence<Indices...> /* unused */,
+                                      const Mappers &...mappers) {
+      constexpr std::array<std::size_t, sizeof...(Mappers)> SHIFTS = packedShifts<Mappers...>();
+      if constexpr ((Mappers::packedAligned() || ...)) {
+        writer.assertAlignment(1_bytes);
+      }
+      std::uintmax_t bits = (... | (mappers.writePacked(obj) << SHIFTS[Indices]));
+      writer.write(bits, (packedNumBits<Mappers>() + ...));
+    }
+
+    /**
+     * Helper to check whether the given mapper reads/writes values of the given fixed-width type with all of their
+     * bytes, i.e. whether a contiguous list of such values can be read/written as big endian bytes all at once.
+     */
+    template <typename T, typename M>
+    struct BulkMapperHelper : std::false_type {
+      static constexpr bool isFullWidth(const M & /* unused */) noexcept { return false; }
+    };
+
+    template <BigEndianValue T, typename NumBitsHolder, bool AssertByteAligned>
+    struct BulkMapperHelper<T, MapTypedElementary<T, NumBitsHolder, AssertByteAligned>> : std::true_type {
+      using Mapper = MapTypedElementary<T, NumBitsHolder, AssertByteAligned>;
+
+      static constexpr bool isFullWidth(const Mapper &mapper) noexcept {
+        return BitCount{mapper.numBits.value()} == ByteCount{sizeof(T)};
+      }
+    };
   } // namespace detail
 
   /**
@@ -547,8 +895,10 @@ namespace bml {
    */
   template <std::unsigned_integral T>
   struct MapElementary<T> {
-    static T read(BitReader &reader, BitCount numBits) { return reader.read<T>(numBits); }
-    static void write(BitWriter &writer, const T &value, BitCount numBits) { writer.write(value, numBits); }
+    template <detail::BitSource Reader>
+    static constexpr T read(Reader &reader, BitCount numBits) { return reader.template read<T>(numBits); }
+    template <detail::BitSink Writer>
+    static constexpr void write(Writer &writer, const T &value, BitCount numBits) { writer.write(value, numBits); }
     static T readExpGolomb(BitReader &reader) { return reader.readExpGolomb<T>(); }
     static void writeExpGolomb(BitWriter &writer, const T &value) { writer.writeExpGolomb(value); }
     static T readFibonacci(BitReader &reader) { return reader.readFibonacci<T>(); }
@@ -560,10 +910,12 @@ namespace bml {
    */
   template <std::signed_integral T>
   struct MapElementary<T> {
-    static T read(BitReader &reader, BitCount numBits) {
-      return std::bit_cast<T>(reader.read<std::make_unsigned_t<T>>(numBits));
+    template <detail::BitSource Reader>
+    static constexpr T read(Reader &reader, BitCount numBits) {
+      return std::bit_cast<T>(reader.template read<std::make_unsigned_t<T>>(numBits));
     }
-    static void write(BitWriter &writer, const T &value, BitCount numBits) {
+    template <detail::BitSink Writer>
+    static constexpr void write(Writer &writer, const T &value, BitCount numBits) {
       writer.write(std::bit_cast<std::make_unsigned_t<T>>(value), numBits);
     }
     static T readExpGolomb(BitReader &reader) { return reader.readSignedExpGolomb<T>(); }
@@ -577,8 +929,10 @@ namespace bml {
    */
   template <Enum T>
   struct MapElementary<T> {
-    static T read(BitReader &reader, BitCount numBits) { return reader.read<T>(numBits); }
-    static void write(BitWriter &writer, T value, BitCount numBits) {
+    template <detail::BitSource Reader>
+    static constexpr T read(Reader &reader, BitCount numBits) { return reader.template read<T>(numBits); }
+    template <detail::BitSink Writer>
+    static constexpr void write(Writer &writer, T value, BitCount numBits) {
       return MapElementary<std::underlying_type_t<T>>::write(writer, std::bit_cast<std::underlying_type_t<T>>(value),
                                                              numBits);
     }
@@ -589,16 +943,32 @@ namespace bml {
    */
   template <DefaultConstructibleResizeableContainer T, typename M>
   struct MapContainer<T, M> {
-    static T read(BitReader &reader, const M &readElement, std::size_t numElements) {
+    using BulkHelper = detail::BulkMapperHelper<typename T::value_type, M>;
+
+    template <detail::BitSource Reader>
+    static constexpr T read(Reader &reader, const M &readElement, std::size_t numElements) {
       T container{};
       container.resize(numElements);
+      if constexpr (BulkHelper::value && std::ranges::contiguous_range<T>) {
+        if (BulkHelper::isFullWidth(readElement) && !(reader.position() % 1_bytes)) {
+          reader.readBigEndianInto(std::span{container});
+          return container;
+        }
+      }
       for (std::size_t i = 0; i < numElements; ++i) {
         container[i] = readElement(reader);
       }
       return container;
     }
 
-    static void write(BitWriter &writer, const T &value, const M &writeElement, std::size_t numElements) {
+    template <detail::BitSink Writer>
+    static constexpr void write(Writer &writer, const T &value, const M &writeElement, std::size_t numElements) {
+      if constexpr (BulkHelper::value && std::ranges::contiguous_range<T>) {
+        if (BulkHelper::isFullWidth(writeElement) && !(writer.position() % 1_bytes)) {
+          writer.writeBigEndian(std::span{value}.first(numElements));
+          return;
+        }
+      }
       for (std::size_t i = 0; i < numElements; ++i) {
         writeElement(writer, value[i]);
       }
@@ -610,16 +980,32 @@ namespace bml {
    */
   template <typename T, std::size_t N, typename M>
   struct MapContainer<std::array<T, N>, M> {
-    static std::array<T, N> read(BitReader &reader, const M &readElement, std::size_t numElements) {
+    using BulkHelper = detail::BulkMapperHelper<T, M>;
+
+    template <detail::BitSource Reader>
+    static constexpr std::array<T, N> read(Reader &reader, const M &readElement, std::size_t numElements) {
       std::array<T, N> container{};
+      if constexpr (BulkHelper::value) {
+        if (BulkHelper::isFullWidth(readElement) && !(reader.position() % 1_bytes)) {
+          reader.readBigEndianInto(std::span<T>{container}.first(numElements));
+          return container;
+        }
+      }
       for (std::size_t i = 0; i < numElements; ++i) {
         container[i] = readElement(reader);
       }
       return container;
     }
 
-    static void write(BitWriter &writer, const std::array<T, N> &value, const M &writeElement,
-                      std::size_t numElements) {
+    template <detail::BitSink Writer>
+    static constexpr void write(Writer &writer, const std::array<T, N> &value, const M &writeElement,
+                                std::size_t numElements) {
+      if constexpr (BulkHelper::value) {
+        if (BulkHelper::isFullWidth(writeElement) && !(writer.position() % 1_bytes)) {
+          writer.writeBigEndian(std::span<const T>{value}.first(numElements));
+          return;
+        }
+      }
       for (std::size_t i = 0; i < numElements; ++i) {
         writeElement(writer, value[i]);
       }
@@ -704,6 +1090,9 @@ namespace bml {
 
   /**
    * Maps the given type as Exponentional-Golomb encoded value.
+   *
+   * NOTE: Other than the fixed-size mappers, this mapper only supports the BitReader/BitWriter and therefore cannot be
+   * used in constant evaluation.
    */
   template <typename T>
   constexpr auto mapExpGolombBits() noexcept {
@@ -716,6 +1105,9 @@ namespace bml {
    * Maps the given type as UTF-8 encoded value.
    *
    * This mapper requires the input/output byte stream to be byte aligned.
+   *
+   * NOTE: Other than the fixed-size mappers, this mapper only supports the BitReader/BitWriter and therefore cannot be
+   * used in constant evaluation.
    */
   template <typename T = char32_t>
   constexpr auto mapUtf8Bytes() noexcept {
@@ -726,6 +1118,9 @@ namespace bml {
 
   /**
    * Maps the given type as (Nega-)Fibonacci encoded value.
+   *
+   * NOTE: Other than the fixed-size mappers, this mapper only supports the BitReader/BitWriter and therefore cannot be
+   * used in constant evaluation.
    */
   template <typename T>
   constexpr auto mapFibonacciBits() noexcept {
@@ -808,18 +1203,39 @@ namespace bml {
 
   /**
    * Maps the given compound type by applying all given mappers in-order.
+   *
+   * NOTE: If all members are of compile-time fixed size and fit into a single std::uintmax_t value in total (e.g. for
+   * packed header structures), all member values are read/written at once and then distributed to/gathered from the
+   * single members, requiring only a single access to the underlying reader/writer.
+   *
+   * NOTE: If all member mappers support it, the returned mapper also reads from a SpanReader and writes to a
+   * SpanWriter, which allows to decode and encode fixed binary data at compile-time.
    */
   template <typename T, MemberMapper... Mappers>
   constexpr auto mapCompound(Mappers... memberMappers) noexcept {
-    return detail::MapTyped{(detail::getFixedSize(memberMappers) + ...),
-                            [... mappers = std::forward<Mappers>(memberMappers)](BitReader &reader) {
-                              T obj{};
-                              (..., mappers(reader, obj));
-                              return obj;
-                            },
-                            [... mappers = std::forward<Mappers>(memberMappers)](BitWriter &writer, const T &obj) {
-                              (..., mappers(writer, obj));
-                            }};
+    if constexpr (detail::canPackMembers<Mappers...>()) {
+      return detail::MapTyped{(detail::getFixedSize(memberMappers) + ...),
+                              [... mappers = std::forward<Mappers>(memberMappers)](detail::BitSource auto &reader) {
+                                return detail::readPackedMembers<T>(reader, std::index_sequence_for<Mappers...>{},
+                                                                    mappers...);
+                              },
+                              [... mappers = std::forward<Mappers>(memberMappers)](detail::BitSink auto &writer,
+                                                                                   const T &obj) {
+                                detail::writePackedMembers(writer, obj, std::index_sequence_for<Mappers...>{},
+                                                           mappers...);
+                              }};
+    } else {
+      return detail::MapTyped{(detail::getFixedSize(memberMappers) + ...),
+                              [... mappers = std::forward<Mappers>(memberMappers)](detail::BitSource auto &reader) {
+                                T obj{};
+                                (..., mappers(reader, obj));
+                                return obj;
+                              },
+                              [... mappers = std::forward<Mappers>(memberMappers)](detail::BitSink auto &writer,
+                                                                                   const T &obj) {
+                                (..., mappers(writer, obj));
+                              }};
+    }
   }
 
   /**
@@ -1000,8 +1416,8 @@ namespace bml {
    * "Mapper" which does not read or write anything, just asserts that the current read/write position is byte-aligned.
    */
   constexpr auto assertByteAligned() noexcept {
-    return detail::MapSimple{[](BitReader &reader) { reader.assertAlignment(1_bytes); },
-                             [](BitWriter &writer) { writer.assertAlignment(1_bytes); },
+    return detail::MapSimple{[](detail::BitSource auto &reader) { reader.assertAlignment(1_bytes); },
+                             [](detail::BitSink auto &writer) { writer.assertAlignment(1_bytes); },
                              detail::CompileTimeValueHolder<0_bits>{}};
   }
 
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "binary_map.hpp"
+#include "errors.hpp"
+#include "sizes.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <tuple>
+#include <type_traits>
+
+namespace bml {
+
+  /**
+   * Read-only view on binary data of a compile-time fixed layout, decoding the single fields in place on access.
+   *
+   * The layout is defined by the given list of simple value mappers of compile-time fixed size which map the fields
+   * in-order, e.g. mapBits<uint8_t, 4_bits>(), mapBytes<uint16_t>() or mapCheckedFixedBits<0x47, 8_bits, Ex>(). The
+   * bit offsets of all fields are calculated at compile-time, so accessing a field via get() only loads the bytes
+   * covering this single field. No BitReader is involved and no object is constructed.
+   *
+   * This is useful if only a few fields of many binary structures (e.g. packet headers) are inspected, where reading
+   * the complete structure would waste most of the work.
+   *
+   * Unlike the readers, the view does not check fixed field values on access, see check().
+   *
+   * NOTE: The underlying memory range must be kept alive while the view is accessed, the memory is not copied!
+   */
+  template <auto... FieldMappers>
+    requires(sizeof...(FieldMappers) > 0 && (detail::PackedMapper<decltype(FieldMappers)> && ...))
+  class BitView {
+    static constexpr std::array<BitCount, sizeof...(FieldMappers)> SIZES{
+        detail::packedNumBits<decltype(FieldMappers)>()...};
+
+    static constexpr std::array<BitCount, sizeof...(FieldMappers)> calcOffsets() noexcept {
+      std::array<BitCount, sizeof...(FieldMappers)> offsets{};
+      for (std::size_t i = 1; i < offsets.size(); ++i) {
+        offsets[i] = offsets[i - 1U] + SIZES[i - 1U];
+      }
+      return offsets;
+    }
+
+    static constexpr std::array<BitCount, sizeof...(FieldMappers)> OFFSETS = calcOffsets();
+
+    static constexpr bool checkAlignment() noexcept {
+      constexpr std::array<bool, sizeof...(FieldMappers)> ALIGNED{decltype(FieldMappers)::packedAligned()...};
+      for (std::size_t i = 0; i < ALIGNED.size(); ++i) {
+        if (ALIGNED[i] && OFFSETS[i].value() % 8U != 0) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    static_assert(checkAlignment(), "Fields asserting byte alignment need to start at a byte boundary");
+
+  public:
+    using ByteRange = std::span<const std::byte>;
+
+    /**
+     * The number of fields of the mapped layout.
+     */
+    static constexpr std::size_t NUM_FIELDS = sizeof...(FieldMappers);
+
+    /**
+     * The type of the value of the field with the given index.
+     */
+    template <std::size_t Index>
+    using field_type = typename std::tuple_element_t<Index, std::tuple<decltype(FieldMappers)...>>::type;
+
+    /**
+     * Creates a view on the fields at the start of the given byte range.
+     *
+     * Throws an EndOfStreamError if the given range is too small to hold all fields.
+     */
+    constexpr explicit BitView(ByteRange range) : bytes(range.first(checkSize(range))) {}
+
+    /**
+     * Returns the number of bits of all fields combined.
+     */
+    static constexpr BitCount fixedSize() noexcept { return OFFSETS.back() + SIZES.back(); }
+
+    /**
+     * Returns the number of bytes covered by all fields combined, including any trailing unmapped bits of the last
+     * covered byte.
+     */
+    static constexpr ByteCount numBytes() noexcept { return ByteCount{(fixedSize().value() + 7U) / 8U}; }
+
+    /**
+     * Returns the offset of the field with the given index, relative to the start of the view.
+     */
+    template <std::size_t Index>
+    static constexpr BitCount offset() noexcept {
+      return OFFSETS[Index];
+    }
+
+    /**
+     * Returns the number of bits of the field with the given index.
+     */
+    template <std::size_t Index>
+    static constexpr BitCount fieldSize() noexcept {
+      return SIZES[Index];
+    }
+
+    /**
+     * Returns the underlying bytes covered by this view.
+     */
+    constexpr ByteRange data() const noexcept { return bytes; }
+
+    /**
+     * Decodes and returns the value of the field with the given index.
+     */
+    template <std::size_t Index>
+    constexpr field_type<Index> get() const noexcept {
+      return std::get<Index>(std::tuple{FieldMappers...}).fromPackedBits(extractBits<Index>());
+    }
+
+    /**
+     * Checks the values of all fixed-value fields (e.g. magic values) and throws the error of the first mismatching
+     * field, as configured by its mapper.
+     */
+    constexpr void check() const {
+      checkFields(std::index_sequence_for<decltype(FieldMappers)...>{});
+    }
+
+  private:
+    static constexpr std::size_t checkSize(ByteRange range) {
+      if (range.size() < numBytes().value()) {
+        throw EndOfStreamError("Byte range is too small for all fields of the view");
+      }
+      return numBytes().value();
+    }
+
+    template <std::size_t Index>
+    constexpr std::uintmax_t extractBits() const noexcept {
+      if constexpr (!SIZES[Index]) {
+        return 0;
+      } else {
+        constexpr auto DIGITS = static_cast<std::size_t>(std::numeric_limits<std::uintmax_t>::digits);
+        constexpr std::size_t FIRST_BYTE = OFFSETS[Index].value() / 8U;
+        constexpr std::size_t BIT_OFFSET = OFFSETS[Index].value() % 8U;
+        constexpr std::size_t NUM_BYTES = (BIT_OFFSET + SIZES[Index].value() + 7U) / 8U;
+        constexpr std::size_t LOADED_BYTES = std::min(NUM_BYTES, sizeof(std::uintmax_t));
+
+        // Load the covered bytes left-adjusted, the compilers combine this to a single (byte-swapped) load
+        std::uintmax_t word = 0;
+        for (std::size_t i = 0; i < LOADED_BYTES; ++i) {
+          word |= static_cast<std::uintmax_t>(bytes[FIRST_BYTE + i]) << (DIGITS - (i + 1U) * 8U);
+        }
+        word <<= BIT_OFFSET;
+        if constexpr (NUM_BYTES > LOADED_BYTES) {
+          // The field spans 9 bytes, fill the lower bits with the upper bits of the last byte
+          word |= static_cast<std::uintmax_t>(bytes[FIRST_BYTE + LOADED_BYTES]) >> (8U - BIT_OFFSET);
+        }
+        return word >> (DIGITS - SIZES[Index].value());
+      }
+    }
+
+    template <std::size_t... Indices>
+    constexpr void checkFields(std::index_sequence<Indices...> /* unused */) const {
+      (..., FieldMappers.checkPackedBits(extractBits<Indices>()));
+    }
+
+  private:
+    ByteRange bytes;
+  };
+
+} // namespace bml
@@ -1,9 +1,13 @@
 #pragma once
 
+#include "buffer_pool.hpp"
 #include "concepts.hpp"
 #include "data_range.hpp"
 #include "io.hpp"
+#include "mapped_file.hpp"
 #include "reader.hpp"
+#include "span_reader.hpp"
+#include "span_writer.hpp"
 #include "types.hpp"
 #include "writer.hpp"
 #include "yaml.hpp"
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "sizes.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace bml {
+
+  /**
+   * Pool of reusable byte buffers, e.g. for temporarily serializing data via a growing BitWriter.
+   *
+   * Acquiring a buffer reuses the memory of a previously released buffer, which avoids repeatedly allocating (and
+   * reallocating while growing) temporary buffers when serializing many small messages.
+   *
+   * Example:
+   *   auto buffer = WriteBufferPool::threadLocal().acquire(bml::numBits(message));
+   *   BitWriter writer{*buffer, BitWriter::GROW};
+   *   bml::write(writer, message);
+   *
+   * NOTE: A pool is not thread-safe, use the pool of the current thread (see threadLocal()) or a dedicated pool per
+   * thread instead!
+   */
+  class WriteBufferPool {
+  public:
+    /**
+     * An empty byte buffer acquired from a pool, which is returned to the pool on destruction.
+     *
+     * NOTE: The pool needs to outlive all buffers acquired from it!
+     */
+    class Buffer {
+    public:
+      Buffer(const Buffer &) = delete;
+      Buffer(Buffer &&other) noexcept;
+      ~Buffer() noexcept;
+
+      Buffer &operator=(const Buffer &) = delete;
+      Buffer &operator=(Buffer &&other) noexcept;
+
+      std::vector<std::byte> &operator*() noexcept { return data; }
+      const std::vector<std::byte> &operator*() const noexcept { return data; }
+      std::vector<std::byte> *operator->() noexcept { return &data; }
+      const std::vector<std::byte> *operator->() const noexcept { return &data; }
+
+      /**
+       * Returns the bytes written to this buffer.
+       */
+      std::span<const std::byte> bytes() const noexcept { return data; }
+
+    private:
+      Buffer(WriteBufferPool &owner, std::vector<std::byte> &&buffer) noexcept;
+
+      void release() noexcept;
+
+    private:
+      WriteBufferPool *pool;
+      std::vector<std::byte> data;
+
+      friend class WriteBufferPool;
+    };
+
+    /** The default maximum number of idle buffers kept by a pool */
+    static constexpr std::size_t DEFAULT_MAX_BUFFERS = 16;
+    /** The default maximum capacity of the buffers kept by a pool, larger buffers are freed on release */
+    static constexpr ByteCount DEFAULT_MAX_CAPACITY{1024 * 1024};
+
+    explicit WriteBufferPool(std::size_t maxBuffers = DEFAULT_MAX_BUFFERS,
+                             ByteCount maxCapacity = DEFAULT_MAX_CAPACITY) noexcept;
+
+    WriteBufferPool(const WriteBufferPool &) = delete;
+    WriteBufferPool(WriteBufferPool &&) noexcept = delete;
+    ~WriteBufferPool() noexcept = default;
+
+    WriteBufferPool &operator=(const WriteBufferPool &) = delete;
+    WriteBufferPool &operator=(WriteBufferPool &&) noexcept = delete;
+
+    /**
+     * Acquires an empty buffer with the capacity to store at least the given number of bits.
+     *
+     * The capacity hint is e.g. the binary size of the data to be written into the buffer, see bml::numBits().
+     * Preferably, an idle buffer already providing the requested capacity is reused.
+     */
+    Buffer acquire(BitCount capacityHint = 0_bits);
+
+    /**
+     * Returns the number of idle buffers currently available for reuse.
+     */
+    std::size_t numIdle() const noexcept { return idleBuffers.size(); }
+
+    /**
+     * Frees the memory of all idle buffers.
+     */
+    void clear() noexcept { idleBuffers.clear(); }
+
+    /**
+     * Returns the pool of the current thread.
+     */
+    static WriteBufferPool &threadLocal() noexcept;
+
+  private:
+    void release(std::vector<std::byte> &&buffer) noexcept;
+
+  private:
+    std::size_t maxBuffers;
+    ByteCount maxCapacity;
+    /** The idle buffers, the most recently released buffer last */
+    std::vector<std::vector<std::byte>> idleBuffers;
+  };
+
+} // namespace bml
@@ -3,7 +3,11 @@
 #include "helper.hpp"
 #include "sizes.hpp"
 
+#include <array>
+#include <deque>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <ranges>
 #include <span>
 #include <variant>
@@ -15,7 +19,7 @@ namespace bml {
    *
    * For performance and memory consumption reasons, data ranges can reference the underlying data in different ways
    * from simply keeping track of where in the original data source (e.g. a file) the underlying data is located to
-   * owning their own copy of the in-memory data.
+   * owning their own copy of the in-memory data or sharing the ownership of a larger in-memory data chunk.
    */
   class DataRange {
   public:
@@ -32,6 +36,10 @@ namespace bml {
        * The data range owns its own copy of its contained raw bytes.
        */
       OWNED,
+      /**
+       * The data range shares the ownership of the (reference-counted) memory containing its raw bytes.
+       */
+      SHARED,
     };
 
     constexpr DataRange() noexcept = default;
@@ -54,6 +62,16 @@ namespace bml {
      */
     DataRange(std::vector<std::byte> &&ownedRange) noexcept : content{std::move(ownedRange)} {}
 
+    /**
+     * Wraps a shared in-memory range of the given number of raw bytes starting at the given pointer.
+     *
+     * The given pointer might point into a larger reference-counted memory chunk (e.g. by using the aliasing
+     * constructor of std::shared_ptr), which allows for several data ranges to reference parts of the same memory
+     * chunk. The memory chunk is kept alive as long as any data range referencing it exists.
+     */
+    DataRange(std::shared_ptr<const std::byte> sharedRange, std::size_t size) noexcept
+        : content{SharedRange{std::move(sharedRange), size}} {}
+
     /** Delete to force disambiguation between borrowing and owning range constructors */
     DataRange(const std::vector<std::byte> &) = delete;
 
@@ -77,7 +95,8 @@ namespace bml {
     ByteCount numBytes() const noexcept;
 
     /**
-     * Returns whether this object directly references the underlying bytes, e.g. as a borrowed or owned byte range.
+     * Returns whether this object directly references the underlying bytes, e.g. as a borrowed, owned or shared byte
+     * range.
      *
      * A data range might refer to a specific range of data without having a reference to the data itself, in which case
      * the data range will not be empty(), but will return false here.
@@ -85,8 +104,8 @@ namespace bml {
     bool hasData() const noexcept;
 
     /**
-     * Returns the known data range or an empty range if this object does not store a known data range (e.g. BORROWED or
-     * OWNED modes).
+     * Returns the known data range or an empty range if this object does not store a known data range (e.g. BORROWED,
+     * OWNED or SHARED modes).
      */
     ByteRange byteRange() const noexcept;
 
@@ -104,8 +123,8 @@ namespace bml {
     /**
      * Returns a copy of this data range representing the same underlying bytes.
      *
-     * If this data range owns the underlying memory, a BORROWED range is returned referencing this range's data
-     * storage. If this data range does not own the referenced memory, a simple copy of this object is returned.
+     * If this data range owns or shares the underlying memory, a BORROWED range is returned referencing this range's
+     * data storage. If this data range does not own the referenced memory, a simple copy of this object is returned.
      *
      * NOTE: Since the returned range is borrowed, care needs to be taken to keep the underlying memory alive as long as
      * this data range is accessed.
@@ -118,15 +137,25 @@ namespace bml {
     using KnownRange = ByteRange;
     using BorrowedRange = std::span<const std::byte>;
     using OwnedRange = std::vector<std::byte>;
-    std::variant<KnownRange, BorrowedRange, OwnedRange> content;
+    struct SharedRange {
+      std::shared_ptr<const std::byte> memory;
+      std::size_t numBytes;
+
+      const std::byte *data() const noexcept { return memory.get(); }
+      const std::byte *begin() const noexcept { return memory.get(); }
+      const std::byte *end() const noexcept { return memory.get() + numBytes; }
+      std::size_t size() const noexcept { return numBytes; }
+      bool empty() const noexcept { return numBytes == 0; }
+    };
+    std::variant<KnownRange, BorrowedRange, OwnedRange, SharedRange> content;
   };
 
   /**
    * Fills the given input data range with the corresponding bytes extracted from the given input bytes.
    *
-   * Depending on the given target mode, the given data range is modified to borrow or own its referenced raw bytes as
-   * read from the given in-memory data. If the given data range's mode is stronger than the given target mode, the data
-   * range is not modified.
+   * Depending on the given target mode, the given data range is modified to borrow, own or share its referenced raw
+   * bytes as read from the given in-memory data. If the given data range's mode is stronger than the given target mode,
+   * the data range is not modified.
    *
    * NOTE: The given input bytes MUST MATCH the original raw bytes the given data range object was created over.
    *
@@ -141,7 +170,7 @@ namespace bml {
   /**
    * Fills the given input data range with the corresponding bytes extracted from the given input stream.
    *
-   * This function will convert all non-empty data ranges into OWNED data ranges.
+   * This function will convert all non-empty data ranges (except for the already SHARED ones) into OWNED data ranges.
    *
    * NOTE: The given input bytes MUST MATCH the original raw bytes the given data range object was created over.
    *
@@ -150,6 +179,171 @@ namespace bml {
    */
   void fillDataRange(DataRange &range, std::istream &input);
 
+  /**
+   * Reusable buffer for reading the bytes of (KNOWN) byte ranges from a seekable input stream.
+   *
+   * Instead of seeking to and reading every single byte range separately, byte ranges which are located close to each
+   * other in the input stream are read with a single sequential read into the internal buffer.
+   *
+   * NOTE: The data returned by this object is only valid until the next call to read()!
+   */
+  class DataRangeBuffer {
+  public:
+    /**
+     * Creates a buffer reading from the given seekable input stream.
+     *
+     * Following byte ranges are only read together with the requested byte range if their gap to the previous byte
+     * range is at most the given maximum gap and the total read size does not exceed the given maximum read size.
+     */
+    explicit DataRangeBuffer(std::istream &input, ByteCount maxGap = 4_bytes * 1024,
+                             ByteCount maxReadSize = 1_bytes * 1024 * 1024) noexcept
+        : inputStream(&input), maxGapSize(maxGap), maxBufferSize(maxReadSize) {}
+
+    /**
+     * Returns whether the bytes of the given byte range are already buffered.
+     */
+    bool contains(const ByteRange &range) const noexcept;
+
+    /**
+     * Returns the bytes of the given byte range, reading them from the input stream if they are not yet buffered.
+     *
+     * If the bytes need to be read, any of the given following byte ranges (in ascending order) that are close enough
+     * are read with the same read operation.
+     *
+     * NOTE: Throws an EndOfStreamError exception if the byte range lies outside of the input stream.
+     */
+    std::span<const std::byte> read(const ByteRange &range, std::span<const ByteRange> followingRanges = {});
+
+  private:
+    std::istream *inputStream;
+    ByteCount maxGapSize;
+    ByteCount maxBufferSize;
+    std::vector<std::byte> buffer;
+    ByteRange bufferedRange;
+  };
+
+  /**
+   * View for amending a DataRange parent object read from the underlying input range with the DataRange's data read
+   * from an input stream via a DataRangeBuffer.
+   *
+   * Compared to the FillDataRangeView, this view looks ahead of the current object and reads the data of subsequent
+   * (KNOWN) data ranges close to each other with a single sequential read. The produced DataRanges borrow from the
+   * reused buffer instead of owning a copy of their data.
+   *
+   * NOTE: The produced DataRange's data is only valid until the iterator is incremented!
+   *
+   * NOTE: The begin() member function can only be called once and the view MUST NOT be moved afterwards.
+   */
+  template <std::ranges::input_range V>
+  class BufferedFillDataRangeView : public std::ranges::view_interface<BufferedFillDataRangeView<V>> {
+    using ValueType = std::ranges::range_value_t<V>;
+    using MemberAccess = DataRange ValueType::*;
+
+    /** The number of objects to look ahead to combine their data reads */
+    static constexpr std::size_t LOOK_AHEAD = 32;
+
+    struct Sentinel {};
+
+    class Iterator {
+    public:
+      using value_type = ValueType;
+      using difference_type = std::ptrdiff_t;
+
+      explicit Iterator() noexcept = default;
+      explicit Iterator(BufferedFillDataRangeView &view) noexcept : parent(&view) {}
+
+      Iterator &operator++() {
+        parent->advance();
+        return *this;
+      }
+
+      void operator++(int) { parent->advance(); }
+
+      value_type operator*() const { return parent->pending.front(); }
+
+      friend bool operator==(const Sentinel &, const Iterator &it) noexcept { return it.atEnd(); }
+
+    private:
+      bool atEnd() const noexcept { return parent->pending.empty(); }
+
+    private:
+      BufferedFillDataRangeView *parent = nullptr;
+    };
+
+  public:
+    BufferedFillDataRangeView(V &&input, DataRangeBuffer buffer, MemberAccess member) noexcept
+        : inputRange(std::forward<V>(input)), dataBuffer(std::move(buffer)), dataMember(member) {}
+
+    Iterator begin() {
+      iterator = std::ranges::begin(inputRange);
+      fill();
+      return Iterator{*this};
+    }
+
+    Sentinel end() const noexcept { return Sentinel{}; }
+
+  private:
+    void advance() {
+      pending.pop_front();
+      fill();
+    }
+
+    void fill() {
+      while (pending.size() < LOOK_AHEAD && *iterator != std::ranges::end(inputRange)) {
+        pending.push_back(**iterator);
+        ++*iterator;
+      }
+      if (pending.empty()) {
+        return;
+      }
+
+      auto &range = pending.front().*dataMember;
+      if (range.mode() != DataRange::Mode::KNOWN) {
+        return;
+      }
+      auto byteRange = range.byteRange();
+      if (dataBuffer.contains(byteRange)) {
+        range = DataRange{dataBuffer.read(byteRange)};
+        return;
+      }
+
+      std::array<ByteRange, LOOK_AHEAD> followingRanges{};
+      std::size_t numFollowing = 0;
+      for (auto it = std::next(pending.begin()); it != pending.end(); ++it) {
+        followingRanges[numFollowing++] = ((*it).*dataMember).byteRange();
+      }
+      range = DataRange{dataBuffer.read(byteRange, std::span{followingRanges}.first(numFollowing))};
+    }
+
+  private:
+    V inputRange;
+    DataRangeBuffer dataBuffer;
+    MemberAccess dataMember;
+    std::optional<std::ranges::iterator_t<V>> iterator;
+    std::deque<ValueType> pending;
+  };
+
+  /**
+   * Range adaptor to produce a BufferedFillDataRangeView amending an input range with data read from an input stream.
+   */
+  template <typename T>
+  struct BufferedFillDataRange {
+    using MemberAccess = DataRange T::*;
+
+    template <std::ranges::input_range V>
+    friend BufferedFillDataRangeView<V> operator|(V &&range, const BufferedFillDataRange &adaptor) noexcept {
+      return adaptor(std::forward<V>(range));
+    }
+
+    template <std::ranges::input_range V>
+    BufferedFillDataRangeView<V> operator()(V &&range) const noexcept {
+      return BufferedFillDataRangeView<V>{std::forward<V>(range), dataBuffer, dataMember};
+    }
+
+    DataRangeBuffer dataBuffer;
+    MemberAccess dataMember;
+  };
+
   /**
    * View for amending a DataRange parent object read from the underlying input range with the DataRange's data
    * extracted from the associated data source.
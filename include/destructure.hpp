@@ -63,13 +63,13 @@ namespace bml::detail {
 
   struct untie {
     template <typename... Tn>
-    std::tuple<Tn...> operator()(Tn &...an) {
+    constexpr std::tuple<Tn...> operator()(Tn &...an) {
       return std::tuple<Tn...>(std::move(an)...);
     }
   };
 
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 63>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -83,7 +83,7 @@ namespace bml::detail {
   }
 
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 62>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -96,7 +96,7 @@ namespace bml::detail {
   }
 
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 61>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -107,7 +107,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 60>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -118,7 +118,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 59>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -129,7 +129,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 58>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -140,7 +140,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 57>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -151,7 +151,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 56>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -162,7 +162,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 55>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -173,7 +173,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 54>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -184,7 +184,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 53>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -195,7 +195,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 52>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -206,7 +206,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46, m47, m48, m49, m50, m51);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 51>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -217,7 +217,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46, m47, m48, m49, m50);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 50>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -228,7 +228,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46, m47, m48, m49);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 49>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -239,7 +239,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46, m47, m48);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 48>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -250,7 +250,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46, m47);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 47>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -261,7 +261,7 @@ namespace bml::detail {
                     m42, m43, m44, m45, m46);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 46>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -272,7 +272,7 @@ namespace bml::detail {
                     m42, m43, m44, m45);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 45>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -283,7 +283,7 @@ namespace bml::detail {
                     m42, m43, m44);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 44>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -294,7 +294,7 @@ namespace bml::detail {
                     m42, m43);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 43>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -305,7 +305,7 @@ namespace bml::detail {
                     m42);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 42>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -315,7 +315,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 41>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -325,7 +325,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 40>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -334,7 +334,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 39>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -343,7 +343,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 38>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -352,7 +352,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 37>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -361,7 +361,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 36>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -370,7 +370,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 35>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -379,7 +379,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 34>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -388,7 +388,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 33>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -397,7 +397,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 32>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -406,7 +406,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27, m28, m29, m30, m31);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 31>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -415,7 +415,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27, m28, m29, m30);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 30>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -424,7 +424,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27, m28, m29);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 29>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -433,7 +433,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27, m28);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 28>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -442,7 +442,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26, m27);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 27>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -451,7 +451,7 @@ namespace bml::detail {
                     m22, m23, m24, m25, m26);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 26>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -460,7 +460,7 @@ namespace bml::detail {
                     m22, m23, m24, m25);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 25>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -469,7 +469,7 @@ namespace bml::detail {
                     m22, m23, m24);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 24>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22,
@@ -478,7 +478,7 @@ namespace bml::detail {
                     m22, m23);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 23>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22] =
@@ -487,7 +487,7 @@ namespace bml::detail {
                     m22);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 22>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21] =
@@ -495,7 +495,7 @@ namespace bml::detail {
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 21>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20] =
@@ -503,7 +503,7 @@ namespace bml::detail {
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 20>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19] =
@@ -511,133 +511,133 @@ namespace bml::detail {
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 19>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 18>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 17>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 16>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 15>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 14>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 13>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 12>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 11>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 10>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8, m9] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 9>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7, m8] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 8>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6, m7] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4, m5, m6, m7);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 7>)
   {
     auto &&[m0, m1, m2, m3, m4, m5, m6] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4, m5, m6);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 6>)
   {
     auto &&[m0, m1, m2, m3, m4, m5] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4, m5);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 5>)
   {
     auto &&[m0, m1, m2, m3, m4] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3, m4);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 4>)
   {
     auto &&[m0, m1, m2, m3] = std::forward<T>(t);
     return std::tie(m0, m1, m2, m3);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 3>)
   {
     auto &&[m0, m1, m2] = std::forward<T>(t);
     return std::tie(m0, m1, m2);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 2>)
   {
     auto &&[m0, m1] = std::forward<T>(t);
     return std::tie(m0, m1);
   }
   template <typename T>
-  auto destructure0(T &t)
+  constexpr auto destructure0(T &t)
     requires(has_exact_n_members_v<T, 1> && !has_n_members_v<T, 2> && !has_n_members_v<T, 3> &&
              !has_n_members_v<T, 4> && !has_n_members_v<T, 5> && !has_n_members_v<T, 6> && !has_n_members_v<T, 7> &&
              !has_n_members_v<T, 8> && !has_n_members_v<T, 9> && !has_n_members_v<T, 10> && !has_n_members_v<T, 11> &&
@@ -652,12 +652,12 @@ namespace bml::detail {
   }
 
   template <typename T>
-  auto destructure(T &&t) {
+  constexpr auto destructure(T &&t) {
     return std::apply(untie(), destructure0(t));
   }
 
   template <typename T>
-  auto destructureReference(T &&t) {
+  constexpr auto destructureReference(T &&t) {
     return destructure0(t);
   }
 } // namespace bml::detail
@@ -24,6 +24,14 @@ namespace bml {
     ChecksumMismatchError(const char *msg) : std::runtime_error(msg) {}
   };
 
+  /**
+   * Exception type indicating data which is not valid in its expected encoding, e.g. a malformed UTF-8 string.
+   */
+  struct InvalidEncodingError final : public std::runtime_error {
+    InvalidEncodingError(const std::string &msg) : std::runtime_error(msg) {}
+    InvalidEncodingError(const char *msg) : std::runtime_error(msg) {}
+  };
+
   /**
    * Exception type indicating a DataRange with no reference to actual data, i.e. an empty or KNOWN range.
    *
@@ -6,6 +6,7 @@
 #include <concepts>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include <span>
@@ -133,6 +134,96 @@ namespace bml {
    */
   int32_t decodeNegaFibonacci(std::uintmax_t value);
 
+  /**
+   * Returns whether the given bytes are a valid UTF-8 encoded string.
+   *
+   * Invalid are any malformed or truncated sequences, overlong encodings, UTF-16 surrogates as well as code points
+   * beyond U+10FFFF.
+   *
+   * NOTE: Blocks of ASCII characters are checked a whole machine word at a time, so mostly ASCII strings are validated
+   * considerably faster than decoding them via BitReader::readUtf8CodePoint().
+   */
+  bool isValidUtf8(std::span<const std::byte> data) noexcept;
+
+  /**
+   * Reverses the order of the bytes of the given unsigned integral value.
+   *
+   * NOTE: This is equivalent to the C++23 std::byteswap() and is recognized by the compilers as a byte swap operation.
+   */
+  template <std::unsigned_integral T>
+  constexpr T byteSwap(T value) noexcept {
+    T result{};
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+      result = static_cast<T>(result << 8U) | static_cast<T>(value & 0xFFU);
+      value = static_cast<T>(value >> 8U);
+    }
+    return result;
+  }
+
+  /**
+   * Loads an unsigned integral value from the (unaligned) big endian bytes starting at the given position.
+   *
+   * NOTE: The caller needs to make sure that at least sizeof(T) bytes are accessible from the given position!
+   */
+  template <std::unsigned_integral T>
+  constexpr T loadBigEndian(const std::byte *ptr) noexcept {
+    if (std::is_constant_evaluated()) {
+      T value{};
+      for (std::size_t i = 0; i < sizeof(T); ++i) {
+        value = static_cast<T>(value << 8U) | static_cast<T>(ptr[i]);
+      }
+      return value;
+    }
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    if constexpr (std::endian::native == std::endian::little) {
+      value = byteSwap(value);
+    }
+    return value;
+  }
+
+  /**
+   * Stores the given unsigned integral value as big endian bytes into the (unaligned) memory starting at the given
+   * position.
+   *
+   * NOTE: The caller needs to make sure that at least sizeof(T) bytes are accessible from the given position!
+   */
+  template <std::unsigned_integral T>
+  constexpr void storeBigEndian(std::byte *ptr, T value) noexcept {
+    if (std::is_constant_evaluated()) {
+      for (std::size_t i = sizeof(T); i > 0; --i) {
+        ptr[i - 1U] = static_cast<std::byte>(value & 0xFFU);
+        value = static_cast<T>(value >> 8U);
+      }
+      return;
+    }
+    if constexpr (std::endian::native == std::endian::little) {
+      value = byteSwap(value);
+    }
+    std::memcpy(ptr, &value, sizeof(T));
+  }
+
+  /**
+   * Fixed-width integral or enum type which is read and written as all of its bytes in big endian.
+   */
+  template <typename T>
+  concept BigEndianValue = (std::integral<T> || std::is_enum_v<T>) && !std::is_same_v<T, bool>;
+
+  /**
+   * Converts all given values from big endian to native byte order (or vice versa) in place.
+   *
+   * NOTE: On little endian hosts, this is a simple byte swap loop, which is vectorized by the compilers.
+   */
+  template <BigEndianValue T>
+  void convertBigEndian(std::span<T> values) noexcept {
+    if constexpr (std::endian::native == std::endian::little && sizeof(T) > 1) {
+      using U = std::make_unsigned_t<T>;
+      for (auto &value : values) {
+        value = std::bit_cast<T>(byteSwap(std::bit_cast<U>(value)));
+      }
+    }
+  }
+
   void writeBits(std::ostream &os, std::uintmax_t value, BitCount numBits);
 
   /**
@@ -4,6 +4,8 @@
 #include "io_internal.hpp"
 #include "reader.hpp"
 #include "sizes.hpp"
+#include "span_reader.hpp"
+#include "span_writer.hpp"
 #include "writer.hpp"
 
 #include <array>
@@ -26,92 +28,106 @@ namespace bml {
   ////
 
   /**
-   * Reads from the given BitReader into the given output object using its member read() function.
+   * Reads from the given bit source into the given output object using its member read() function.
    */
-  template <typename Type>
-  void read(BitReader &reader, Type &value)
-    requires(detail::HasReadMember<Type>)
+  template <detail::BitSource Reader, typename Type>
+  constexpr void read(Reader &reader, Type &value)
+    requires(detail::HasReadMember<Type, Reader>)
   {
     value.read(reader);
   }
 
   /**
-   * Reads a single bit from the given BitReader into the given output value.
+   * Reads a single bit from the given bit source into the given output value.
    */
-  template <typename Type>
-  void read(BitReader &reader, Type &value)
+  template <detail::BitSource Reader, typename Type>
+  constexpr void read(Reader &reader, Type &value)
     requires(std::is_same_v<Type, bool>)
   {
     value = reader.read();
   }
 
   /**
-   * Reads a fixed-size unsigned integral value from the given BitReader into the given output value.
+   * Reads a fixed-size unsigned integral value from the given bit source into the given output value.
    */
-  template <typename Type>
-  void read(BitReader &reader, Type &value)
+  template <detail::BitSource Reader, typename Type>
+  constexpr void read(Reader &reader, Type &value)
     requires(std::is_unsigned_v<Type> && !std::is_same_v<Type, bool>)
   {
-    value = reader.read<Type>(sizeof(Type) * 1_bytes);
+    value = reader.template read<Type>(sizeof(Type) * 1_bytes);
   }
 
   /**
-   * Reads a fixed-size signed integral value from the given BitReader into the given output value.
+   * Reads a fixed-size signed integral value from the given bit source into the given output value.
    */
-  template <typename Type>
-  void read(BitReader &reader, Type &value)
+  template <detail::BitSource Reader, typename Type>
+  constexpr void read(Reader &reader, Type &value)
     requires(std::is_signed_v<Type>)
   {
-    value = std::bit_cast<Type>(reader.read<std::make_unsigned_t<Type>>(sizeof(Type) * 1_bytes));
+    value = std::bit_cast<Type>(reader.template read<std::make_unsigned_t<Type>>(sizeof(Type) * 1_bytes));
   }
 
   /**
-   * Reads a fixed-size numerical value from the given BitReader into the given output object enum value.
+   * Reads a fixed-size numerical value from the given bit source into the given output object enum value.
    */
-  template <typename Type>
-  void read(BitReader &reader, Type &value)
+  template <detail::BitSource Reader, typename Type>
+  constexpr void read(Reader &reader, Type &value)
     requires(std::is_enum_v<Type>)
   {
-    value = static_cast<Type>(reader.read<std::underlying_type_t<Type>>(sizeof(Type) * 1_bytes));
+    value = static_cast<Type>(reader.template read<std::underlying_type_t<Type>>(sizeof(Type) * 1_bytes));
   }
 
   /**
-   * Reads from the given BitReader into the given output object using member-wise read.
+   * Reads from the given bit source into the given output object using member-wise read.
    */
-  template <typename Type>
-  void read(BitReader &reader, Type &object)
-    requires(!detail::HasReadMember<Type> && detail::AllowedDestructurable<Type>)
+  template <detail::BitSource Reader, typename Type>
+  constexpr void read(Reader &reader, Type &object)
+    requires(!detail::HasAnyReadMember<Type, Reader> && detail::AllowedDestructurable<Type>)
   {
     detail::readMembers(reader, object);
   }
 
   /**
-   * Reads all elements from the given BitReader into the given output array.
+   * Reads all elements from the given bit source into the given output array.
+   *
+   * NOTE: If the read position is byte aligned, arrays of fixed-size integral or enum values are read at once.
    */
-  template <typename Type, std::size_t N>
-  void read(BitReader &reader, std::array<Type, N> &value)
-    requires requires(Type obj, BitReader r) { bml::read(r, obj); }
+  template <detail::BitSource Reader, typename Type, std::size_t N>
+  constexpr void read(Reader &reader, std::array<Type, N> &value)
+    requires requires(Type obj, Reader r) { bml::read(r, obj); }
   {
+    if constexpr (BigEndianValue<Type>) {
+      if (!(reader.position() % 1_bytes)) {
+        reader.readBigEndianInto(std::span<Type>{value});
+        return;
+      }
+    }
     for (auto &elem : value) {
       read(reader, elem);
     }
   }
 
+  namespace detail {
+    // Workaround for GCC failing to expand the parameter pack in the requires-expression of the tuple overload
+    template <typename Type, typename Reader>
+    concept ReadableFrom = requires(Type &obj, Reader &reader) { bml::read(reader, obj); };
+  } // namespace detail
+
   /**
-   * Reads all elements from the given BitReader into the given output object tuple.
+   * Reads all elements from the given bit source into the given output object tuple.
    */
-  template <typename... Types>
-  void read(BitReader &reader, std::tuple<Types...> &value)
-    requires(requires(Types obj, BitReader r) { bml::read(r, obj); } && ...)
+  template <detail::BitSource Reader, typename... Types>
+  constexpr void read(Reader &reader, std::tuple<Types...> &value)
+    requires(detail::ReadableFrom<Types, Reader> && ...)
   {
     std::apply([&reader](auto &...args) { (read(reader, args), ...); }, value);
   }
 
   /**
-   * Reads an object of the specific type from the given BitReader if the given condition is true.
+   * Reads an object of the specific type from the given bit source if the given condition is true.
    */
-  template <typename Type>
-  std::optional<Type> readOptional(BitReader &reader, bool condition) {
+  template <typename Type, detail::BitSource Reader>
+  constexpr std::optional<Type> readOptional(Reader &reader, bool condition) {
     if (condition) {
       Type tmp{};
       read(reader, tmp);
@@ -121,10 +137,10 @@ namespace bml {
   }
 
   /**
-   * Reads an object of the specific type from the given BitReader.
+   * Reads an object of the specific type from the given bit source.
    */
-  template <typename T>
-  T read(BitReader &reader) {
+  template <typename T, detail::BitSource Reader>
+  constexpr T read(Reader &reader) {
     T tmp{};
     read(reader, tmp);
     return tmp;
@@ -134,71 +150,73 @@ namespace bml {
   // WRITE
   ////
 
-  inline void write(BitWriter &, const std::monostate &) { /* no-op */ }
+  template <detail::BitSink Writer>
+  constexpr void write(Writer &, const std::monostate &) { /* no-op */ }
 
   /**
-   * Writes the given object to the given BitWriter using its member write() function.
+   * Writes the given object to the given bit sink using its member write() function.
    */
-  template <typename Type>
-  void write(BitWriter &writer, const Type &value)
-    requires(detail::HasWriteMember<Type>)
+  template <detail::BitSink Writer, typename Type>
+  constexpr void write(Writer &writer, const Type &value)
+    requires(detail::HasWriteMember<Type, Writer>)
   {
     value.write(writer);
   }
 
   /**
-   * Writes the given boolean value to the given BitWriter as a single bit.
+   * Writes the given boolean value to the given bit sink as a single bit.
    */
-  template <typename Type>
-  void write(BitWriter &writer, const Type &value)
+  template <detail::BitSink Writer, typename Type>
+  constexpr void write(Writer &writer, const Type &value)
     requires(std::is_same_v<Type, bool>)
   {
     writer.write(value);
   }
 
   /**
-   * Writes the given fixed-size unsigned integral value to the given BitWriter.
+   * Writes the given fixed-size unsigned integral value to the given bit sink.
    */
-  template <typename Type>
-  void write(BitWriter &writer, const Type &value)
+  template <detail::BitSink Writer, typename Type>
+  constexpr void write(Writer &writer, const Type &value)
     requires(std::is_unsigned_v<Type> && !std::is_same_v<Type, bool>)
   {
     writer.write(value, sizeof(Type) * 1_bytes);
   }
 
   /**
-   * Writes the given fixed-size signed integral value to the given BitWriter.
+   * Writes the given fixed-size signed integral value to the given bit sink.
    */
-  template <typename Type>
-  void write(BitWriter &writer, const Type &value)
+  template <detail::BitSink Writer, typename Type>
+  constexpr void write(Writer &writer, const Type &value)
     requires(std::is_signed_v<Type>)
   {
     writer.write(std::bit_cast<std::make_unsigned_t<Type>>(value), sizeof(Type) * 1_bytes);
   }
 
   /**
-   * Writes the given fixed-size enum value to the given BitWriter.
+   * Writes the given fixed-size enum value to the given bit sink.
    */
-  template <typename Type>
-  void write(BitWriter &writer, const Type &value)
+  template <detail::BitSink Writer, typename Type>
+  constexpr void write(Writer &writer, const Type &value)
     requires(std::is_enum_v<Type>)
   {
     writer.write(static_cast<std::underlying_type_t<Type>>(value), sizeof(Type) * 1_bytes);
   }
 
   /**
-   * Writes the given byte to the given BitWriter.
+   * Writes the given byte to the given bit sink.
    */
-  inline void write(BitWriter &writer, const std::byte &value) {
+  template <detail::BitSink Writer>
+  constexpr void write(Writer &writer, const std::byte &value) {
     writer.write(static_cast<uint8_t>(value), ByteCount{1});
   }
 
   /**
-   * Writes the given object to the given BitWriter using member-wise write.
+   * Writes the given object to the given bit sink using member-wise write.
    */
-  template <typename Type>
-  void write(BitWriter &writer, const Type &object)
-    requires(!detail::HasWriteMember<Type> && detail::AllowedDestructurable<Type>)
+  template <detail::BitSink Writer, typename Type>
+  constexpr void write(Writer &writer, const Type &object)
+    requires(!detail::HasAnyWriteMember<Type, Writer> && detail::AllowedDestructurable<Type>)
   {
     detail::writeMembers(writer, object);
   }
@@ -217,34 +235,56 @@ namespace bml {
 
   /**
    * Writes the given list of objects to the given BitWriter by writing all elements.
+   *
+   * NOTE: If the write position is byte aligned, lists of fixed-size integral or enum values are written at once.
    */
   template <typename Type>
   void write(BitWriter &writer, const std::vector<Type> &value)
     requires requires(const Type &obj, BitWriter w) { bml::write(w, obj); }
   {
+    if constexpr (BigEndianValue<Type>) {
+      if (!(writer.position() % 1_bytes)) {
+        writer.writeBigEndian(std::span<const Type>{value});
+        return;
+      }
+    }
     for (const auto &element : value) {
       bml::write(writer, element);
     }
   }
 
   /**
-   * Writes the given array of objects to the given BitWriter by writing all elements.
+   * Writes the given array of objects to the given bit sink by writing all elements.
+   *
+   * NOTE: If the write position is byte aligned, arrays of fixed-size integral or enum values are written at once.
    */
-  template <typename Type, std::size_t N>
-  void write(BitWriter &writer, const std::array<Type, N> &value)
-    requires requires(const Type &obj, BitWriter w) { bml::write(w, obj); }
+  template <detail::BitSink Writer, typename Type, std::size_t N>
+  constexpr void write(Writer &writer, const std::array<Type, N> &value)
+    requires requires(const Type &obj, Writer w) { bml::write(w, obj); }
   {
+    if constexpr (BigEndianValue<Type>) {
+      if (!(writer.position() % 1_bytes)) {
+        writer.writeBigEndian(std::span<const Type>{value});
+        return;
+      }
+    }
     for (const auto &element : value) {
       bml::write(writer, element);
     }
   }
 
+  namespace detail {
+    // Workaround for GCC failing to expand the parameter pack in the requires-expression of the tuple overload
+    template <typename Type, typename Writer>
+    concept WriteableTo = requires(const Type &obj, Writer &writer) { bml::write(writer, obj); };
+  } // namespace detail
+
   /**
-   * Writes the given tuple to the given BitWriter by writing all elements.
+   * Writes the given tuple to the given bit sink by writing all elements.
    */
-  template <typename... Types>
-  void write(BitWriter &writer, const std::tuple<Types...> &value)
-    requires(requires(const Types &obj, BitWriter w) { bml::write(w, obj); } && ...)
+  template <detail::BitSink Writer, typename... Types>
+  constexpr void write(Writer &writer, const std::tuple<Types...> &value)
+    requires(detail::WriteableTo<Types, Writer> && ...)
   {
     std::apply([&writer](auto &...args) { (bml::write(writer, args), ...); }, value);
   }
@@ -422,6 +462,9 @@ namespace bml {
 
   /**
    * Copies the given number of raw bits from the given BitReader to the given BitWriter.
+   *
+   * NOTE: If both the reader and the writer are byte aligned, the full bytes are copied in bulk, see
+   * BitReader::copyBytesTo().
    */
   void copyBits(BitReader &reader, BitWriter &writer, BitCount numBits);
 
@@ -569,13 +612,13 @@ namespace bml {
   namespace detail {
     // Define some forward-declared symbols after all the symbols that might be called have been declared
 
-    template <typename Type>
-    void readMembers(BitReader &reader, Type &object) {
+    template <BitSource Reader, typename Type>
+    constexpr void readMembers(Reader &reader, Type &object) {
       std::apply([&reader](auto &...args) { (bml::read(reader, args), ...); }, destructureReference(object));
     }
 
-    template <typename Type>
-    void writeMembers(BitWriter &writer, const Type &object) {
+    template <BitSink Writer, typename Type>
+    constexpr void writeMembers(Writer &writer, const Type &object) {
       std::apply([&writer](auto &...args) { (bml::write(writer, args), ...); }, destructureReference(object));
     }
 
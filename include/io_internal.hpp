@@ -4,6 +4,8 @@
 #include "helper.hpp"
 #include "reader.hpp"
 #include "sizes.hpp"
+#include "span_reader.hpp"
+#include "span_writer.hpp"
 #include "writer.hpp"
 
 #include <algorithm>
@@ -19,11 +21,39 @@
 #include <vector>
 
 namespace bml::detail {
-  template <typename Type>
-  concept HasReadMember = requires(Type &obj, BitReader &reader) { obj.read(reader); };
-
-  template <typename Type>
-  concept HasWriteMember = requires(const Type &obj, BitWriter &writer) { obj.write(writer); };
+  /**
+   * The bit reader types supported by the generic bml::read() functions.
+   */
+  template <typename Reader>
+  concept BitSource = std::same_as<Reader, BitReader> || std::same_as<Reader, SpanReader>;
+
+  /**
+   * The bit writer types supported by the generic bml::write() functions.
+   */
+  template <typename Writer>
+  concept BitSink = std::same_as<Writer, BitWriter> || std::same_as<Writer, SpanWriter>;
+
+  template <typename Type, typename Reader = BitReader>
+  concept HasReadMember = requires(Type &obj, Reader &reader) { obj.read(reader); };
+
+  template <typename Type, typename Writer = BitWriter>
+  concept HasWriteMember = requires(const Type &obj, Writer &writer) { obj.write(writer); };
+
+  /**
+   * Types with a custom read() member for any bit reader type, which therefore must not be read member-wise, even if
+   * the custom read() does not accept the bit reader type passed in.
+   */
+  template <typename Type, typename Reader>
+  concept HasAnyReadMember = HasReadMember<Type, BitReader> || HasReadMember<Type, SpanReader> ||
+                             HasReadMember<Type, Reader>;
+
+  /**
+   * Types with a custom write() member for any bit writer type, which therefore must not be written member-wise, even
+   * if the custom write() does not accept the bit writer type passed in.
+   */
+  template <typename Type, typename Writer>
+  concept HasAnyWriteMember = HasWriteMember<Type, BitWriter> || HasWriteMember<Type, SpanWriter> ||
+                              HasWriteMember<Type, Writer>;
 
   template <typename Type>
   concept HasSkipMember = requires(BitReader &reader) { Type::skip(reader); };
@@ -229,11 +259,11 @@ namespace bml::detail {
   template <IsEnum Type>
   struct SizeHelper<Type> : SizeHelper<std::underlying_type_t<Type>> {};
 
-  template <typename Type>
-  void readMembers(BitReader &reader, Type &object);
+  template <BitSource Reader, typename Type>
+  constexpr void readMembers(Reader &reader, Type &object);
 
-  template <typename Type>
-  void writeMembers(BitWriter &writer, const Type &object);
+  template <BitSink Writer, typename Type>
+  constexpr void writeMembers(Writer &writer, const Type &object);
 
   template <typename Type>
   constexpr BitCount numBitsMembers(const Type &object) noexcept;
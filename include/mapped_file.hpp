@@ -0,0 +1,60 @@
+#pragma once
+
+#include "helper.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace bml {
+  /**
+   * Read-only memory mapping of a whole file.
+   *
+   * The mapped file contents can be accessed as in-memory byte range, e.g. to read them with a BitReader or to directly
+   * reference them in BORROWED DataRanges without copying any data.
+   *
+   * NOTE: Any span or DataRange referencing the mapped data MUST NOT be accessed after the MappedFile object is
+   * destroyed!
+   */
+  class MappedFile {
+  public:
+    constexpr MappedFile() noexcept = default;
+
+    /**
+     * Maps the complete file at the given path read-only into memory.
+     *
+     * Throws a std::system_error if the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::filesystem::path &path);
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    ~MappedFile() noexcept;
+
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    /**
+     * Returns a read-only view to the mapped file contents.
+     */
+    std::span<const std::byte> data() const noexcept { return mappedData; }
+    operator std::span<const std::byte>() const noexcept { return mappedData; }
+
+    /**
+     * Returns the byte range covering the whole mapped file.
+     */
+    ByteRange byteRange() const noexcept { return ByteRange{0_bytes, ByteCount{mappedData.size()}}; }
+
+    /**
+     * Returns the number of mapped bytes, i.e. the file size.
+     */
+    std::size_t size() const noexcept { return mappedData.size(); }
+    bool empty() const noexcept { return mappedData.empty(); }
+
+  private:
+    void unmap() noexcept;
+
+  private:
+    std::span<const std::byte> mappedData;
+  };
+} // namespace bml
@@ -260,6 +260,14 @@ public:
       [[no_unique_address]] ViewOnly viewOnly{};
     };
 
+    template <>
+    struct PrintView<std::u8string_view> {
+      friend std::ostream &operator<<(std::ostream &os, const PrintView<std::u8string_view> &view);
+
+      const std::u8string_view &value;
+      [[no_unique_address]] ViewOnly viewOnly{};
+    };
+
     template <>
     struct PrintView<std::monostate> {
       friend std::ostream &operator<<(std::ostream &os, const PrintView<std::monostate> &view);
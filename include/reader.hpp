@@ -1,5 +1,6 @@
 #pragma once
 
+#include "helper.hpp"
 #include "sizes.hpp"
 
 #include <cstddef>
@@ -12,6 +13,47 @@
 
 namespace bml {
 
+  class BitWriter;
+
+  namespace detail {
+    struct BaseReaderAccess;
+  } // namespace detail
+
+  /**
+   * Counters for the accesses of a BitReader to its underlying byte source, see BitReader::setStatistics().
+   *
+   * This allows to e.g. size the read-ahead buffers or to determine how much of the input is actually read.
+   */
+  struct ReaderStatistics {
+    /**
+     * The number of reads from the underlying byte source, e.g. refills of the read-ahead buffer of buffered sources
+     * or reads of an unbuffered input stream.
+     *
+     * NOTE: Reading from in-memory byte ranges does not count as source reads.
+     */
+    std::size_t numSourceReads = 0;
+
+    /**
+     * The total number of bytes provided by the source reads counted in numSourceReads.
+     */
+    ByteCount sourceBytesRead;
+
+    /**
+     * The number of bytes consumed by reading, independent of the type of the underlying byte source.
+     */
+    ByteCount bytesRead;
+
+    /**
+     * The number of bytes skipped in the underlying byte source without reading them.
+     */
+    ByteCount bytesSkipped;
+
+    /**
+     * The number of times the underlying byte source was repositioned via BitReader::seek().
+     */
+    std::size_t numSeeks = 0;
+  };
+
   /**
    * Main reader class wrapping a source of bytes (e.g. a buffer or stream) and providing functions to extract bit-,
    * byte-sized and encoded numerical values.
@@ -31,6 +73,13 @@ namespace bml {
      */
     using ByteGenerator = std::function<bool(std::byte &)>;
 
+    /**
+     * A byte source providing multiple bytes at a time by filling (a prefix of) the given output range.
+     *
+     * Returns the number of bytes written to the output range, zero if no more binary data is available.
+     */
+    using ChunkGenerator = std::function<std::size_t(std::span<std::byte>)>;
+
     /**
      * A byte source wrapping a read-only contiguous range of bytes in memory.
      *
@@ -39,6 +88,11 @@ namespace bml {
      */
     using ByteRange = std::span<const std::byte>;
 
+    /**
+     * Default number of bytes read ahead from buffered byte sources.
+     */
+    static constexpr ByteCount DEFAULT_READ_AHEAD{64 * 1024};
+
     BitReader() noexcept;
     explicit BitReader(ByteGenerator &&generator);
     explicit BitReader(ByteRange range);
@@ -47,6 +101,43 @@ namespace bml {
     explicit BitReader(std::span<const uint8_t> range) : BitReader(std::as_bytes(range)) {}
     explicit BitReader(std::istream &is);
 
+    /**
+     * Creates a reader buffering up to the given number of bytes read ahead from the given chunk generator.
+     */
+    explicit BitReader(ChunkGenerator &&generator, ByteCount readAheadSize = DEFAULT_READ_AHEAD);
+
+    /**
+     * Creates a reader buffering up to the given number of bytes read ahead from the given input stream.
+     *
+     * This reduces the number of (relatively expensive) stream accesses to one per filling of the read-ahead buffer.
+     *
+     * NOTE: On destruction of the reader, the buffered bytes not yet consumed are returned to the input stream (if it
+     * supports seeking), leaving the stream at the same position as with an unbuffered reader.
+     */
+    explicit BitReader(std::istream &is, ByteCount readAheadSize);
+
+    /**
+     * Creates a reader keeping up to the given number of chunks of the given read-ahead size read ahead from the given
+     * chunk generator on a background thread.
+     *
+     * This overlaps the latency of the (blocking) chunk generator with processing the already read data, e.g. for
+     * sources on network-attached storage. Passing zero chunks creates a reader equivalent to the one without read-ahead
+     * thread.
+     *
+     * NOTE: The chunk generator is called from the background thread!
+     */
+    BitReader(ChunkGenerator &&generator, ByteCount readAheadSize, std::size_t numPrefetchedChunks);
+
+    /**
+     * Creates a reader keeping up to the given number of chunks of the given read-ahead size read ahead from the given
+     * input stream on a background thread.
+     *
+     * NOTE: The input stream is read from the background thread, so it must not be accessed by others while the reader
+     * is alive. On destruction of the reader, the read-ahead bytes not yet consumed are returned to the input stream
+     * (if it supports seeking), same as for the buffered reader.
+     */
+    BitReader(std::istream &is, ByteCount readAheadSize, std::size_t numPrefetchedChunks);
+
     // Disallow copying, since the different byte sources might behave differently when being copied
     BitReader(const BitReader &) = delete;
     BitReader(BitReader &&other) noexcept;
@@ -131,6 +222,20 @@ namespace bml {
      */
     void readBytesInto(std::span<std::byte> outBytes);
 
+    /**
+     * Reads as many big endian fixed-width integral values as required to fill the given output range completely.
+     *
+     * NOTE: This is more efficient than reading the values one by one, since all bytes are read at once directly into
+     * the output range and are then converted to native byte order in place.
+     *
+     * Throws an exception if the read position is not byte aligned, see assertAlignment().
+     */
+    template <BigEndianValue T>
+    void readBigEndianInto(std::span<T> outValues) {
+      readBytesInto(std::as_writable_bytes(outValues));
+      convertBigEndian(outValues);
+    }
+
     /**
      * Reads all bytes until the given pattern is found or the end of the input is reached.
      *
@@ -164,6 +269,22 @@ namespace bml {
       return static_cast<T>(readSignedExpGolomb());
     }
 
+    /**
+     * Reads as many unsigned Exponential-Golomb encoded values as required to fill the given output range completely.
+     *
+     * NOTE: This is more efficient than calling readExpGolomb() repeatedly, since all values fitting into the internal
+     * cache are decoded at once.
+     */
+    void readExpGolombInto(std::span<std::uintmax_t> outValues);
+
+    /**
+     * Reads as many signed Exponential-Golomb encoded values as required to fill the given output range completely.
+     *
+     * NOTE: This is more efficient than calling readSignedExpGolomb() repeatedly, since all values fitting into the
+     * internal cache are decoded at once.
+     */
+    void readSignedExpGolombInto(std::span<std::intmax_t> outValues);
+
     /**
      * Reads as many bytes required to produce a full UTF-8 encoded Unicode code point.
      *
@@ -202,6 +323,22 @@ namespace bml {
       return static_cast<T>(readSignedFibonacci());
     }
 
+    /**
+     * Reads as many unsigned Fibonacci encoded values as required to fill the given output range completely.
+     *
+     * NOTE: This is more efficient than calling readFibonacci() repeatedly, since all values fitting into the internal
+     * cache are decoded at once.
+     */
+    void readFibonacciInto(std::span<uint32_t> outValues);
+
+    /**
+     * Reads as many signed Negafibonacci encoded values as required to fill the given output range completely.
+     *
+     * NOTE: This is more efficient than calling readSignedFibonacci() repeatedly, since all values fitting into the
+     * internal cache are decoded at once.
+     */
+    void readSignedFibonacciInto(std::span<int32_t> outValues);
+
     /**
      * Skips the given number of bits for reading, incrementing the current read position by the given number of bits.
      */
@@ -216,8 +353,111 @@ namespace bml {
      */
     ByteCount skipBytesUntil(std::span<const std::byte> pattern);
 
+    /**
+     * Copies the given number of aligned bytes to the given writer.
+     *
+     * Other than reading and writing the bytes via the generic interfaces, the bytes are passed to the writer in large
+     * chunks. For in-memory sources and the read-ahead buffers of buffered sources, the bytes are passed directly from
+     * the source memory without any intermediate copy.
+     *
+     * Throws an exception if the read position or the write position is not byte aligned, see assertAlignment() and
+     * BitWriter::assertAlignment().
+     */
+    void copyBytesTo(BitWriter &writer, ByteCount numBytes);
+
+    /**
+     * Returns whether the underlying byte source supports random access via seek().
+     *
+     * In-memory byte ranges and seekable input streams support seeking, byte/chunk generators do not.
+     */
+    bool isSeekable() const noexcept;
+
+    /**
+     * Moves the read position to the given absolute position, i.e. relative to the start of this reader as reported
+     * by position().
+     *
+     * NOTE: Sources not supporting random access (see isSeekable()) can only be seeked forward, which is equivalent to
+     * skipping the bits until the given position. Seeking backwards on such sources throws an exception.
+     *
+     * NOTE: Seeking a seekable source to the current position re-synchronizes the reader with the source, e.g. to
+     * continue reading data appended to an input stream after its end was previously reached.
+     *
+     * NOTE: Throws an EndOfStreamError if the given position is not within the underlying byte source.
+     */
+    void seek(BitCount position);
+
+    /**
+     * Creates a new reader reading only the given byte range of the underlying byte source, independent of this reader.
+     *
+     * The offset of the range is relative to the start of this reader, as reported by position(). The position() of the
+     * returned reader is relative to the start of the given range and reading beyond the range end fails with an
+     * EndOfStreamError. Reading from either reader has no effect on the read position of the other one.
+     *
+     * For in-memory byte ranges, the new reader directly reads the sub-range of the memory. For seekable input streams,
+     * the new reader shares the stream and restores the stream position after accessing it.
+     *
+     * NOTE: Throws an exception if the underlying byte source does not support random access (see isSeekable()) and
+     * an EndOfStreamError if the given range is not within an in-memory byte range.
+     *
+     * NOTE: For sources wrapping an input stream, the stream needs to outlive the returned reader.
+     */
+    BitReader subReader(bml::ByteRange range) const;
+
+    /**
+     * Returns the statistics object the accesses to the underlying byte source are counted into, if any.
+     */
+    ReaderStatistics *statistics() const noexcept;
+
+    /**
+     * Sets the statistics object to count the accesses to the underlying byte source into, nullptr to disable
+     * counting.
+     *
+     * NOTE: The statistics object needs to outlive this reader (or be unset before). It is not inherited by readers
+     * created via subReader() and the counters are NOT synchronized, so a single statistics object must not be shared
+     * by readers used on different threads.
+     */
+    void setStatistics(ReaderStatistics *statistics);
+
+  private:
+    explicit BitReader(std::unique_ptr<ReaderImpl> &&source) noexcept;
+
+    /**
+     * Returns the base reader this reader (transitively) reads its data from as set via setBaseReader(), or this reader
+     * itself if it directly reads from its byte source.
+     */
+    BitReader &baseReader() noexcept;
+
+    /**
+     * Marks this reader to read its data from the given base reader, e.g. for a reader created with a generator
+     * decorating the reading from another reader.
+     *
+     * If the given reader itself reads from another base reader, the base reader is set to that reader instead. This
+     * allows to access the base reader of arbitrarily nested decorating readers in constant time.
+     *
+     * NOTE: The base reader needs to outlive this reader. Since the base reader is referenced by its address, it also
+     * must not be moved (neither moved from nor assigned to) as long as this reader is used, otherwise the reference
+     * dangles (or refers to the moved-from, empty reader)!
+     */
+    void setBaseReader(BitReader &base);
+
   private:
     std::unique_ptr<ReaderImpl> impl;
+
+    friend struct detail::BaseReaderAccess;
   };
 
+  namespace detail {
+    /**
+     * Access to the base reader of readers decorating the reading from another reader, see BitReader::baseReader() and
+     * BitReader::setBaseReader().
+     *
+     * NOTE: This is an internal interface for implementing decorating readers (e.g. for the CRC-32 calculation of EBML
+     * Elements) and therefore not part of the public BitReader interface.
+     */
+    struct BaseReaderAccess {
+      static BitReader &baseReader(BitReader &reader) noexcept { return reader.baseReader(); }
+      static void setBaseReader(BitReader &reader, BitReader &base) { reader.setBaseReader(base); }
+    };
+  } // namespace detail
+
 } // namespace bml
@@ -0,0 +1,291 @@
+#pragma once
+
+#include "errors.hpp"
+#include "helper.hpp"
+#include "sizes.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+
+namespace bml {
+
+  namespace detail {
+    /**
+     * Fills as many full bytes from the given source range into the free lower bits of the given left-adjusted cache
+     * as fit and returns the number of bytes consumed from the source.
+     *
+     * If at least a full word is available in the source, all bytes are loaded with a single big endian load.
+     */
+    constexpr std::size_t fillCacheFromRange(std::uintmax_t &cache, BitCount &cacheSize,
+                                             std::span<const std::byte> source) noexcept {
+      constexpr BitCount CACHE_BITS{static_cast<std::size_t>(std::numeric_limits<std::uintmax_t>::digits)};
+      const auto numBytes = std::min((CACHE_BITS - cacheSize) / 1_bytes, source.size());
+      if (!numBytes) [[unlikely]] {
+        return 0;
+      }
+
+      std::uintmax_t word = 0;
+      if (source.size() >= sizeof(std::uintmax_t)) [[likely]] {
+        word = loadBigEndian<std::uintmax_t>(source.data());
+        if (numBytes < sizeof(std::uintmax_t)) {
+          // only keep the bytes which fit into the cache
+          word &= ~(std::numeric_limits<std::uintmax_t>::max() >> ByteCount{numBytes});
+        }
+      } else {
+        for (std::size_t i = 0; i < numBytes; ++i) {
+          word |= static_cast<std::uintmax_t>(source[i]) << (CACHE_BITS - ByteCount{i + 1U});
+        }
+      }
+      cache |= word >> cacheSize;
+      cacheSize += ByteCount{numBytes};
+      return numBytes;
+    }
+  } // namespace detail
+
+  /**
+   * Reader for bit-, byte-sized values directly from a contiguous in-memory range of bytes.
+   *
+   * Other than the BitReader, this type does not hide its byte source behind a virtual interface and is completely
+   * defined in this header. This allows all reading, peeking and skipping to be inlined into the calling code and
+   * refills the internal cache with a single (unaligned) big endian load of a whole word, making it suitable for hot
+   * parsing code of many small bit fields. All member functions are constexpr, so that binary data can also be decoded
+   * in constant evaluation.
+   *
+   * NOTE: All values are read in big endian, MSB first! This also means that bits are read from the highest bit first!
+   *
+   * NOTE: Any read function will throw an error if not enough bytes are available in the underlying byte range.
+   *
+   * NOTE: The underlying memory range must be kept alive until the SpanReader is done reading, the memory is not
+   * copied!
+   */
+  class SpanReader final {
+  public:
+    using ByteRange = std::span<const std::byte>;
+
+    constexpr SpanReader() noexcept = default;
+    explicit constexpr SpanReader(ByteRange range) noexcept : data(range) {}
+    explicit SpanReader(std::span<const uint8_t> range) noexcept : SpanReader(std::as_bytes(range)) {}
+
+    /**
+     * Returns the number of bits already read.
+     */
+    constexpr BitCount position() const noexcept { return ByteCount{offset} - cacheSize; }
+
+    /**
+     * Returns the number of bits still available to be read.
+     */
+    constexpr BitCount remainingBits() const noexcept { return ByteCount{data.size() - offset} + cacheSize; }
+
+    /*
+     * Returns whether there is at least one more byte to read in the underlying byte range.
+     */
+    constexpr bool hasMoreBytes() const noexcept { return remainingBits() >= 1_bytes; }
+
+    /**
+     * Reads and drops all bits until the given bit alignment is achieved.
+     *
+     * Returns the number of bits skipped.
+     */
+    constexpr BitCount skipToAligment(BitCount bitAlignment) {
+      if (auto misalignment = position() % bitAlignment) {
+        auto numBits = bitAlignment - misalignment;
+        skip(numBits);
+        return numBits;
+      }
+      return 0_bits;
+    }
+
+    /**
+     * Throws an exception if the current read position is not aligned to the given bit alignment.
+     */
+    constexpr void assertAlignment(BitCount bitAlignment) {
+      if (skipToAligment(bitAlignment)) [[unlikely]] {
+        throw std::invalid_argument("Input bit stream is not properly aligned");
+      }
+    }
+
+    /**
+     * Reads a single bit.
+     */
+    constexpr bool read() { return read(1_bits) != 0; }
+
+    /**
+     * Peeks the given amount of bits without increasing the current read position.
+     *
+     * Returns the peeked value if available or an empty optional value if not enough bits can be peeked.
+     */
+    constexpr std::optional<std::uintmax_t> peek(BitCount numBits) {
+      if (numBits > cacheSize) [[unlikely]] {
+        assertFitsCache(numBits);
+        refill();
+        if (numBits > cacheSize) [[unlikely]] {
+          if (numBits > remainingBits()) {
+            return {};
+          }
+          // the cache can only hold full bytes, so the peeked bits are split between the cache and the source
+          auto copy = *this;
+          return copy.read(numBits);
+        }
+      }
+      return numBits ? (cache >> (CACHE_BITS - numBits)) : 0U;
+    }
+
+    /**
+     * Reads the given amount of bits, increasing the current read position.
+     */
+    constexpr std::uintmax_t read(BitCount numBits) {
+      if (numBits > cacheSize) [[unlikely]] {
+        assertFitsCache(numBits);
+        refill();
+        if (numBits > cacheSize) [[unlikely]] {
+          if (numBits > remainingBits()) [[unlikely]] {
+            throwOnEndOfStream();
+          }
+          // the cache can only hold full bytes, so the last byte did not fit, read the remaining cache first
+          auto upperBits = cacheSize;
+          auto upper = extractFromCache(upperBits);
+          refill();
+          return (upper << (numBits - upperBits)) | extractFromCache(numBits - upperBits);
+        }
+      }
+      return extractFromCache(numBits);
+    }
+
+    template <typename T>
+    constexpr T read(BitCount numBits)
+      requires(std::is_unsigned_v<T> || std::is_enum_v<T>)
+    {
+      return static_cast<T>(read(numBits));
+    }
+
+    /**
+     * Reads the given amount of aligned bytes.
+     *
+     * Throws an exception if the read position is not byte aligned, see assertAlignment().
+     */
+    constexpr std::uintmax_t readBytes(ByteCount numBytes) {
+      assertAlignment(1_bytes);
+      return read(numBytes);
+    }
+
+    template <typename T>
+    constexpr T readBytes(ByteCount numBytes)
+      requires(std::is_unsigned_v<T> || std::is_enum_v<T>)
+    {
+      return static_cast<T>(readBytes(numBytes));
+    }
+
+    /**
+     * Reads a single aligned byte.
+     */
+    constexpr std::byte readByte() { return static_cast<std::byte>(read(1_bytes)); }
+
+    /**
+     * Reads as many bytes required to fill the given output range completely.
+     *
+     * Throws an exception if the read position is not byte aligned, see assertAlignment().
+     */
+    constexpr void readBytesInto(std::span<std::byte> outBytes) {
+      if (outBytes.empty()) [[unlikely]] {
+        return;
+      }
+      assertAlignment(1_bytes);
+      if (ByteCount{outBytes.size()} > remainingBits()) [[unlikely]] {
+        throwOnEndOfStream();
+      }
+      // Since we are byte-aligned, the cache only contains full bytes which can be directly re-read from the source
+      dropCache();
+      std::copy_n(data.begin() + static_cast<std::ptrdiff_t>(offset), outBytes.size(), outBytes.begin());
+      offset += outBytes.size();
+    }
+
+    /**
+     * Reads as many big endian fixed-width integral values as required to fill the given output range completely.
+     *
+     * Throws an exception if the read position is not byte aligned, see assertAlignment().
+     */
+    template <BigEndianValue T>
+    constexpr void readBigEndianInto(std::span<T> outValues) {
+      assertAlignment(1_bytes);
+      if (ByteCount{outValues.size() * sizeof(T)} > remainingBits()) [[unlikely]] {
+        throwOnEndOfStream();
+      }
+      using U = std::make_unsigned_t<T>;
+      dropCache();
+      for (auto &value : outValues) {
+        value = static_cast<T>(loadBigEndian<U>(data.data() + offset));
+        offset += sizeof(T);
+      }
+    }
+
+    /**
+     * Skips the given number of bits for reading, incrementing the current read position by the given number of bits.
+     */
+    constexpr void skip(BitCount numBits) {
+      if (numBits <= cacheSize) [[likely]] {
+        extractFromCache(numBits);
+        return;
+      }
+      if (numBits > remainingBits()) [[unlikely]] {
+        throw EndOfStreamError("Cannot skip more bytes, end of input reached");
+      }
+      auto target = position() + numBits;
+      cache = 0;
+      cacheSize = 0_bits;
+      offset = target / 1_bytes;
+      if (auto numBitsInByte = target % 1_bytes) {
+        refill();
+        extractFromCache(numBitsInByte);
+      }
+    }
+
+  private:
+    static constexpr BitCount CACHE_BITS{static_cast<std::size_t>(std::numeric_limits<std::uintmax_t>::digits)};
+
+    [[noreturn]] static void throwOnEndOfStream() {
+      throw EndOfStreamError("Cannot read more bytes, end of input reached");
+    }
+
+    static constexpr void assertFitsCache(BitCount numBits) {
+      if (numBits > CACHE_BITS) [[unlikely]] {
+        throw std::out_of_range("Cannot read more bits than fit into uintmax_t");
+      }
+    }
+
+    constexpr void refill() noexcept { offset += detail::fillCacheFromRange(cache, cacheSize, data.subspan(offset)); }
+
+    constexpr std::uintmax_t extractFromCache(BitCount numBits) noexcept {
+      if (!numBits) [[unlikely]] {
+        return 0;
+      }
+      auto result = cache >> (CACHE_BITS - numBits);
+      cache = numBits == CACHE_BITS ? 0U : (cache << numBits);
+      cacheSize -= numBits;
+      return result;
+    }
+
+    /**
+     * Returns all (full) bytes still in the cache to the source range.
+     */
+    constexpr void dropCache() noexcept {
+      offset -= cacheSize / 1_bytes;
+      cache = 0;
+      cacheSize = 0_bits;
+    }
+
+  private:
+    ByteRange data;
+    /** Offset of the next byte to load into the cache */
+    std::size_t offset = 0;
+    /** Number of valid bits in the cache */
+    BitCount cacheSize;
+    /** is always left-adjusted to read the highest bits first */
+    std::uintmax_t cache = 0;
+  };
+
+} // namespace bml
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "errors.hpp"
+#include "helper.hpp"
+#include "sizes.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace bml {
+
+  /**
+   * Writer for bit-, byte-sized values directly into a contiguous fixed-size in-memory range of bytes.
+   *
+   * Same as the SpanReader, this type is completely defined in this header and can also be used in constant
+   * evaluation, e.g. to encode binary data at compile time.
+   *
+   * NOTE: All values are written in big endian, MSB first! This also means that bits are written to the highest bit
+   * first!
+   *
+   * NOTE: The written bits are directly stored in the underlying byte range, the remaining lower bits of a partially
+   * written byte are zeroed. Thus, other than for the BitWriter, flushing is only required to advance the position to
+   * the next full byte.
+   *
+   * NOTE: Any write function will throw an error if not enough space is available in the underlying byte range.
+   *
+   * NOTE: The underlying memory range must be kept alive until the SpanWriter is done writing!
+   */
+  class SpanWriter final {
+  public:
+    using ByteRange = std::span<std::byte>;
+
+    constexpr SpanWriter() noexcept = default;
+    explicit constexpr SpanWriter(ByteRange range) noexcept : data(range) {}
+    explicit SpanWriter(std::span<uint8_t> range) noexcept : SpanWriter(std::as_writable_bytes(range)) {}
+
+    /**
+     * Returns the number of bits already written.
+     */
+    constexpr BitCount position() const noexcept { return BitCount{offset}; }
+
+    /**
+     * Returns the number of bits still available to be written.
+     */
+    constexpr BitCount remainingBits() const noexcept { return BitCount{data.size() * BYTE_BITS - offset}; }
+
+    /**
+     * Writes the given bit value until the given bit alignment is achieved.
+     *
+     * Returns the number of bits written.
+     */
+    constexpr BitCount fillToAligment(BitCount bitAlignment, bool bit) {
+      if (auto misalignment = position() % bitAlignment) {
+        auto numBits = bitAlignment - misalignment;
+        for (auto remaining = numBits; remaining;) {
+          auto chunk = std::min(remaining, BitCount{WORD_BITS});
+          write(bit ? std::numeric_limits<std::uintmax_t>::max() : 0U, chunk);
+          remaining -= chunk;
+        }
+        return numBits;
+      }
+      return 0_bits;
+    }
+
+    /**
+     * Throws an exception if the current write position is not aligned to the given bit alignment.
+     */
+    constexpr void assertAlignment(BitCount bitAlignment) const {
+      if (position() % bitAlignment) [[unlikely]] {
+        throw std::invalid_argument("Output bit stream is not properly aligned");
+      }
+    }
+
+    /**
+     * Writes a single bit.
+     */
+    constexpr void write(bool bit) { write(bit ? 1U : 0U, 1_bits); }
+
+    /**
+     * Writes the given number of bits of the given value.
+     *
+     * NOTE: Given a number of bits of N, the lower N bits written!
+     */
+    constexpr void write(std::uintmax_t value, BitCount numBits) {
+      if (numBits > BitCount{WORD_BITS}) [[unlikely]] {
+        throw std::out_of_range("Cannot write more bits than fit into uintmax_t");
+      }
+      assertAvailable(numBits);
+      auto remaining = numBits.value();
+      while (remaining) {
+        const auto bitInByte = offset % BYTE_BITS;
+        const auto chunk = std::min(BYTE_BITS - bitInByte, remaining);
+        const auto shift = BYTE_BITS - bitInByte - chunk;
+        const auto mask = static_cast<uint8_t>(((1U << chunk) - 1U) << shift);
+        const auto bits = static_cast<uint8_t>(((value >> (remaining - chunk)) << shift) & mask);
+        auto &byte = data[offset / BYTE_BITS];
+        // Also clear the lower bits not written yet, so the range never contains stale bits after the position
+        byte = static_cast<std::byte>((static_cast<uint8_t>(byte) & ~((1U << (shift + chunk)) - 1U)) | bits);
+        remaining -= chunk;
+        offset += chunk;
+      }
+    }
+
+    /**
+     * Writes the given amount of aligned bytes.
+     *
+     * Throws an exception if the write position is not byte aligned, see assertAlignment().
+     */
+    constexpr void writeBytes(std::uintmax_t value, ByteCount numBytes) {
+      assertAlignment(1_bytes);
+      write(value, numBytes);
+    }
+
+    /**
+     * Writes a single aligned byte.
+     *
+     * Throws an exception if the write position is not byte aligned, see assertAlignment().
+     */
+    constexpr void writeByte(std::byte byte) { writeBytes(static_cast<uint8_t>(byte), 1_bytes); }
+
+    /**
+     * Writes all bytes in the given input range.
+     *
+     * Throws an exception if the write position is not byte aligned, see assertAlignment().
+     */
+    constexpr void writeBytes(std::span<const std::byte> bytes) {
+      assertAlignment(1_bytes);
+      assertAvailable(ByteCount{bytes.size()});
+      std::copy(bytes.begin(), bytes.end(), data.begin() + static_cast<std::ptrdiff_t>(offset / BYTE_BITS));
+      offset += bytes.size() * BYTE_BITS;
+    }
+
+    /**
+     * Writes all given fixed-width integral values in big endian.
+     *
+     * Throws an exception if the write position is not byte aligned, see assertAlignment().
+     */
+    template <BigEndianValue T>
+    constexpr void writeBigEndian(std::span<const T> values) {
+      assertAlignment(1_bytes);
+      assertAvailable(ByteCount{values.size() * sizeof(T)});
+      using U = std::make_unsigned_t<T>;
+      for (const auto &value : values) {
+        storeBigEndian(data.data() + offset / BYTE_BITS, static_cast<U>(value));
+        offset += sizeof(T) * BYTE_BITS;
+      }
+    }
+
+    /**
+     * Fill the given amount of aligned bytes with copies of the given byte value.
+     *
+     * Throws an exception if the write position is not byte aligned, see assertAlignment().
+     */
+    constexpr void fillBytes(std::byte value, ByteCount numBytes) {
+      assertAlignment(1_bytes);
+      assertAvailable(numBytes);
+      std::fill_n(data.begin() + static_cast<std::ptrdiff_t>(offset / BYTE_BITS), numBytes.value(), value);
+      offset += numBytes.value() * BYTE_BITS;
+    }
+
+    /**
+     * Fills the last partial byte with trailing zeroes.
+     *
+     * This function is equivalent to:
+     *   fillToAligment(1_bytes, 0);
+     */
+    constexpr void flush() { fillToAligment(1_bytes, false); }
+
+  private:
+    static constexpr std::size_t BYTE_BITS = 8;
+    static constexpr std::size_t WORD_BITS = std::numeric_limits<std::uintmax_t>::digits;
+
+    constexpr void assertAvailable(BitCount numBits) const {
+      if (numBits > remainingBits()) [[unlikely]] {
+        throw EndOfStreamError("Cannot write more bytes, end of output reached");
+      }
+    }
+
+  private:
+    ByteRange data;
+    /** The number of bits already written */
+    std::size_t offset = 0;
+  };
+
+} // namespace bml
@@ -786,19 +786,30 @@ namespace bml {
     }
 
     void read(BitReader &reader) {
+      static_assert(sizeof(char) == sizeof(std::byte));
       auto numEntries = reader.read<std::size_t>(BitCount{LengthBits});
-      value_type tmp;
-      tmp.reserve(numEntries);
-      for (std::size_t i = 0; i < numEntries; ++i) {
-        tmp.push_back(bml::read<char>(reader));
+      value_type tmp(numEntries, '\0');
+      if (reader.position() % 8U == 0) {
+        // Read all characters at once if possible
+        reader.readBytesInto(std::as_writable_bytes(std::span{tmp}));
+      } else {
+        for (auto &entry : tmp) {
+          entry = bml::read<char>(reader);
+        }
       }
       value = std::move(tmp);
     }
 
     void write(BitWriter &writer) const {
+      static_assert(sizeof(char) == sizeof(std::byte));
       writer.write(value.size(), BitCount{LengthBits});
-      for (const auto &entry : value) {
-        bml::write(writer, entry);
+      if (writer.position() % 8U == 0) {
+        // Write all characters at once if possible
+        writer.writeBytes(std::as_bytes(std::span{value}));
+      } else {
+        for (const auto &entry : value) {
+          bml::write(writer, entry);
+        }
       }
     }
 
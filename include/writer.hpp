@@ -1,7 +1,11 @@
 #pragma once
 
+#include "helper.hpp"
 #include "sizes.hpp"
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -21,11 +25,13 @@ namespace bml {
    */
   class BitWriter {
     struct GrowTag {};
+    struct DiscardTag {};
 
   public:
     class WriterImpl;
 
     static constexpr GrowTag GROW{};
+    static constexpr DiscardTag DISCARD{};
 
     /**
      * A byte sink consuming a single byte at a time.
@@ -59,6 +65,14 @@ namespace bml {
     /** Delete to force disambiguation between growing and non-growing buffer constructors */
     explicit BitWriter(std::vector<std::byte> &buffer) = delete;
 
+    /**
+     * Creates a bit writer discarding all written data.
+     *
+     * This can be used to determine the size of some data before actually writing it, e.g. via the position() of the
+     * bit writer after writing the data.
+     */
+    explicit BitWriter(DiscardTag);
+
     // Disallow copying, since the different byte sinks might behave differently when being copied
     BitWriter(const BitWriter &) = delete;
     BitWriter(BitWriter &&other) noexcept;
@@ -119,6 +133,31 @@ namespace bml {
      */
     void writeBytes(std::span<const std::byte> bytes);
 
+    /**
+     * Writes all given fixed-width integral values in big endian.
+     *
+     * NOTE: This is more efficient than writing the values one by one, since the values are converted to big endian in
+     * chunks which are then written at once.
+     *
+     * Throws an exception if the write position is not byte aligned, see assertAlignment().
+     */
+    template <BigEndianValue T>
+    void writeBigEndian(std::span<const T> values) {
+      if constexpr (std::endian::native == std::endian::big || sizeof(T) == 1) {
+        writeBytes(std::as_bytes(values));
+      } else {
+        assertAlignment(1_bytes);
+        std::array<T, 4096 / sizeof(T)> chunk;
+        while (!values.empty()) {
+          auto part = std::span{chunk}.first(std::min(values.size(), chunk.size()));
+          std::copy_n(values.begin(), part.size(), part.begin());
+          convertBigEndian(part);
+          writeBytes(std::as_bytes(part));
+          values = values.subspan(part.size());
+        }
+      }
+    }
+
     /**
      * Fill the given amount of aligned bytes with copies of the given byte value.
      *
@@ -136,6 +175,22 @@ namespace bml {
      */
     void writeSignedExpGolomb(std::intmax_t value);
 
+    /**
+     * Encodes all given values with the unsigned Exponential-Golomb coding and writes them to the byte sink.
+     *
+     * NOTE: This is more efficient than calling writeExpGolomb() repeatedly, since as many encoded values as fit into a
+     * single word are written at once.
+     */
+    void writeExpGolomb(std::span<const std::uintmax_t> values);
+
+    /**
+     * Encodes all given values with the signed Exponential-Golomb coding and writes them to the byte sink.
+     *
+     * NOTE: This is more efficient than calling writeSignedExpGolomb() repeatedly, since as many encoded values as fit
+     * into a single word are written at once.
+     */
+    void writeSignedExpGolomb(std::span<const std::intmax_t> values);
+
     /**
      * Writes as many bytes required to UTF-8 encode the given Unicode code point.
      *
@@ -160,6 +215,22 @@ namespace bml {
      */
     void writeSignedFibonacci(int32_t value);
 
+    /**
+     * Encodes all given values with the Fibonacci coding and writes them to the byte sink.
+     *
+     * NOTE: This is more efficient than calling writeFibonacci() repeatedly, since as many encoded values as fit into a
+     * single word are written at once.
+     */
+    void writeFibonacci(std::span<const uint32_t> values);
+
+    /**
+     * Encodes all given values with the Negafibonacci coding and writes them to the byte sink.
+     *
+     * NOTE: This is more efficient than calling writeSignedFibonacci() repeatedly, since as many encoded values as fit
+     * into a single word are written at once.
+     */
+    void writeSignedFibonacci(std::span<const int32_t> values);
+
     /**
      * Fills the last cached partial byte with trailing zeroes and writes all bytes to the underlying byte sink.
      *
@@ -0,0 +1,67 @@
+#include "buffer_pool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace bml {
+
+  WriteBufferPool::Buffer::Buffer(WriteBufferPool &owner, std::vector<std::byte> &&buffer) noexcept
+      : pool(&owner), data(std::move(buffer)) {}
+
+  WriteBufferPool::Buffer::Buffer(Buffer &&other) noexcept
+      : pool(std::exchange(other.pool, nullptr)), data(std::move(other.data)) {}
+
+  WriteBufferPool::Buffer::~Buffer() noexcept { release(); }
+
+  WriteBufferPool::Buffer &WriteBufferPool::Buffer::operator=(Buffer &&other) noexcept {
+    if (this != &other) {
+      release();
+      pool = std::exchange(other.pool, nullptr);
+      data = std::move(other.data);
+    }
+    return *this;
+  }
+
+  void WriteBufferPool::Buffer::release() noexcept {
+    if (pool) {
+      std::exchange(pool, nullptr)->release(std::move(data));
+    }
+  }
+
+  WriteBufferPool::WriteBufferPool(std::size_t maxBuffers, ByteCount maxCapacity) noexcept
+      : maxBuffers(maxBuffers), maxCapacity(maxCapacity) {}
+
+  WriteBufferPool::Buffer WriteBufferPool::acquire(BitCount capacityHint) {
+    const auto capacity = (capacityHint.value() + 7U) / 8U;
+    // Prefer the most recently released buffer which is large enough, since its memory is most likely still cached
+    auto it = std::find_if(idleBuffers.rbegin(), idleBuffers.rend(),
+                           [capacity](const auto &buffer) { return buffer.capacity() >= capacity; });
+    std::vector<std::byte> buffer{};
+    if (it != idleBuffers.rend()) {
+      buffer = std::move(*it);
+      idleBuffers.erase(std::next(it).base());
+    } else if (!idleBuffers.empty()) {
+      buffer = std::move(idleBuffers.back());
+      idleBuffers.pop_back();
+    }
+    buffer.reserve(capacity);
+    return Buffer{*this, std::move(buffer)};
+  }
+
+  WriteBufferPool &WriteBufferPool::threadLocal() noexcept {
+    static thread_local WriteBufferPool pool{};
+    return pool;
+  }
+
+  void WriteBufferPool::release(std::vector<std::byte> &&buffer) noexcept {
+    if (buffer.capacity() == 0 || buffer.capacity() > maxCapacity.value() || idleBuffers.size() >= maxBuffers) {
+      return;
+    }
+    buffer.clear();
+    try {
+      idleBuffers.push_back(std::move(buffer));
+    } catch (...) {
+      // Failing to keep the buffer only affects the reuse, not the correctness
+    }
+  }
+} // namespace bml
@@ -2,6 +2,7 @@
 
 #include "errors.hpp"
 
+#include <algorithm>
 #include <compare>
 #include <type_traits>
 
@@ -22,6 +23,13 @@ namespace bml {
     return one.data() <=> other.data();
   }
 
+  template <typename T>
+  static auto compare(const T &one, const T &other) noexcept
+    requires(!std::three_way_comparable<T>)
+  {
+    return compare(std::span<const std::byte>{one}, std::span<const std::byte>{other});
+  }
+
   bool DataRange::operator==(const DataRange &other) const noexcept {
     return std::visit(
         [](const auto &first, const auto &second) {
@@ -118,7 +126,7 @@ namespace bml {
           if constexpr (std::is_same_v<T, KnownRange>) {
             return std::span<const std::byte>{};
           } else {
-            return std::span{val};
+            return std::span<const std::byte>{val};
           }
         },
         content);
@@ -134,6 +142,8 @@ namespace bml {
             return Mode::BORROWED;
           } else if constexpr (std::is_same_v<T, OwnedRange>) {
             return Mode::OWNED;
+          } else if constexpr (std::is_same_v<T, SharedRange>) {
+            return Mode::SHARED;
           }
         },
         content);
@@ -143,8 +153,8 @@ namespace bml {
     return std::visit(
         [](const auto &val) {
           using T = std::decay_t<decltype(val)>;
-          if constexpr (std::is_same_v<T, OwnedRange>) {
-            return DataRange{std::span{val}};
+          if constexpr (std::is_same_v<T, OwnedRange> || std::is_same_v<T, SharedRange>) {
+            return DataRange{std::span<const std::byte>{val}};
           } else {
             return DataRange{val};
           }
@@ -153,7 +163,16 @@ namespace bml {
   }
 
   std::ostream &operator<<(std::ostream &os, const DataRange &range) {
-    std::visit([&os](const auto &val) { os << printView(val); }, range.content);
+    std::visit(
+        [&os](const auto &val) {
+          using T = std::decay_t<decltype(val)>;
+          if constexpr (std::is_same_v<T, DataRange::SharedRange>) {
+            os << printView(std::span<const std::byte>{val});
+          } else {
+            os << printView(val);
+          }
+        },
+        range.content);
     return os;
   }
 
@@ -171,7 +190,12 @@ namespace bml {
       }
     }
 
-    if (targetMode == DataRange::Mode::OWNED) {
+    if (targetMode == DataRange::Mode::SHARED) {
+      std::shared_ptr<std::byte[]> memory{new std::byte[tmp.size()]};
+      auto *start = memory.get();
+      std::copy(tmp.begin(), tmp.end(), start);
+      range = DataRange{std::shared_ptr<const std::byte>{std::move(memory), start}, tmp.size()};
+    } else if (targetMode == DataRange::Mode::OWNED) {
       range = DataRange(std::vector<std::byte>(tmp.begin(), tmp.end()));
     } else if (targetMode == DataRange::Mode::BORROWED) {
       range = DataRange{tmp};
@@ -183,7 +207,10 @@ namespace bml {
     case DataRange::Mode::KNOWN: {
       auto knownRange = range.byteRange();
       std::vector<std::byte> buffer(knownRange.size.num);
-      input.seekg(static_cast<std::ios::off_type>(knownRange.offset.num), std::ios::beg);
+      // Do not seek when already positioned, which would discard the stream buffer for sequential reads
+      if (input.tellg() != static_cast<std::streampos>(knownRange.offset.num)) {
+        input.seekg(static_cast<std::ios::off_type>(knownRange.offset.num), std::ios::beg);
+      }
       input.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
       if (input.eof()) {
         throw EndOfStreamError("Error reading data range " + knownRange.toString() + " from input stream");
@@ -197,7 +224,47 @@ namespace bml {
       break;
     }
     case DataRange::Mode::OWNED:
+    case DataRange::Mode::SHARED:
       break;
     }
   }
+
+  bool DataRangeBuffer::contains(const ByteRange &range) const noexcept {
+    return range.offset >= bufferedRange.offset &&
+           range.offset + range.size <= bufferedRange.offset + bufferedRange.size;
+  }
+
+  std::span<const std::byte> DataRangeBuffer::read(const ByteRange &range, std::span<const ByteRange> followingRanges) {
+    if (!contains(range)) {
+      auto end = range.offset + range.size;
+      for (const auto &next : followingRanges) {
+        if (next.empty() || next.offset + next.size <= end) {
+          // Nothing to read or already covered
+          continue;
+        }
+        if (next.offset < range.offset || next.offset > end + maxGapSize ||
+            next.offset + next.size > range.offset + maxBufferSize) {
+          break;
+        }
+        end = next.offset + next.size;
+      }
+
+      buffer.resize((end - range.offset).num);
+      // Do not seek when already positioned, which would discard the stream buffer for sequential reads
+      if (inputStream->tellg() != static_cast<std::streampos>(range.offset.num)) {
+        inputStream->seekg(static_cast<std::ios::off_type>(range.offset.num), std::ios::beg);
+      }
+      inputStream->read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+      auto numRead = static_cast<std::size_t>(std::max(inputStream->gcount(), std::streamsize{0}));
+      if (inputStream->eof()) {
+        // Following ranges might be outside of the stream, the requested range is checked below
+        inputStream->clear();
+      }
+      bufferedRange = ByteRange{range.offset, ByteCount{numRead}};
+      if (numRead < range.size.num) {
+        throw EndOfStreamError("Error reading data range " + range.toString() + " from input stream");
+      }
+    }
+    return std::span<const std::byte>{buffer}.subspan((range.offset - bufferedRange.offset).num, range.size.num);
+  }
 } // namespace bml
@@ -204,6 +204,62 @@ namespace bml {
     return result;
   }
 
+  bool isValidUtf8(std::span<const std::byte> data) noexcept {
+    static constexpr uint64_t ASCII_MASK = 0x8080808080808080ULL;
+    const auto *ptr = data.data();
+    const auto *end = ptr + data.size();
+    while (ptr != end) {
+      if (end - ptr >= 8) {
+        uint64_t word;
+        std::memcpy(&word, ptr, sizeof(word));
+        if ((word & ASCII_MASK) == 0) {
+          ptr += sizeof(word);
+          continue;
+        }
+      }
+      const auto lead = static_cast<uint8_t>(*ptr);
+      if (lead < 0x80U) {
+        ++ptr;
+        continue;
+      }
+
+      std::ptrdiff_t numTrailing;
+      uint32_t codePoint;
+      uint32_t minCodePoint;
+      if ((lead & 0xE0U) == 0xC0U) {
+        numTrailing = 1;
+        codePoint = lead & 0x1FU;
+        minCodePoint = 0x80U;
+      } else if ((lead & 0xF0U) == 0xE0U) {
+        numTrailing = 2;
+        codePoint = lead & 0x0FU;
+        minCodePoint = 0x800U;
+      } else if ((lead & 0xF8U) == 0xF0U) {
+        numTrailing = 3;
+        codePoint = lead & 0x07U;
+        minCodePoint = 0x10000U;
+      } else {
+        // Continuation byte without lead byte or invalid lead byte
+        return false;
+      }
+      if (end - ptr <= numTrailing) {
+        return false;
+      }
+      for (std::ptrdiff_t i = 1; i <= numTrailing; ++i) {
+        const auto trailing = static_cast<uint8_t>(ptr[i]);
+        if ((trailing & 0xC0U) != 0x80U) {
+          return false;
+        }
+        codePoint = (codePoint << 6U) | (trailing & 0x3FU);
+      }
+      if (codePoint < minCodePoint || codePoint > 0x10FFFFU || (codePoint >= 0xD800U && codePoint < 0xE000U)) {
+        return false;
+      }
+      ptr += numTrailing + 1;
+    }
+    return true;
+  }
+
   void writeBits(std::ostream &os, std::uintmax_t value, BitCount numBits) {
     if (numBits < 8_bits) {
       os << "0b";
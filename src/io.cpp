@@ -5,6 +5,12 @@
 namespace bml {
   void copyBits(BitReader &reader, BitWriter &writer, BitCount numBits) {
     auto bitsLeft = numBits;
+    if (!(reader.position() % BYTE_SIZE) && !(writer.position() % BYTE_SIZE)) {
+      // Both sides are aligned, copy the full bytes in bulk
+      const ByteCount numBytes{numBits / BYTE_SIZE};
+      reader.copyBytesTo(writer, numBytes);
+      bitsLeft -= numBytes;
+    }
     while (bitsLeft) {
       auto currentBits = std::min(CACHE_SIZE / 2, bitsLeft);
       writer.write(reader.read(currentBits), currentBits);
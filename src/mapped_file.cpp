@@ -0,0 +1,124 @@
+#include "mapped_file.hpp"
+
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bml {
+
+#ifdef _WIN32
+  [[noreturn]] static void throwLastError(const std::string &msg) {
+    throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), msg);
+  }
+
+  static std::span<const std::byte> mapFile(const std::filesystem::path &path) {
+    auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      throwLastError("Failed to open file '" + path.string() + "'");
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file, &fileSize)) {
+      CloseHandle(file);
+      throwLastError("Failed to determine size of file '" + path.string() + "'");
+    }
+    if (fileSize.QuadPart == 0) {
+      // Empty files cannot be mapped
+      CloseHandle(file);
+      return {};
+    }
+
+    auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+      throwLastError("Failed to create mapping for file '" + path.string() + "'");
+    }
+
+    // The view keeps the mapping object alive
+    auto *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view) {
+      throwLastError("Failed to map file '" + path.string() + "'");
+    }
+    return std::span{static_cast<const std::byte *>(view), static_cast<std::size_t>(fileSize.QuadPart)};
+  }
+
+  static void unmapFile(std::span<const std::byte> data) noexcept { UnmapViewOfFile(data.data()); }
+#else
+  [[noreturn]] static void throwLastError(const std::string &msg) {
+    throw std::system_error(errno, std::system_category(), msg);
+  }
+
+  static std::span<const std::byte> mapFile(const std::filesystem::path &path) {
+    auto fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      throwLastError("Failed to open file '" + path.string() + "'");
+    }
+
+    struct stat status {};
+    if (fstat(fd, &status) != 0) {
+      auto error = errno;
+      close(fd);
+      throw std::system_error(error, std::system_category(), "Failed to determine size of file '" + path.string() + "'");
+    }
+    if (status.st_size == 0) {
+      // Empty files cannot be mapped
+      close(fd);
+      return {};
+    }
+
+    auto size = static_cast<std::size_t>(status.st_size);
+    auto *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after closing the file descriptor
+    auto error = errno;
+    close(fd);
+    if (mapping == MAP_FAILED) {
+      throw std::system_error(error, std::system_category(), "Failed to map file '" + path.string() + "'");
+    }
+    // We mostly read sequentially, so allow for aggressive read-ahead
+    madvise(mapping, size, MADV_SEQUENTIAL);
+    return std::span{static_cast<const std::byte *>(mapping), size};
+  }
+
+  static void unmapFile(std::span<const std::byte> data) noexcept {
+    munmap(const_cast<std::byte *>(data.data()), data.size());
+  }
+#endif
+
+  MappedFile::MappedFile(const std::filesystem::path &path) : mappedData(mapFile(path)) {}
+
+  MappedFile::MappedFile(MappedFile &&other) noexcept : mappedData(std::exchange(other.mappedData, {})) {}
+
+  MappedFile::~MappedFile() noexcept { unmap(); }
+
+  MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+      unmap();
+      mappedData = std::exchange(other.mappedData, {});
+    }
+    return *this;
+  }
+
+  void MappedFile::unmap() noexcept {
+    if (!mappedData.empty()) {
+      unmapFile(mappedData);
+      mappedData = {};
+    }
+  }
+} // namespace bml
@@ -109,6 +109,10 @@ namespace bml::detail {
     return printUtf8String(os, view.value);
   }
 
+  std::ostream &operator<<(std::ostream &os, const PrintView<std::u8string_view> &view) {
+    return printUtf8String(os, view.value);
+  }
+
   std::ostream &operator<<(std::ostream &os, const PrintView<std::monostate> &) { return os << "(empty)"; }
 
 } // namespace bml::detail
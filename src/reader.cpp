@@ -4,9 +4,18 @@
 #include "common.hpp"
 #include "errors.hpp"
 #include "helper.hpp"
+#include "span_reader.hpp"
+#include "writer.hpp"
 
 #include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 
 namespace bml {
   class BitReader::ReaderImpl {
@@ -70,7 +79,7 @@ namespace bml {
       if (!extractSourceByte(byte)) [[unlikely]] {
         throwOnEndOfStream();
       }
-      ++sourceBytesRead;
+      consumeSourceBytes(1_bytes);
       return byte;
     }
 
@@ -80,7 +89,7 @@ namespace bml {
         outBytes = outBytes.subspan<1>();
       }
       if (extractSourceBytes(outBytes)) [[likely]] {
-        sourceBytesRead += outBytes.size() * 1_bytes;
+        consumeSourceBytes(ByteCount{outBytes.size()});
       } else {
         throwOnEndOfStream();
       }
@@ -111,7 +120,7 @@ namespace bml {
       }
       // 2. read remainder directly from the underlying source
       auto additionalBytes = extractSourceBytesUntil(pattern, result);
-      sourceBytesRead += additionalBytes;
+      consumeSourceBytes(additionalBytes);
       return numBytes + additionalBytes;
     }
 
@@ -132,6 +141,9 @@ namespace bml {
         }
         numBitsSkipped += numBytes;
         sourceBytesRead += numBytes;
+        if (statistics) [[unlikely]] {
+          statistics->bytesSkipped += numBytes;
+        }
       }
 
       // 3. Skip any remaining bits
@@ -142,6 +154,78 @@ namespace bml {
       }
     }
 
+    void copyBytesTo(BitWriter &writer, ByteCount numBytes) {
+      // 1. Copy the remainder of the cache, which only contains full bytes for aligned reads
+      while (cacheSize && numBytes) {
+        writer.writeByte(static_cast<std::byte>(read(1_bytes)));
+        --numBytes;
+      }
+
+      // 2. Pass the bytes directly from the source memory, if supported
+      while (numBytes) {
+        auto bytes = borrowSourceBytes(numBytes);
+        if (bytes.empty()) {
+          break;
+        }
+        consumeSourceBytes(ByteCount{bytes.size()});
+        numBytes -= ByteCount{bytes.size()};
+        writer.writeBytes(bytes);
+      }
+
+      // 3. Copy any remaining bytes in chunks via an intermediate buffer
+      std::array<std::byte, 16384> chunk;
+      while (numBytes) {
+        auto bytes = std::span{chunk}.first(std::min(numBytes.value(), chunk.size()));
+        readBytesInto(bytes);
+        numBytes -= ByteCount{bytes.size()};
+        writer.writeBytes(bytes);
+      }
+    }
+
+    void seek(BitCount target) {
+      if ((target > position() && target < sourceBytesRead) || (target >= position() && !isSeekable())) {
+        // Target is within the cache or we cannot seek the source anyway. Seeking to the current position or the end
+        // of the cache re-positions the source, e.g. to allow reading data appended after reaching the end of stream.
+        skip(target - position());
+        return;
+      }
+      if (!isSeekable()) [[unlikely]] {
+        throw std::runtime_error("The underlying byte source does not support seeking backwards");
+      }
+
+      const ByteCount targetByte{target / 1_bytes};
+      if (!seekSource(targetByte)) [[unlikely]] {
+        throw EndOfStreamError("Cannot seek to position " + target.toString() + ", not within the input");
+      }
+      if (statistics) [[unlikely]] {
+        ++statistics->numSeeks;
+      }
+      sourceBytesRead = targetByte;
+      cache = 0;
+      cacheSize = 0_bits;
+      if (auto numBits = target % 1_bytes) {
+        read(numBits);
+      }
+    }
+
+    /**
+     * Returns whether the underlying source supports seeking to arbitrary byte positions via seekSource().
+     */
+    virtual bool isSeekable() const noexcept { return false; }
+
+    /**
+     * Seeks the underlying source to the given absolute byte position and returns whether the position is valid.
+     */
+    [[nodiscard]] virtual bool seekSource(ByteCount /* position */) { return false; }
+
+    /**
+     * Creates a new source reading the given byte range (relative to the start of this source) of the underlying
+     * source, independent of the current position of this source.
+     *
+     * Returns nullptr if the underlying source does not support random access.
+     */
+    virtual std::unique_ptr<ReaderImpl> createSubSource(bml::ByteRange /* range */) const { return nullptr; }
+
     /**
      * Reads until the uppermost bit in the cache is set and return the number of leading zero bits.
      */
@@ -174,29 +258,97 @@ namespace bml {
         }
         makeAvailable(BYTE_SIZE);
       }
-      bool lastBitSet = false;
-      bool nextBitSet = false;
-      while (true) {
-        nextBitSet = read();
-        result.numBits += 1_bits;
-        result.value <<= 1_bits;
-        result.value |= nextBitSet ? 1U : 0U;
-        if (nextBitSet && lastBitSet) {
+      // the first of the highest two consecutive set bits marks the end of the value
+      const BitCount numRemainingBits{static_cast<uint32_t>(std::countl_zero(cache & (cache << 1U))) + 2U};
+      result.value = result.numBits ? (result.value << numRemainingBits) : 0U;
+      result.value |= read(numRemainingBits);
+      result.numBits += numRemainingBits;
+      return result;
+    }
+
+    /**
+     * Decodes as many complete Exponential-Golomb encoded values as fit into the (refilled) cache into the given output
+     * range and returns the number of values decoded.
+     *
+     * Values which do not (completely) fit into the cache are not decoded and need to be read via the generic
+     * readLeadingZeroes() function.
+     */
+    template <typename T, typename Decoder>
+    std::size_t readExpGolombsFromCache(std::span<T> outValues, Decoder &&decode) {
+      refillCache();
+      Cache tmp{cache, cacheSize};
+      std::size_t numValues = 0;
+      while (numValues < outValues.size() && tmp.value) {
+        const auto numLeadingZeroes = static_cast<std::size_t>(std::countl_zero(tmp.value));
+        const BitCount numBits{2U * numLeadingZeroes + 1U /* marker 1-bit */};
+        if (numBits > tmp.size) {
           break;
         }
-        lastBitSet = nextBitSet;
+        outValues[numValues++] = decode(readFromCache(tmp, numBits));
       }
-      return result;
+      cache = tmp.value;
+      cacheSize = tmp.size;
+      return numValues;
+    }
+
+    /**
+     * Decodes as many complete Fibonacci encoded values as fit into the (refilled) cache into the given output range
+     * and returns the number of values decoded.
+     *
+     * Values which do not (completely) fit into the cache are not decoded and need to be read via the generic
+     * readUntilTwoOnes() function.
+     */
+    template <typename T, typename Decoder>
+    std::size_t readFibonaccisFromCache(std::span<T> outValues, Decoder &&decode) {
+      refillCache();
+      Cache tmp{cache, cacheSize};
+      std::size_t numValues = 0;
+      while (numValues < outValues.size()) {
+        // Since the encoded values never contain two consecutive set bits, the first pair terminates the value
+        const auto terminators = tmp.value & (tmp.value << 1U);
+        if (!terminators) {
+          break;
+        }
+        const BitCount numBits{static_cast<std::size_t>(std::countl_zero(terminators)) + 2U};
+        outValues[numValues++] = decode(invertBits(readFromCache(tmp, numBits), numBits));
+      }
+      cache = tmp.value;
+      cacheSize = tmp.size;
+      return numValues;
     }
 
   protected:
     void makeAvailable(BitCount numBits, bool throwOnEos = true) {
       Cache tmp{cache, cacheSize};
-      sourceBytesRead += fillCache(
-          tmp, numBits, [this](std::byte &nextByte) { return extractSourceByte(nextByte); },
-          throwOnEos ? throwOnEndOfStream : throwNoError);
+      // Only throw after storing the filled cache, so a temporary end of the source does not lose any extracted byte
+      consumeSourceBytes(fillSourceCache(tmp, numBits));
       cache = tmp.value;
       cacheSize = tmp.size;
+      if (throwOnEos && cacheSize < numBits) [[unlikely]] {
+        throwOnEndOfStream();
+      }
+    }
+
+    /**
+     * Fills as many full bytes into the cache as fit without throwing on the end of the underlying source.
+     */
+    void refillCache() {
+      if (auto numBytes = ByteCount{(CACHE_SIZE - cacheSize) / 1_bytes}) {
+        makeAvailable(cacheSize + numBytes, false);
+      }
+    }
+
+    /**
+     * Fills the given cache with at least the given number of bits from the underlying source (if available) and
+     * returns the number of bytes extracted from the source.
+     *
+     * NOTE: Implementations MUST NOT throw on reaching the end of the source, this is handled by the caller.
+     *
+     * The default implementation extracts one byte at a time via extractSourceByte().
+     */
+    virtual ByteCount fillSourceCache(Cache &tmp, BitCount numBits) {
+      return fillCache(
+          tmp, numBits, [this](std::byte &nextByte) { return extractSourceByte(nextByte); }, throwNoError);
     }
 
     [[nodiscard]] virtual bool extractSourceByte(std::byte &out) { return extractSourceBytes(std::span{&out, 1}); }
@@ -221,10 +373,7 @@ namespace bml {
           // candidate still matches so far
           if (candidate.size() == pattern.size()) {
             // pattern found, add to cache and return
-            auto tmp = setCache(candidate);
-            cache = tmp.value;
-            cacheSize = tmp.size;
-            sourceBytesRead += ByteCount{candidate.size()};
+            restoreSourceBytes(candidate);
             candidate.clear();
             break;
           }
@@ -252,12 +401,56 @@ namespace bml {
 
     [[nodiscard]] virtual bool skipSourceBytes(ByteCount numBytes) = 0;
 
-  private:
+    /**
+     * Consumes up to the given number of bytes from the underlying source and returns them as view into the memory
+     * owned by the source, without copying them.
+     *
+     * Returns an empty range if the source does not support this or the end of the source is reached.
+     *
+     * NOTE: The returned bytes are only valid until the next access to the source.
+     *
+     * The default implementation does not support accessing the source memory.
+     */
+    virtual std::span<const std::byte> borrowSourceBytes(ByteCount /* maxNumBytes */) { return {}; }
+
     static void throwNoError() noexcept {}
     [[noreturn]] static void throwOnEndOfStream() {
       throw EndOfStreamError("Cannot read more bytes, end of input reached");
     }
 
+    /**
+     * Puts the given bytes already extracted from the underlying source back into the (empty) cache to be read next.
+     */
+    void restoreSourceBytes(std::span<const std::byte> bytes) {
+      auto tmp = setCache(bytes);
+      cache = tmp.value;
+      cacheSize = tmp.size;
+      consumeSourceBytes(ByteCount{bytes.size()});
+    }
+
+    /**
+     * Counts a read of the given number of bytes from the underlying byte source, e.g. a refill of a read-ahead buffer.
+     */
+    void countSourceRead(std::size_t numBytes) noexcept {
+      if (statistics) [[unlikely]] {
+        ++statistics->numSourceReads;
+        statistics->sourceBytesRead += ByteCount{numBytes};
+      }
+    }
+
+    /**
+     * Returns the number of full bytes already extracted from the underlying source but not yet read from the cache.
+     */
+    std::size_t numCachedBytes() const noexcept { return cacheSize.value() / 8U; }
+
+  private:
+    void consumeSourceBytes(ByteCount numBytes) noexcept {
+      sourceBytesRead += numBytes;
+      if (statistics) [[unlikely]] {
+        statistics->bytesRead += numBytes;
+      }
+    }
+
     static uintmax_t toNumber(std::span<const std::byte> pattern) {
       auto cache = setCache(pattern);
       return readFromCache(cache, ByteCount{pattern.size()});
@@ -279,6 +472,12 @@ namespace bml {
       return cache;
     }
 
+  public:
+    /** The reader this reader (transitively) reads its data from, if any */
+    BitReader *baseReader = nullptr;
+    /** The statistics to count the source accesses into, if any */
+    ReaderStatistics *statistics = nullptr;
+
   private:
     ByteCount sourceBytesRead;
     BitCount cacheSize;
@@ -286,6 +485,32 @@ namespace bml {
     std::uintmax_t cache = 0;
   };
 
+  /**
+   * Returns the offset of the first occurrence of the given pattern in the given data.
+   *
+   * If the pattern is not found, returns the offset of the trailing bytes of the data matching the beginning of the
+   * pattern (i.e. a possible match continuing beyond the data) or the size of the data if there is no such partial
+   * match.
+   */
+  static std::size_t findPattern(std::span<const std::byte> data, std::span<const std::byte> pattern) noexcept {
+    std::size_t offset = 0;
+    while (offset < data.size()) {
+      // Quickly skip to the next candidate position with the (vectorized) memchr
+      const auto *candidate = static_cast<const std::byte *>(
+          std::memchr(data.data() + offset, std::to_integer<int>(pattern.front()), data.size() - offset));
+      if (!candidate) {
+        break;
+      }
+      offset = static_cast<std::size_t>(candidate - data.data());
+      auto numCompare = std::min(pattern.size(), data.size() - offset);
+      if (std::memcmp(candidate, pattern.data(), numCompare) == 0) {
+        return offset;
+      }
+      ++offset;
+    }
+    return data.size();
+  }
+
   struct ByteGeneratorImpl final : BitReader::ReaderImpl {
     explicit ByteGeneratorImpl(BitReader::ByteGenerator &&generator) : generateByte(std::move(generator)) {}
 
@@ -314,7 +539,20 @@ namespace bml {
   };
 
   struct ByteReadRangeImpl final : BitReader::ReaderImpl {
-    explicit ByteReadRangeImpl(BitReader::ByteRange range) : sourceRange(range) {}
+    explicit ByteReadRangeImpl(BitReader::ByteRange range) : fullRange(range), sourceRange(range) {}
+
+    ByteCount fillSourceCache(Cache &tmp, BitCount numBits) override {
+      if (numBits > CACHE_SIZE) [[unlikely]] {
+        throw std::out_of_range("Cannot read more bits than fit into uintmax_t");
+      }
+      if (tmp.size >= numBits) {
+        return 0_bytes;
+      }
+      // Load as many bytes as fit with a single word access instead of extracting byte per byte
+      auto numBytes = detail::fillCacheFromRange(tmp.value, tmp.size, sourceRange);
+      sourceRange = sourceRange.subspan(numBytes);
+      return ByteCount{numBytes};
+    }
 
     bool extractSourceBytes(std::span<std::byte> outBytes) override {
       if (outBytes.size() > sourceRange.size()) {
@@ -326,13 +564,16 @@ namespace bml {
     }
 
     ByteCount extractSourceBytesUntil(std::span<const std::byte> pattern, std::vector<std::byte> *result) override {
-      auto end = std::search(sourceRange.begin(), sourceRange.end(), pattern.begin(), pattern.end());
-      auto numBytes = ByteCount{static_cast<std::size_t>(std::distance(sourceRange.begin(), end))};
+      auto offset = findPattern(sourceRange, pattern);
+      if (sourceRange.size() - offset < pattern.size()) {
+        // Only a partial match at the end of the data, i.e. no match at all
+        offset = sourceRange.size();
+      }
       if (result) {
-        result->insert(result->end(), sourceRange.begin(), end);
+        result->insert(result->end(), sourceRange.begin(), sourceRange.begin() + static_cast<std::ptrdiff_t>(offset));
       }
-      sourceRange = BitReader::ByteRange{end, sourceRange.end()};
-      return numBytes;
+      sourceRange = sourceRange.subspan(offset);
+      return ByteCount{offset};
     }
 
     bool skipSourceBytes(ByteCount numBytes) override {
@@ -343,15 +584,57 @@ namespace bml {
       return true;
     }
 
+    std::span<const std::byte> borrowSourceBytes(ByteCount maxNumBytes) override {
+      auto bytes = sourceRange.first(std::min(maxNumBytes.value(), sourceRange.size()));
+      sourceRange = sourceRange.subspan(bytes.size());
+      return bytes;
+    }
+
+    bool isSeekable() const noexcept override { return true; }
+
+    bool seekSource(ByteCount position) override {
+      if (position > ByteCount{fullRange.size()}) {
+        return false;
+      }
+      sourceRange = fullRange.subspan(position.value());
+      return true;
+    }
+
+    std::unique_ptr<ReaderImpl> createSubSource(bml::ByteRange range) const override {
+      if (range.offset + range.size > ByteCount{fullRange.size()}) {
+        throw EndOfStreamError("Cannot read range " + range.toString() + ", not within the input");
+      }
+      return std::make_unique<ByteReadRangeImpl>(range.applyTo(fullRange));
+    }
+
+    BitReader::ByteRange fullRange;
+    /** The part of the range not yet consumed */
     BitReader::ByteRange sourceRange;
   };
 
+  /**
+   * Seeks the given input stream to the given byte position relative to the given start position and returns whether
+   * the new position is valid.
+   */
+  static bool seekStream(std::istream &input, std::istream::pos_type start, ByteCount position) {
+    input.clear(input.rdstate() & ~std::ios::eofbit & ~std::ios::failbit);
+    input.seekg(start + static_cast<std::streamoff>(position.value()));
+    return !input.fail();
+  }
+
+  static std::unique_ptr<BitReader::ReaderImpl> createSubStream(std::istream &input, std::istream::pos_type start,
+                                                                bml::ByteRange range, ByteCount readAheadSize,
+                                                                std::shared_ptr<std::mutex> streamMutex = nullptr);
+
   struct ByteInputStreamImpl final : BitReader::ReaderImpl {
-    explicit ByteInputStreamImpl(std::istream &is) : input(is) { input.exceptions(std::ios::badbit); }
+    explicit ByteInputStreamImpl(std::istream &is) : input(is), start(is.tellg()) {
+      input.exceptions(std::ios::badbit);
+    }
 
     bool extractSourceByte(std::byte &out) override {
       if (!input.eof()) {
         input.read(reinterpret_cast<char *>(&out), 1);
+        countSourceRead(static_cast<std::size_t>(input.gcount()));
         return static_cast<bool>(input);
       }
       return false;
@@ -360,6 +643,7 @@ namespace bml {
     bool extractSourceBytes(std::span<std::byte> outBytes) override {
       if (!input.eof()) {
         input.read(reinterpret_cast<char *>(outBytes.data()), static_cast<std::streamsize>(outBytes.size()));
+        countSourceRead(static_cast<std::size_t>(input.gcount()));
         return static_cast<bool>(input);
       }
       return false;
@@ -370,13 +654,608 @@ namespace bml {
       return static_cast<bool>(input);
     }
 
+    bool isSeekable() const noexcept override { return start != std::istream::pos_type(-1); }
+
+    bool seekSource(ByteCount position) override { return seekStream(input, start, position); }
+
+    std::unique_ptr<ReaderImpl> createSubSource(bml::ByteRange range) const override {
+      return isSeekable() ? createSubStream(input, start, range, BitReader::DEFAULT_READ_AHEAD) : nullptr;
+    }
+
+    std::istream &input;
+    /** The initial stream position, the invalid position -1 for non-seekable streams */
+    std::istream::pos_type start;
+  };
+
+  /**
+   * Base type for byte sources reading ahead larger chunks of bytes into an internal buffer.
+   */
+  struct BufferedReaderImpl : BitReader::ReaderImpl {
+    explicit BufferedReaderImpl(ByteCount readAheadSize) : buffer(std::max(readAheadSize, 1_bytes).num) {}
+
+    bool extractSourceByte(std::byte &out) override {
+      if (pending.empty() && !refillBuffer()) [[unlikely]] {
+        return false;
+      }
+      out = pending.front();
+      pending = pending.subspan<1>();
+      return true;
+    }
+
+    bool extractSourceBytes(std::span<std::byte> outBytes) override {
+      while (!outBytes.empty()) {
+        if (pending.empty() && outBytes.size() >= buffer.size()) {
+          // Large reads bypass the buffer
+          auto numBytes = readChunk(outBytes);
+          countSourceRead(numBytes);
+          if (!numBytes) [[unlikely]] {
+            return false;
+          }
+          outBytes = outBytes.subspan(numBytes);
+          continue;
+        }
+        if (pending.empty() && !refillBuffer()) [[unlikely]] {
+          return false;
+        }
+        auto numBytes = std::min(outBytes.size(), pending.size());
+        std::copy_n(pending.begin(), numBytes, outBytes.begin());
+        pending = pending.subspan(numBytes);
+        outBytes = outBytes.subspan(numBytes);
+      }
+      return true;
+    }
+
+    ByteCount fillSourceCache(Cache &tmp, BitCount numBits) override {
+      if (numBits > CACHE_SIZE) [[unlikely]] {
+        throw std::out_of_range("Cannot read more bits than fit into uintmax_t");
+      }
+      std::size_t numBytes = 0;
+      while (tmp.size < numBits) {
+        if (pending.empty() && numMissingBytes(tmp, numBits) > buffer.size()) {
+          // For read-ahead buffers smaller than the missing bytes (e.g. of wrapping readers not allowed to read ahead),
+          // read all missing bytes at once instead of refilling the buffer for every single byte
+          std::array<std::byte, sizeof(std::uintmax_t)> chunk;
+          auto numRead = readChunk(std::span{chunk}.first(numMissingBytes(tmp, numBits)));
+          countSourceRead(numRead);
+          if (!numRead) [[unlikely]] {
+            break;
+          }
+          numBytes += detail::fillCacheFromRange(tmp.value, tmp.size, std::span{chunk}.first(numRead));
+          continue;
+        }
+        if (pending.empty() && !refillBuffer()) [[unlikely]] {
+          break;
+        }
+        auto numLoaded = detail::fillCacheFromRange(tmp.value, tmp.size, pending);
+        if (!numLoaded) {
+          // no other full byte fits into the cache
+          break;
+        }
+        pending = pending.subspan(numLoaded);
+        numBytes += numLoaded;
+      }
+      return ByteCount{numBytes};
+    }
+
+    ByteCount extractSourceBytesUntil(std::span<const std::byte> pattern, std::vector<std::byte> *result) override {
+      if (pattern.size() > sizeof(uintmax_t)) [[unlikely]] {
+        return ReaderImpl::extractSourceBytesUntil(pattern, result);
+      }
+      auto numBytes = 0_bytes;
+      const auto consume = [&numBytes, result](std::span<const std::byte> bytes) {
+        numBytes += ByteCount{bytes.size()};
+        if (result) {
+          result->insert(result->end(), bytes.begin(), bytes.end());
+        }
+      };
+
+      // Bytes at the end of previous chunks matching the beginning of the pattern. Since patterns are limited to the
+      // cache size, these always fit into the cache.
+      std::array<std::byte, sizeof(uintmax_t)> partial{};
+      std::size_t numPartial = 0;
+      while (!pending.empty() || refillBuffer()) {
+        while (numPartial) {
+          auto remainder = pattern.subspan(numPartial);
+          auto numCompare = std::min(remainder.size(), pending.size());
+          if (std::equal(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(numCompare),
+                         remainder.begin())) {
+            break;
+          }
+          // Not a match, drop partial bytes until the remaining ones match the beginning of the pattern again
+          do {
+            consume(std::span{partial}.first(1));
+            std::copy(partial.begin() + 1, partial.end(), partial.begin());
+            --numPartial;
+          } while (numPartial && !std::equal(partial.begin(), partial.begin() + static_cast<std::ptrdiff_t>(numPartial),
+                                             pattern.begin()));
+        }
+
+        if (numPartial) {
+          auto numMissing = pattern.size() - numPartial;
+          if (pending.size() >= numMissing) {
+            // Pattern found across the chunk border, keep the already extracted part in the cache
+            restoreSourceBytes(std::span{partial}.first(numPartial));
+            return numBytes;
+          }
+          // The pattern might continue in the next chunk
+          std::copy(pending.begin(), pending.end(), partial.begin() + static_cast<std::ptrdiff_t>(numPartial));
+          numPartial += pending.size();
+          pending = {};
+          continue;
+        }
+
+        auto offset = findPattern(pending, pattern);
+        consume(pending.first(offset));
+        pending = pending.subspan(offset);
+        if (pending.size() >= pattern.size()) {
+          // Pattern found, keep it as the next bytes to read
+          return numBytes;
+        }
+        // Remember any possible partial match at the end of the chunk
+        std::copy(pending.begin(), pending.end(), partial.begin());
+        numPartial = pending.size();
+        pending = {};
+      }
+      // End of stream, add remaining
+      consume(std::span{partial}.first(numPartial));
+      return numBytes;
+    }
+
+    bool skipSourceBytes(ByteCount numBytes) override {
+      auto numBuffered = std::min(numBytes.num, pending.size());
+      pending = pending.subspan(numBuffered);
+      numBytes -= ByteCount{numBuffered};
+      return !numBytes || skipChunk(numBytes);
+    }
+
+    std::span<const std::byte> borrowSourceBytes(ByteCount maxNumBytes) override {
+      if (pending.empty() && !refillBuffer()) {
+        return {};
+      }
+      auto bytes = pending.first(std::min(maxNumBytes.value(), pending.size()));
+      pending = pending.subspan(bytes.size());
+      return bytes;
+    }
+
+  protected:
+    /**
+     * Returns the number of full bytes required to fill the given cache up to at least the given number of bits, limited
+     * to the bytes fitting into the cache.
+     */
+    static std::size_t numMissingBytes(const Cache &tmp, BitCount numBits) noexcept {
+      return std::min((numBits - tmp.size).value() + 7U, (CACHE_SIZE - tmp.size).value()) / 8U;
+    }
+
+    /**
+     * Reads up to the size of the output range bytes from the underlying source and returns the number of bytes read.
+     */
+    virtual std::size_t readChunk(std::span<std::byte> outBytes) = 0;
+
+    /**
+     * Skips the given number of bytes directly in the underlying source.
+     */
+    virtual bool skipChunk(ByteCount numBytes) {
+      // Skip in larger chunks than the read-ahead buffer, if it is very small
+      std::array<std::byte, 4096> scratch;
+      std::span<std::byte> skipBuffer = buffer.size() >= scratch.size() ? std::span{buffer} : std::span{scratch};
+      while (numBytes) {
+        auto numRead = readChunk(skipBuffer.first(std::min(numBytes.num, skipBuffer.size())));
+        countSourceRead(numRead);
+        if (!numRead) {
+          return false;
+        }
+        numBytes -= ByteCount{numRead};
+      }
+      return true;
+    }
+
+    bool refillBuffer() {
+      auto numBytes = readChunk(buffer);
+      countSourceRead(numBytes);
+      pending = std::span{buffer}.first(numBytes);
+      return numBytes != 0;
+    }
+
+    std::vector<std::byte> buffer;
+    /** The part of the buffer not yet consumed */
+    std::span<const std::byte> pending;
+  };
+
+  struct ChunkGeneratorImpl final : BufferedReaderImpl {
+    ChunkGeneratorImpl(BitReader::ChunkGenerator &&generator, ByteCount readAheadSize)
+        : BufferedReaderImpl(readAheadSize), generateChunk(std::move(generator)) {}
+
+    std::size_t readChunk(std::span<std::byte> outBytes) override { return generateChunk(outBytes); }
+
+    BitReader::ChunkGenerator generateChunk;
+  };
+
+  struct BufferedInputStreamImpl final : BufferedReaderImpl {
+    BufferedInputStreamImpl(std::istream &is, ByteCount readAheadSize)
+        : BufferedReaderImpl(readAheadSize), input(is), start(is.tellg()) {
+      input.exceptions(std::ios::badbit);
+    }
+
+    ~BufferedInputStreamImpl() noexcept override {
+      auto numBytes = pending.size() + numCachedBytes();
+      if (!numBytes) {
+        return;
+      }
+      // Return the buffered (or cached) but not yet consumed bytes to the stream, so it can be used by someone else
+      // afterwards
+      try {
+        auto state = input.rdstate();
+        input.clear(state & ~std::ios::eofbit & ~std::ios::failbit);
+        if (!input.seekg(-static_cast<std::streamoff>(numBytes), std::ios::cur)) {
+          input.clear(state);
+        }
+      } catch (...) {
+        // Not seekable, nothing we can do
+      }
+    }
+
+    std::size_t readChunk(std::span<std::byte> outBytes) override {
+      if (input.eof()) {
+        return 0;
+      }
+      input.read(reinterpret_cast<char *>(outBytes.data()), static_cast<std::streamsize>(outBytes.size()));
+      return static_cast<std::size_t>(input.gcount());
+    }
+
+    bool skipChunk(ByteCount numBytes) override {
+      input.ignore(static_cast<std::streamsize>(numBytes.value()));
+      return static_cast<std::size_t>(input.gcount()) == numBytes.value();
+    }
+
+    bool isSeekable() const noexcept override { return start != std::istream::pos_type(-1); }
+
+    bool seekSource(ByteCount position) override {
+      pending = {};
+      return seekStream(input, start, position);
+    }
+
+    std::unique_ptr<ReaderImpl> createSubSource(bml::ByteRange range) const override {
+      return isSeekable() ? createSubStream(input, start, range, ByteCount{buffer.size()}) : nullptr;
+    }
+
+    std::istream &input;
+    /** The initial stream position, the invalid position -1 for non-seekable streams */
+    std::istream::pos_type start;
+  };
+
+  /**
+   * Byte source reading a range of an input stream shared with other readers.
+   *
+   * Since the other readers expect the stream to not be modified, every access seeks the stream to the current
+   * position within the range and restores the previous stream position and state afterwards.
+   *
+   * If the stream is also accessed by a background thread (see PrefetchingInputStreamImpl), every access locks the
+   * mutex guarding the stream accesses.
+   */
+  struct SubStreamImpl final : BufferedReaderImpl {
+    SubStreamImpl(std::istream &is, std::istream::pos_type rangeStart, ByteCount rangeSize, ByteCount readAheadSize,
+                  std::shared_ptr<std::mutex> mutex)
+        : BufferedReaderImpl(std::min(readAheadSize, rangeSize)), input(is), start(rangeStart), size(rangeSize),
+          streamMutex(std::move(mutex)) {}
+
+    std::size_t readChunk(std::span<std::byte> outBytes) override {
+      auto numBytes = std::min(outBytes.size(), (size - offset).value());
+      if (!numBytes) {
+        return 0;
+      }
+
+      std::unique_lock<std::mutex> lock{};
+      if (streamMutex) {
+        lock = std::unique_lock{*streamMutex};
+      }
+
+      // Clear the state first, since tellg() fails for streams at their end
+      auto state = input.rdstate();
+      input.clear();
+      auto previousPosition = input.tellg();
+      std::size_t numRead = 0;
+      if (seekStream(input, start, offset)) {
+        input.read(reinterpret_cast<char *>(outBytes.data()), static_cast<std::streamsize>(numBytes));
+        numRead = static_cast<std::size_t>(input.gcount());
+      }
+      input.clear();
+      if (previousPosition != std::istream::pos_type(-1)) {
+        input.seekg(previousPosition);
+      }
+      input.clear(state);
+
+      offset += ByteCount{numRead};
+      return numRead;
+    }
+
+    bool skipChunk(ByteCount numBytes) override {
+      if (numBytes > size - offset) {
+        offset = size;
+        return false;
+      }
+      offset += numBytes;
+      return true;
+    }
+
+    bool isSeekable() const noexcept override { return true; }
+
+    bool seekSource(ByteCount position) override {
+      if (position > size) {
+        return false;
+      }
+      pending = {};
+      offset = position;
+      return true;
+    }
+
+    std::unique_ptr<ReaderImpl> createSubSource(bml::ByteRange range) const override {
+      if (range.offset + range.size > size) {
+        throw EndOfStreamError("Cannot read range " + range.toString() + ", not within the input");
+      }
+      return createSubStream(input, start, range, ByteCount{buffer.size()}, streamMutex);
+    }
+
+    std::istream &input;
+    /** The stream position of the range start */
+    std::istream::pos_type start;
+    ByteCount size;
+    /** The offset of the next byte to read from the stream, relative to the range start */
+    ByteCount offset;
+    /** The mutex guarding all accesses to the stream, if shared with a background thread */
+    std::shared_ptr<std::mutex> streamMutex;
+  };
+
+  static std::unique_ptr<BitReader::ReaderImpl> createSubStream(std::istream &input, std::istream::pos_type start,
+                                                                bml::ByteRange range, ByteCount readAheadSize,
+                                                                std::shared_ptr<std::mutex> streamMutex) {
+    return std::make_unique<SubStreamImpl>(input, start + static_cast<std::streamoff>(range.offset.value()),
+                                           range.size, readAheadSize, std::move(streamMutex));
+  }
+
+  /**
+   * Base type for byte sources reading ahead several chunks of bytes on a background thread.
+   *
+   * The background thread is started on the first access to the source and keeps up to the configured number of
+   * chunks filled ahead of the read position. Completely filled chunks are handed to the reader by swapping them with
+   * the read-ahead buffer, without copying the bytes.
+   */
+  struct PrefetchingReaderImpl : BufferedReaderImpl {
+    PrefetchingReaderImpl(BitReader::ChunkGenerator &&generator, ByteCount readAheadSize, std::size_t numChunks)
+        : BufferedReaderImpl(readAheadSize), generateChunk(std::move(generator)) {
+      freeChunks.reserve(numChunks);
+      for (std::size_t i = 0; i < numChunks; ++i) {
+        freeChunks.emplace_back(buffer.size());
+      }
+    }
+
+    ~PrefetchingReaderImpl() noexcept override { stopPrefetching(); }
+
+    std::size_t readChunk(std::span<std::byte> outBytes) override {
+      return takeBytes(outBytes.data(), outBytes.size());
+    }
+
+    bool skipChunk(ByteCount numBytes) override {
+      while (numBytes) {
+        // Only mark the bytes as consumed without copying them out of the chunks
+        auto numSkipped = takeBytes(nullptr, numBytes.value());
+        if (!numSkipped) {
+          return false;
+        }
+        numBytes -= ByteCount{numSkipped};
+      }
+      return true;
+    }
+
+  protected:
+    /**
+     * Stops the background thread after the currently running chunk read (if any) finished.
+     */
+    void stopPrefetching() noexcept {
+      {
+        std::scoped_lock lock{mutex};
+        stopRequested = true;
+      }
+      condition.notify_all();
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+
+    /**
+     * Drops all chunks read ahead but not yet consumed, e.g. after the underlying source was repositioned.
+     *
+     * NOTE: The background thread needs to be stopped before calling this function.
+     */
+    void dropPrefetchedChunks() noexcept {
+      for (auto &chunk : filledChunks) {
+        freeChunks.push_back(std::move(chunk.data));
+      }
+      filledChunks.clear();
+      readError = nullptr;
+    }
+
+    /**
+     * Returns the number of bytes read ahead from the underlying source but not yet consumed.
+     *
+     * NOTE: The background thread needs to be stopped before calling this function.
+     */
+    std::size_t numPrefetchedBytes() const noexcept {
+      std::size_t numBytes = pending.size();
+      for (const auto &chunk : filledChunks) {
+        numBytes += chunk.size - chunk.offset;
+      }
+      return numBytes;
+    }
+
+  private:
+    struct Chunk {
+      std::vector<std::byte> data;
+      /** The number of valid bytes in the chunk, zero marks the end of the source */
+      std::size_t size;
+      /** The number of bytes already consumed */
+      std::size_t offset;
+    };
+
+    /**
+     * Consumes up to the given number of bytes from the first chunk read ahead and returns the number of bytes
+     * consumed. The bytes are copied to the given output memory, if any.
+     */
+    std::size_t takeBytes(std::byte *outBytes, std::size_t maxNumBytes) {
+      std::unique_lock lock{mutex};
+      if (!worker.joinable()) {
+        stopRequested = false;
+        worker = std::thread{[this]() { runWorker(); }};
+      }
+      condition.wait(lock, [this]() { return !filledChunks.empty(); });
+
+      auto &chunk = filledChunks.front();
+      if (!chunk.size) {
+        // Keep the end marker for any following access
+        if (readError) {
+          std::rethrow_exception(readError);
+        }
+        return 0;
+      }
+
+      std::size_t numBytes = std::min(maxNumBytes, chunk.size - chunk.offset);
+      if (outBytes == buffer.data() && !chunk.offset && numBytes == chunk.size && chunk.data.size() == buffer.size()) {
+        // Hand over the whole chunk as the new read-ahead buffer
+        std::swap(buffer, chunk.data);
+      } else if (outBytes) {
+        std::copy_n(chunk.data.begin() + static_cast<std::ptrdiff_t>(chunk.offset), numBytes, outBytes);
+      }
+      chunk.offset += numBytes;
+      if (chunk.offset == chunk.size) {
+        freeChunks.push_back(std::move(chunk.data));
+        filledChunks.pop_front();
+        condition.notify_all();
+      }
+      return numBytes;
+    }
+
+    void runWorker() {
+      std::unique_lock lock{mutex};
+      while (true) {
+        condition.wait(lock, [this]() { return stopRequested || !freeChunks.empty(); });
+        if (stopRequested) {
+          return;
+        }
+        auto data = std::move(freeChunks.back());
+        freeChunks.pop_back();
+        lock.unlock();
+
+        std::size_t numBytes = 0;
+        std::exception_ptr error{};
+        try {
+          numBytes = generateChunk(data);
+        } catch (...) {
+          error = std::current_exception();
+        }
+
+        lock.lock();
+        filledChunks.push_back(Chunk{std::move(data), numBytes, 0});
+        readError = error;
+        condition.notify_all();
+        if (!numBytes) {
+          // End of the source or error, the marker chunk is kept
+          return;
+        }
+      }
+    }
+
+  private:
+    BitReader::ChunkGenerator generateChunk;
+    std::mutex mutex;
+    std::condition_variable condition;
+    /** The chunks read ahead in the order of the source data */
+    std::deque<Chunk> filledChunks;
+    std::vector<std::vector<std::byte>> freeChunks;
+    std::exception_ptr readError;
+    bool stopRequested = false;
+    std::thread worker;
+  };
+
+  struct PrefetchingChunkGeneratorImpl final : PrefetchingReaderImpl {
+    using PrefetchingReaderImpl::PrefetchingReaderImpl;
+  };
+
+  struct PrefetchingInputStreamImpl final : PrefetchingReaderImpl {
+    PrefetchingInputStreamImpl(std::istream &is, ByteCount readAheadSize, std::size_t numChunks)
+        : PrefetchingInputStreamImpl(is, readAheadSize, numChunks, std::make_shared<std::mutex>()) {}
+
+    ~PrefetchingInputStreamImpl() noexcept override {
+      stopPrefetching();
+      auto numBytes = numPrefetchedBytes() + numCachedBytes();
+      if (!numBytes) {
+        return;
+      }
+      // Return the read ahead but not yet consumed bytes to the stream, see BufferedInputStreamImpl
+      try {
+        auto state = input.rdstate();
+        input.clear(state & ~std::ios::eofbit & ~std::ios::failbit);
+        if (!input.seekg(-static_cast<std::streamoff>(numBytes), std::ios::cur)) {
+          input.clear(state);
+        }
+      } catch (...) {
+        // Not seekable, nothing we can do
+      }
+    }
+
+    bool isSeekable() const noexcept override { return start != std::istream::pos_type(-1); }
+
+    bool seekSource(ByteCount position) override {
+      stopPrefetching();
+      dropPrefetchedChunks();
+      pending = {};
+      return seekStream(input, start, position);
+    }
+
+    std::unique_ptr<ReaderImpl> createSubSource(bml::ByteRange range) const override {
+      // The sub-stream shares the stream mutex, since the background thread might read the stream at the same time
+      return isSeekable() ? createSubStream(input, start, range, ByteCount{buffer.size()}, streamMutex) : nullptr;
+    }
+
     std::istream &input;
+    /** The initial stream position, the invalid position -1 for non-seekable streams */
+    std::istream::pos_type start;
+    /** The mutex guarding the stream accesses of the background thread and any sub-stream */
+    std::shared_ptr<std::mutex> streamMutex;
+
+  private:
+    PrefetchingInputStreamImpl(std::istream &is, ByteCount readAheadSize, std::size_t numChunks,
+                               std::shared_ptr<std::mutex> mutex)
+        : PrefetchingReaderImpl(
+              [&is, mutex](std::span<std::byte> outBytes) -> std::size_t {
+                std::scoped_lock lock{*mutex};
+                if (is.eof()) {
+                  return 0;
+                }
+                is.read(reinterpret_cast<char *>(outBytes.data()), static_cast<std::streamsize>(outBytes.size()));
+                return static_cast<std::size_t>(is.gcount());
+              },
+              readAheadSize, numChunks),
+          input(is), start(is.tellg()), streamMutex(std::move(mutex)) {
+      input.exceptions(std::ios::badbit);
+    }
   };
 
   BitReader::BitReader() noexcept = default;
   BitReader::BitReader(ByteGenerator &&generator) : impl(std::make_unique<ByteGeneratorImpl>(std::move(generator))) {}
   BitReader::BitReader(ByteRange range) : impl(std::make_unique<ByteReadRangeImpl>(range)) {}
   BitReader::BitReader(std::istream &is) : impl(std::make_unique<ByteInputStreamImpl>(is)) {}
+  BitReader::BitReader(ChunkGenerator &&generator, ByteCount readAheadSize)
+      : impl(std::make_unique<ChunkGeneratorImpl>(std::move(generator), readAheadSize)) {}
+  BitReader::BitReader(std::istream &is, ByteCount readAheadSize)
+      : impl(std::make_unique<BufferedInputStreamImpl>(is, readAheadSize)) {}
+  BitReader::BitReader(ChunkGenerator &&generator, ByteCount readAheadSize, std::size_t numPrefetchedChunks)
+      : impl(numPrefetchedChunks ? std::unique_ptr<ReaderImpl>{std::make_unique<PrefetchingChunkGeneratorImpl>(
+                                       std::move(generator), readAheadSize, numPrefetchedChunks)}
+                                 : std::make_unique<ChunkGeneratorImpl>(std::move(generator), readAheadSize)) {}
+  BitReader::BitReader(std::istream &is, ByteCount readAheadSize, std::size_t numPrefetchedChunks)
+      : impl(numPrefetchedChunks ? std::unique_ptr<ReaderImpl>{std::make_unique<PrefetchingInputStreamImpl>(
+                                       is, readAheadSize, numPrefetchedChunks)}
+                                 : std::make_unique<BufferedInputStreamImpl>(is, readAheadSize)) {}
+  BitReader::BitReader(std::unique_ptr<ReaderImpl> &&source) noexcept : impl(std::move(source)) {}
   BitReader::BitReader(BitReader &&other) noexcept : impl(std::move(other.impl)) { other.impl.reset(); }
   BitReader::~BitReader() noexcept = default;
 
@@ -463,6 +1342,32 @@ namespace bml {
     return decodeSignedExpGolomb(read(exponent + 1_bits /* marker 1-bit */));
   }
 
+  void BitReader::readExpGolombInto(std::span<std::uintmax_t> outValues) {
+    auto &reader = assertImpl(impl);
+    while (!outValues.empty()) {
+      auto numValues =
+          reader.readExpGolombsFromCache(outValues, [](std::uintmax_t value) { return decodeExpGolomb(value); });
+      if (!numValues) {
+        // The next value does not fit into the cache (or the end of the input is reached)
+        outValues[numValues++] = readExpGolomb();
+      }
+      outValues = outValues.subspan(numValues);
+    }
+  }
+
+  void BitReader::readSignedExpGolombInto(std::span<std::intmax_t> outValues) {
+    auto &reader = assertImpl(impl);
+    while (!outValues.empty()) {
+      auto numValues = reader.readExpGolombsFromCache(
+          outValues, [](std::uintmax_t value) { return decodeSignedExpGolomb(value); });
+      if (!numValues) {
+        // The next value does not fit into the cache (or the end of the input is reached)
+        outValues[numValues++] = readSignedExpGolomb();
+      }
+      outValues = outValues.subspan(numValues);
+    }
+  }
+
   char32_t BitReader::readUtf8CodePoint() {
     auto b = peek(1_bytes);
     if (b && (*b & 0x80U) == 0x00U) {
@@ -517,6 +1422,55 @@ namespace bml {
     return decodeNegaFibonacci(invertBits(value, numBits));
   }
 
+  void BitReader::readFibonacciInto(std::span<uint32_t> outValues) {
+    auto &reader = assertImpl(impl);
+    while (!outValues.empty()) {
+      auto numValues =
+          reader.readFibonaccisFromCache(outValues, [](std::uintmax_t value) { return decodeFibonacci(value); });
+      if (!numValues) {
+        // The next value does not fit into the cache (or the end of the input is reached)
+        outValues[numValues++] = readFibonacci();
+      }
+      outValues = outValues.subspan(numValues);
+    }
+  }
+
+  void BitReader::readSignedFibonacciInto(std::span<int32_t> outValues) {
+    auto &reader = assertImpl(impl);
+    while (!outValues.empty()) {
+      auto numValues =
+          reader.readFibonaccisFromCache(outValues, [](std::uintmax_t value) { return decodeNegaFibonacci(value); });
+      if (!numValues) {
+        // The next value does not fit into the cache (or the end of the input is reached)
+        outValues[numValues++] = readSignedFibonacci();
+      }
+      outValues = outValues.subspan(numValues);
+    }
+  }
+
+  bool BitReader::isSeekable() const noexcept { return impl && impl->isSeekable(); }
+
+  void BitReader::seek(BitCount position) { assertImpl(impl).seek(position); }
+
+  BitReader BitReader::subReader(bml::ByteRange range) const {
+    if (!impl) [[unlikely]] {
+      throw std::runtime_error{"Cannot read from empty BitReader instance"};
+    }
+    auto source = impl->createSubSource(range);
+    if (!source) [[unlikely]] {
+      throw std::runtime_error("The underlying byte source does not support random access");
+    }
+    return BitReader{std::move(source)};
+  }
+
+  BitReader &BitReader::baseReader() noexcept { return impl && impl->baseReader ? *impl->baseReader : *this; }
+
+  void BitReader::setBaseReader(BitReader &base) { assertImpl(impl).baseReader = &base.baseReader(); }
+
+  ReaderStatistics *BitReader::statistics() const noexcept { return impl ? impl->statistics : nullptr; }
+
+  void BitReader::setStatistics(ReaderStatistics *statistics) { assertImpl(impl).statistics = statistics; }
+
   void BitReader::skip(BitCount numBits) {
     if (!numBits && impl) [[unlikely]] {
       return;
@@ -524,6 +1478,15 @@ namespace bml {
     assertImpl(impl).skip(numBits);
   }
 
+  void BitReader::copyBytesTo(BitWriter &writer, ByteCount numBytes) {
+    if (!numBytes && impl) [[unlikely]] {
+      return;
+    }
+    writer.assertAlignment(BYTE_SIZE);
+    assertAlignment(BYTE_SIZE);
+    assertImpl(impl).copyBytesTo(writer, numBytes);
+  }
+
   ByteCount BitReader::skipBytesUntil(std::span<const std::byte> pattern) {
     assertAlignment(BYTE_SIZE);
     return assertImpl(impl).readBytesUntil(pattern, nullptr);
@@ -6,6 +6,7 @@
 #include "helper.hpp"
 
 #include <algorithm>
+#include <array>
 #include <stdexcept>
 
 namespace bml {
@@ -58,6 +59,18 @@ namespace bml {
     }
 
     void flushFullBytes() {
+      if (auto numBytes = cacheSize / BYTE_SIZE; numBytes > 1) {
+        // Hand all full bytes to the sink at once instead of flushing them one by one
+        std::array<std::byte, sizeof(std::uintmax_t)> bytes{};
+        storeBigEndian(bytes.data(), cache);
+        if (!sinkBytes(std::span{bytes}.first(numBytes))) [[unlikely]] {
+          throw EndOfStreamError("Cannot write more bytes, end of output reached");
+        }
+        sinkBytesWritten += ByteCount{numBytes};
+        cache = numBytes == sizeof(std::uintmax_t) ? 0U : (cache << ByteCount{numBytes});
+        cacheSize -= ByteCount{numBytes};
+        return;
+      }
       Cache tmp{cache, cacheSize};
       sinkBytesWritten += flushFullCacheBytes(
           tmp, [this](std::byte nextByte) { return sinkByte(nextByte); },
@@ -92,7 +105,7 @@ namespace bml {
     bool sinkByte(std::byte byte) override { return consumeByte(byte); }
 
     bool sinkBytes(std::span<const std::byte> bytes) override {
-      return std::all_of(bytes.begin(), bytes.end(), consumeByte);
+      return std::all_of(bytes.begin(), bytes.end(), std::ref(consumeByte));
     }
 
     BitWriter::ByteConsumer consumeByte;
@@ -105,7 +118,7 @@ namespace bml {
       if (bytes.size() > sinkRange.size()) {
         return false;
       }
-      std::copy_n(bytes.begin(), sinkRange.size(), sinkRange.begin());
+      std::copy_n(bytes.begin(), bytes.size(), sinkRange.begin());
       sinkRange = sinkRange.subspan(bytes.size());
       return true;
     }
@@ -134,6 +147,19 @@ namespace bml {
       return static_cast<bool>(output);
     }
 
+    bool sinkCopies(std::byte value, ByteCount numBytes) override {
+      // Write the copies in chunks instead of a single byte at a time
+      std::array<char, 256> chunk{};
+      chunk.fill(static_cast<char>(value));
+      auto numRemaining = numBytes.num;
+      while (numRemaining && output) {
+        auto numChunkBytes = std::min(numRemaining, chunk.size());
+        output.write(chunk.data(), static_cast<std::streamsize>(numChunkBytes));
+        numRemaining -= numChunkBytes;
+      }
+      return static_cast<bool>(output);
+    }
+
     std::ostream &output;
   };
 
@@ -158,12 +184,19 @@ namespace bml {
     std::vector<std::byte> &buffer;
   };
 
+  struct ByteDiscardImpl final : BitWriter::WriterImpl {
+    bool sinkByte(std::byte /* byte */) override { return true; }
+    bool sinkBytes(std::span<const std::byte> /* bytes */) override { return true; }
+    bool sinkCopies(std::byte /* value */, ByteCount /* numBytes */) override { return true; }
+  };
+
   BitWriter::BitWriter() noexcept = default;
   BitWriter::BitWriter(ByteConsumer &&consumer) : impl(std::make_unique<ByteConsumerImpl>(std::move(consumer))) {}
   BitWriter::BitWriter(ByteRange range) : impl(std::make_unique<ByteWriteRangeImpl>(range)) {}
   BitWriter::BitWriter(std::ostream &os) : impl(std::make_unique<ByteOutputStreamImpl>(os)) {}
   BitWriter::BitWriter(BitWriter &&other) noexcept : impl(std::move(other.impl)) { other.impl.reset(); }
   BitWriter::BitWriter(std::vector<std::byte> &buffer, GrowTag) : impl(std::make_unique<ByteWriteBufferImpl>(buffer)) {}
+  BitWriter::BitWriter(DiscardTag) : impl(std::make_unique<ByteDiscardImpl>()) {}
   BitWriter::~BitWriter() noexcept = default;
 
   BitWriter &BitWriter::operator=(BitWriter &&other) noexcept {
@@ -212,6 +245,28 @@ namespace bml {
     assertImpl(impl).fillBytes(value, numBytes);
   }
 
+  /**
+   * Packs as many of the encoded values as fit into a single word before writing them to the given writer.
+   */
+  template <typename T, typename Encoder>
+  static void writeEncodedValues(BitWriter &writer, std::span<const T> values, Encoder &&encode) {
+    std::uintmax_t packedBits = 0;
+    auto numBitsPacked = 0_bits;
+    for (auto value : values) {
+      auto [encodedValue, numBits] = encode(value);
+      if (numBitsPacked + numBits > CACHE_SIZE) {
+        writer.write(packedBits, numBitsPacked);
+        packedBits = 0;
+        numBitsPacked = 0_bits;
+      }
+      packedBits = numBitsPacked ? ((packedBits << numBits) | encodedValue) : encodedValue;
+      numBitsPacked += numBits;
+    }
+    if (numBitsPacked) {
+      writer.write(packedBits, numBitsPacked);
+    }
+  }
+
   void BitWriter::writeExpGolomb(std::uintmax_t value) {
     auto [encodedValue, numBits] = encodeExpGolomb(value);
     write(encodedValue, numBits);
@@ -222,6 +277,14 @@ namespace bml {
     write(encodedValue, numBits);
   }
 
+  void BitWriter::writeExpGolomb(std::span<const std::uintmax_t> values) {
+    writeEncodedValues(*this, values, [](std::uintmax_t value) { return encodeExpGolomb(value); });
+  }
+
+  void BitWriter::writeSignedExpGolomb(std::span<const std::intmax_t> values) {
+    writeEncodedValues(*this, values, [](std::intmax_t value) { return encodeSignedExpGolomb(value); });
+  }
+
   void BitWriter::writeUtf8CodePoint(char32_t codePoint) {
     auto utf8String = toUtf8String(codePoint);
     writeBytes(std::as_bytes(std::span{utf8String}));
@@ -248,6 +311,20 @@ namespace bml {
     write(invertBits(encodedValue, numBits), numBits);
   }
 
+  void BitWriter::writeFibonacci(std::span<const uint32_t> values) {
+    writeEncodedValues(*this, values, [](uint32_t value) {
+      auto [encodedValue, numBits] = encodeFibonacci(value);
+      return EncodedValue<std::uintmax_t>{invertBits(encodedValue, numBits), numBits};
+    });
+  }
+
+  void BitWriter::writeSignedFibonacci(std::span<const int32_t> values) {
+    writeEncodedValues(*this, values, [](int32_t value) {
+      auto [encodedValue, numBits] = encodeNegaFibonacci(value);
+      return EncodedValue<std::uintmax_t>{invertBits(encodedValue, numBits), numBits};
+    });
+  }
+
   void BitWriter::flush() { fillToAligment(1_bytes, false); }
 
 } // namespace bml
@@ -2,7 +2,10 @@
 
 #include "helper.hpp"
 
+#include <array>
+#include <charconv>
 #include <iomanip>
+#include <limits>
 
 namespace bml::detail {
   extern std::ostream &printUtf8String(std::ostream &os, std::u8string_view val, char escape);
@@ -36,6 +39,17 @@ namespace bml::yaml {
     }
   }
 
+  /**
+   * Writes the decimal representation of the given integral value without going through the locale-dependent number
+   * formatting of the output stream.
+   */
+  template <std::integral T>
+  static std::ostream &printInteger(std::ostream &os, T val) {
+    std::array<char, std::numeric_limits<T>::digits10 + 2> buffer{};
+    auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), val);
+    return os.write(buffer.data(), result.ptr - buffer.data());
+  }
+
   std::ostream &print(std::ostream &os, const Options &options, std::monostate) {
     prefixSpace(os, options);
     return os << "null";
@@ -53,12 +67,12 @@ namespace bml::yaml {
 
   std::ostream &print(std::ostream &os, const Options &options, uintmax_t val) {
     prefixSpace(os, options);
-    return os << val;
+    return printInteger(os, val);
   }
 
   std::ostream &print(std::ostream &os, const Options &options, intmax_t val) {
     prefixSpace(os, options);
-    return os << val;
+    return printInteger(os, val);
   }
 
   std::ostream &print(std::ostream &os, const Options &options, float val) {
@@ -1,4 +1,7 @@
 #include "binary_map.hpp"
+#include "bit_view.hpp"
+#include "span_reader.hpp"
+#include "span_writer.hpp"
 
 #include "test_helper.hpp"
 
@@ -29,6 +32,29 @@ static_assert(sizeof(mapExpGolombBits<uint32_t>()) == 1);
 static_assert(sizeof(assertByteAligned()) == 1);
 #endif
 
+struct PackedHeader {
+  uint8_t magic;
+  uint8_t version;
+  bool flag;
+  EnumType type;
+  int16_t offset;
+  uint8_t reserved;
+
+  auto operator<=>(const PackedHeader &other) const noexcept = default;
+
+  BML_DEFINE_PRINT(PackedHeader, magic, version, flag, type, offset, reserved)
+};
+
+struct CodecTable {
+  uint16_t id;
+  std::array<uint8_t, 3> values;
+  int8_t bias;
+
+  auto operator<=>(const CodecTable &other) const noexcept = default;
+
+  BML_DEFINE_PRINT(CodecTable, id, values, bias)
+};
+
 class TestMappers : public Test::Suite {
 public:
   TestMappers() : Test::Suite("Mappers") {
@@ -38,7 +64,10 @@ public:
     TEST_ADD(TestMappers::testUnicode);
     TEST_ADD(TestMappers::testEnum);
     TEST_ADD(TestMappers::testCompound);
+    TEST_ADD(TestMappers::testPackedCompound);
+    TEST_ADD(TestMappers::testBitView);
     TEST_ADD(TestMappers::testMembers);
+    TEST_ADD(TestMappers::testConstantEvaluation);
     TEST_ADD(TestMappers::testErrors);
   }
 
@@ -167,6 +196,71 @@ public:
                                4_bytes + 12_bits);
   }
 
+  void testPackedCompound() {
+    PackedHeader header{0xA, 5, true, EnumType::BAR, 0x123, 0};
+
+    auto mapHeader = mapCompound<PackedHeader>(
+        mapMember(&PackedHeader::magic, mapCheckedFixedBits<uint8_t{0xA}, 4_bits>()),
+        mapMemberBits<3_bits>(&PackedHeader::version), mapMemberBits<1_bits>(&PackedHeader::flag),
+        mapMember(&PackedHeader::type, mapBytes<EnumType>()), mapMemberBits<12_bits>(&PackedHeader::offset),
+        mapMember(&PackedHeader::reserved, mapUncheckedFixedBits<uint8_t{0}, 4_bits>()));
+
+    checkFixedSizeDirectMapper(header, mapHeader, toBytes({0xAB, 0x11, 0x12, 0x30}), 4_bytes);
+
+    // Invalid fixed value error
+    {
+      auto data = toBytes({0x1B, 0x11, 0x12, 0x30});
+      BitReader reader{data};
+      TEST_THROWS(mapHeader(reader), std::invalid_argument);
+    }
+
+    // Invalid alignment error
+    {
+      auto data = toBytes({0xAB, 0x11, 0x12, 0x30, 0x00});
+      BitReader reader{data};
+      std::ignore = reader.read();
+      TEST_THROWS(mapHeader(reader), std::invalid_argument);
+
+      std::vector<std::byte> outData(data.size());
+      BitWriter writer{std::span{outData}};
+      writer.write(true);
+      TEST_THROWS(mapHeader(writer, header), std::invalid_argument);
+    }
+  }
+
+  void testBitView() {
+    using HeaderView = BitView<mapCheckedFixedBits<uint8_t{0xA}, 4_bits>(), mapBits<uint8_t, 3_bits>(),
+                               mapBits<bool, 1_bits>(), mapBytes<EnumType>(), mapBits<int16_t, 12_bits>(),
+                               mapUncheckedFixedBits<uint8_t{0}, 4_bits>(), mapBits<bool>(), mapBits<uint64_t>()>;
+    static_assert(HeaderView::NUM_FIELDS == 8);
+    static_assert(HeaderView::fixedSize() == 97_bits);
+    static_assert(HeaderView::numBytes() == 13_bytes);
+    static_assert(HeaderView::offset<4>() == 16_bits);
+    static_assert(HeaderView::fieldSize<4>() == 12_bits);
+    static_assert(std::is_same_v<HeaderView::field_type<3>, EnumType>);
+
+    auto data = toBytes({0xAB, 0x11, 0x12, 0x30, 0x80, 0x81, 0x01, 0x82, 0x02, 0x83, 0x03, 0x84, 0x7F, 0xFF});
+    HeaderView view{data};
+    TEST_ASSERT_EQUALS(13U, view.data().size());
+    TEST_ASSERT_EQUALS(0xAU, view.get<0>());
+    TEST_ASSERT_EQUALS(5U, view.get<1>());
+    TEST_ASSERT(view.get<2>());
+    TEST_ASSERT_EQUALS(EnumType::BAR, view.get<3>());
+    TEST_ASSERT_EQUALS(0x123, view.get<4>());
+    TEST_ASSERT_EQUALS(0U, view.get<5>());
+    TEST_ASSERT(view.get<6>());
+    // spans 9 bytes
+    TEST_ASSERT_EQUALS(0x0102030405060708U, view.get<7>());
+    TEST_THROWS_NOTHING(view.check());
+
+    // Fixed values are only checked explicitly
+    data[0] = std::byte{0x1B};
+    TEST_ASSERT_EQUALS(0xAU, view.get<0>());
+    TEST_THROWS(view.check(), std::invalid_argument);
+
+    TEST_THROWS(HeaderView{std::span{data}.first(12)}, EndOfStreamError);
+  }
+
   void testMembers() {
     POD2 pod{};
     pod.a = -107;
@@ -207,6 +301,53 @@ public:
                                toBytes({0b01'10'11'00}), 6_bits);
   }
 
+  void testConstantEvaluation() {
+    static constexpr std::array<std::byte, 4> HEADER_DATA{std::byte{0xAB}, std::byte{0x11}, std::byte{0x12},
+                                                          std::byte{0x30}};
+    static constexpr auto MAP_HEADER = mapCompound<PackedHeader>(
+        mapMember(&PackedHeader::magic, mapCheckedFixedBits<uint8_t{0xA}, 4_bits>()),
+        mapMemberBits<3_bits>(&PackedHeader::version), mapMemberBits<1_bits>(&PackedHeader::flag),
+        mapMember(&PackedHeader::type, mapBytes<EnumType>()), mapMemberBits<12_bits>(&PackedHeader::offset),
+        mapMember(&PackedHeader::reserved, mapUncheckedFixedBits<uint8_t{0}, 4_bits>()));
+    static constexpr auto HEADER = [] {
+      SpanReader reader{HEADER_DATA};
+      return MAP_HEADER(reader);
+    }();
+    static_assert(HEADER == PackedHeader{0xA, 5, true, EnumType::BAR, 0x123, 0});
+    static_assert(
+        [] {
+          std::array<std::byte, HEADER_DATA.size()> data{};
+          SpanWriter writer{data};
+          MAP_HEADER(writer, HEADER);
+          return data;
+        }() == HEADER_DATA);
+
+    // Not packed, since the array member is not packable
+    static constexpr std::array<std::byte, 6> TABLE_DATA{std::byte{0x12}, std::byte{0x34}, std::byte{0x01},
+                                                         std::byte{0x02}, std::byte{0x03}, std::byte{0xFE}};
+    static constexpr auto MAP_TABLE = mapCompound<CodecTable>(
+        mapMemberBits(&CodecTable::id), mapMemberArray<&CodecTable::values, mapBytes<uint8_t>()>(),
+        mapMember(&CodecTable::bias, mapBits<int8_t>()));
+    static constexpr auto TABLE = [] {
+      SpanReader reader{TABLE_DATA};
+      return MAP_TABLE(reader);
+    }();
+    static_assert(TABLE == CodecTable{0x1234, {0x01, 0x02, 0x03}, -2});
+    static_assert(
+        [] {
+          std::array<std::byte, TABLE_DATA.size()> data{};
+          SpanWriter writer{data};
+          MAP_TABLE(writer, TABLE);
+          return data;
+        }() == TABLE_DATA);
+
+    // Same results at run-time and via the BitReader
+    SpanReader spanReader{TABLE_DATA};
+    TEST_ASSERT_EQUALS(TABLE, MAP_TABLE(spanReader));
+    BitReader reader{std::span{TABLE_DATA}};
+    TEST_ASSERT_EQUALS(TABLE, MAP_TABLE(reader));
+  }
+
   void testErrors() {
 
     // Invalid fixed value error
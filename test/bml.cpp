@@ -7,7 +7,10 @@
 #include <array>
 #include <iomanip>
 #include <iterator>
+#include <memory>
 #include <sstream>
+#include <string_view>
+#include <vector>
 
 using namespace bml;
 
@@ -28,6 +31,8 @@ public:
     TEST_ADD(TestHelper::testDecodeSignedFibonacci);
     TEST_ADD(TestHelper::testHexString);
     TEST_ADD(TestHelper::testWriteBits);
+    TEST_ADD(TestHelper::testByteSwap);
+    TEST_ADD(TestHelper::testValidUtf8);
   }
 
   void testBits() {
@@ -192,6 +197,47 @@ public:
     TEST_ASSERT_EQUALS("0x55", writeBits(0x55, 8_bits));
     TEST_ASSERT_EQUALS("0xab", writeBits(int8_t{-0x55}, 8_bits));
   }
+  void testByteSwap() {
+    static_assert(byteSwap(uint8_t{0x12}) == 0x12);
+    static_assert(byteSwap(uint16_t{0x1234}) == 0x3412);
+    static_assert(byteSwap(uint32_t{0x12345678}) == 0x78563412);
+    static_assert(byteSwap(uint64_t{0x0123456789ABCDEF}) == 0xEFCDAB8967452301);
+
+    const std::array<std::byte, 9> bytes{std::byte{0x01}, std::byte{0x23}, std::byte{0x45}, std::byte{0x67},
+                                         std::byte{0x89}, std::byte{0xAB}, std::byte{0xCD}, std::byte{0xEF},
+                                         std::byte{0x11}};
+    TEST_ASSERT_EQUALS(0x01U, loadBigEndian<uint8_t>(bytes.data()));
+    TEST_ASSERT_EQUALS(0x2345U, loadBigEndian<uint16_t>(bytes.data() + 1));
+    TEST_ASSERT_EQUALS(0x6789ABCDU, loadBigEndian<uint32_t>(bytes.data() + 3));
+    TEST_ASSERT_EQUALS(0x23456789ABCDEF11U, loadBigEndian<uint64_t>(bytes.data() + 1));
+  }
+
+  void testValidUtf8() {
+    const std::u8string_view text = u8"Some ASCII text with ⠁⠂⠃ and 🂡🂢🂣 in between and at the end: 🃞";
+    TEST_ASSERT(isValidUtf8(std::as_bytes(std::span{text})));
+    TEST_ASSERT(isValidUtf8({}));
+
+    // Truncated sequence, also within the last 8 bytes
+    TEST_ASSERT_FALSE(isValidUtf8(std::as_bytes(std::span{text}.first(text.size() - 1))));
+    TEST_ASSERT_FALSE(isValidUtf8(toBytes({'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 0xE2, 0xA0})));
+
+    const std::vector<std::vector<std::byte>> invalid{
+        toBytes({0x80}),                   // continuation byte without lead byte
+        toBytes({0xC0, 0x80}),             // overlong encoding of U+0000
+        toBytes({0xE0, 0x80, 0xAF}),       // overlong encoding of '/'
+        toBytes({0xED, 0xA0, 0x80}),       // UTF-16 surrogate U+D800
+        toBytes({0xF4, 0x90, 0x80, 0x80}), // beyond U+10FFFF
+        toBytes({0xF8, 0x88, 0x80, 0x80}), // invalid lead byte
+        toBytes({0xC3, 0x28}),             // invalid continuation byte
+    };
+    for (const auto &data : invalid) {
+      TEST_ASSERT_FALSE(isValidUtf8(data));
+      // Also behind a block of ASCII characters checked at once
+      auto tmp = toBytes({'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H'});
+      tmp.insert(tmp.end(), data.begin(), data.end());
+      TEST_ASSERT_FALSE(isValidUtf8(tmp));
+    }
+  }
 };
 
 namespace bml {
@@ -207,6 +253,7 @@ public:
     TEST_ADD(TestCache::testFillCache);
     TEST_ADD(TestCache::testReadCache);
     TEST_ADD(TestCache::testFlushCache);
+    TEST_ADD(TestCache::testFillCacheFromRange);
   }
 
   void testFillCache() {
@@ -249,7 +296,27 @@ public:
                        flushFullCacheBytesHelper(Cache{0x1234000000000000, 15_bits}).second);
   }
 
+  void testFillCacheFromRange() {
+    const auto bytes = std::as_bytes(std::span{"\x12\x34\x56\x78\x9A\xBC\xDE\xF0\x11"}).first<9>();
+    TEST_ASSERT_EQUALS((Cache{0x123456789ABCDEF0, 8_bytes}), fillCacheFromRangeHelper(Cache{}, bytes, 8U));
+    TEST_ASSERT_EQUALS((Cache{0xE2468ACF13579BC0, 59_bits}),
+                       fillCacheFromRangeHelper(Cache{0xE000000000000000, 3_bits}, bytes, 7U));
+    TEST_ASSERT_EQUALS((Cache{0xFF12345600000000, 32_bits}),
+                       fillCacheFromRangeHelper(Cache{0xFF00000000000000, 8_bits}, bytes.first<3>(), 3U));
+    TEST_ASSERT_EQUALS((Cache{0xFFFFFFFFFFFFFFF0, 60_bits}),
+                       fillCacheFromRangeHelper(Cache{0xFFFFFFFFFFFFFFF0, 60_bits}, bytes, 0U));
+    TEST_ASSERT_EQUALS((Cache{0xE000000000000000, 3_bits}),
+                       fillCacheFromRangeHelper(Cache{0xE000000000000000, 3_bits}, {}, 0U));
+  }
+
 private:
+  static Cache fillCacheFromRangeHelper(Cache cache, std::span<const std::byte> input, std::size_t expectedNumBytes) {
+    if (bml::detail::fillCacheFromRange(cache.value, cache.size, input) != expectedNumBytes) {
+      throw;
+    }
+    return cache;
+  }
+
   static Cache fillCacheHelper(Cache cache, BitCount numBits, std::initializer_list<const uint8_t> input) {
     fillCache(
         cache, numBits,
@@ -508,6 +575,25 @@ additional:
     range = std::span{DATA};
     TEST_ASSERT_EQUALS(DataRange::Mode::BORROWED, range.mode());
     checkPrint(range, "(19 entries)");
+
+    std::shared_ptr<std::byte[]> chunk{new std::byte[DATA.size()]};
+    std::copy(DATA.begin(), DATA.end(), chunk.get());
+    range = DataRange{std::shared_ptr<const std::byte>{chunk, chunk.get() + 4}, 3};
+    TEST_ASSERT_EQUALS(DataRange::Mode::SHARED, range.mode());
+    TEST_ASSERT_EQUALS(3U, range.size());
+    TEST_ASSERT_EQUALS(chunk.get() + 4, range.data().data());
+    TEST_ASSERT_EQUALS(2, chunk.use_count());
+    checkPrint(range, "[0xc0, 0xff, 0xee, ]");
+    TEST_ASSERT(range.borrow().mode() == DataRange::Mode::BORROWED);
+    TEST_ASSERT_EQUALS(range.data().data(), range.borrow().data().data());
+    chunk.reset();
+    TEST_ASSERT_EQUALS(0xEE, static_cast<uint8_t>(range.data()[2]));
+
+    range = ByteRange{4_bytes, 3_bytes};
+    fillDataRange(range, DATA, DataRange::Mode::SHARED);
+    TEST_ASSERT_EQUALS(DataRange::Mode::SHARED, range.mode());
+    TEST_ASSERT_NOT_EQUALS(DATA.data() + 4, range.data().data());
+    checkPrint(range, "[0xc0, 0xff, 0xee, ]");
   }
 
 private:
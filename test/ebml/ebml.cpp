@@ -55,9 +55,14 @@ public:
     TEST_ADD(TestBaseElements::testDateElement);
     TEST_ADD(TestBaseElements::testAsciiStringElement);
     TEST_ADD(TestBaseElements::testUtf8StringElement);
+    TEST_ADD(TestBaseElements::testBorrowedStringElements);
+    TEST_ADD(TestBaseElements::testValidateUtf8StringElement);
     TEST_ADD(TestBaseElements::testBinaryElement);
+    TEST_ADD(TestBaseElements::testBinaryDataElement);
+    TEST_ADD(TestBaseElements::testElementHeader);
     TEST_ADD(TestBaseElements::testIDMismatch);
     TEST_ADD(TestBaseElements::testCRC32Mismatch);
+    TEST_ADD(TestBaseElements::testWriteCRC32);
     TEST_ADD(TestBaseElements::testUnknownElement);
     TEST_ADD(TestBaseElements::testUnknownDataSize);
     TEST_ADD(TestBaseElements::testChunkedReadEmpty);
@@ -291,6 +296,99 @@ public:
                      3_bytes + 2_bytes + 257_bytes);
   }
 
+  void testBorrowedStringElements() {
+    const auto data = toBytes({0x00, 0x42, 0x82, 0x83, 'F', 'o', 'o', 0x3E, 0xB9, 0x23, 0x83, 0xe2, 0xa0, 0x81});
+
+    StringElement<0x4282_id, "Bar", std::string_view> ascii{};
+    TEST_ASSERT_EQUALS("Bar", ascii.get());
+    Utf8StringElement<0x3EB923_id, std::u8string_view> utf8{};
+    TEST_ASSERT(utf8.get().empty());
+
+    {
+      BitReader reader{std::span{data}};
+      reader.skip(1_bytes);
+      TEST_THROWS(ascii.read(reader), NoReferencedDataError);
+    }
+
+    BitReader reader{std::span{data}};
+    reader.skip(1_bytes);
+    const ReadOptions options{.mediaDataSource = std::span{data}};
+    ascii.read(reader, options);
+    utf8.read(reader, options);
+    TEST_ASSERT_FALSE(reader.hasMoreBytes());
+    TEST_ASSERT_EQUALS("Foo", ascii.get());
+    TEST_ASSERT_EQUALS(reinterpret_cast<const char *>(data.data() + 4), ascii.get().data());
+    TEST_ASSERT(utf8.get() == u8"⠁");
+    TEST_ASSERT_EQUALS(reinterpret_cast<const char8_t *>(data.data() + 11), utf8.get().data());
+    checkPrintElement(utf8, "'⠁'");
+
+    checkWriteElement(std::span{data}.subspan(1, 6), ascii);
+    checkWriteElement(std::span{data}.subspan(7), utf8);
+    TEST_ASSERT_EQUALS(6_bytes, ascii.numBits());
+    TEST_ASSERT_EQUALS(7_bytes, utf8.numBits());
+
+    // Borrowable values borrow from the media data source if set and copy the value otherwise
+    StringElement<0x4282_id, "Bar", BorrowableString<char>> borrowableAscii{};
+    TEST_ASSERT(borrowableAscii.get() == "Bar");
+    TEST_ASSERT(borrowableAscii.get().isBorrowed());
+    Utf8StringElement<0x3EB923_id, BorrowableString<char8_t>> borrowableUtf8{};
+    TEST_ASSERT(borrowableUtf8.get().empty());
+    {
+      BitReader copyingReader{std::span{data}};
+      copyingReader.skip(1_bytes);
+      borrowableAscii.read(copyingReader);
+      borrowableUtf8.read(copyingReader);
+      TEST_ASSERT(borrowableAscii.get() == "Foo");
+      TEST_ASSERT_FALSE(borrowableAscii.get().isBorrowed());
+      TEST_ASSERT(borrowableUtf8.get() == u8"⠁");
+      TEST_ASSERT_FALSE(borrowableUtf8.get().isBorrowed());
+      checkPrintElement(borrowableAscii, "Foo");
+      checkPrintElement(borrowableUtf8, "'⠁'");
+      checkWriteElement(std::span{data}.subspan(1, 6), borrowableAscii);
+      checkWriteElement(std::span{data}.subspan(7), borrowableUtf8);
+    }
+    {
+      BitReader borrowingReader{std::span{data}};
+      borrowingReader.skip(1_bytes);
+      borrowableAscii.read(borrowingReader, options);
+      borrowableUtf8.read(borrowingReader, options);
+      TEST_ASSERT(borrowableAscii.get() == "Foo");
+      TEST_ASSERT(borrowableAscii.get().isBorrowed());
+      TEST_ASSERT_EQUALS(reinterpret_cast<const char *>(data.data() + 4), borrowableAscii.get().view().data());
+      TEST_ASSERT(borrowableUtf8.get() == u8"⠁");
+      TEST_ASSERT(borrowableUtf8.get().isBorrowed());
+      TEST_ASSERT_EQUALS(reinterpret_cast<const char8_t *>(data.data() + 11), borrowableUtf8.get().view().data());
+      checkWriteElement(std::span{data}.subspan(1, 6), borrowableAscii);
+      checkWriteElement(std::span{data}.subspan(7), borrowableUtf8);
+    }
+  }
+
+  void testValidateUtf8StringElement() {
+    const auto valid = toBytes({0x3E, 0xB9, 0x23, 0x83, 0xe2, 0xa0, 0x81});
+    const auto invalid = toBytes({0x3E, 0xB9, 0x23, 0x83, 0xe2, 0x28, 0x81});
+    const ReadOptions options{.validateUtf8 = true};
+
+    Utf8StringElement<0x3EB923_id> element{};
+    {
+      BitReader reader{std::span{invalid}};
+      TEST_THROWS_NOTHING(element.read(reader));
+    }
+    {
+      BitReader reader{std::span{valid}};
+      TEST_THROWS_NOTHING(element.read(reader, options));
+      TEST_ASSERT(element.get() == u8"⠁");
+    }
+    {
+      BitReader reader{std::span{invalid}};
+      TEST_THROWS(element.read(reader, options), InvalidEncodingError);
+    }
+
+    Utf8StringElement<0x3EB923_id, BorrowableString<char8_t>> borrowable{};
+    const ReadOptions borrowingOptions{.mediaDataSource = std::span{invalid}, .validateUtf8 = true};
+    BitReader reader{std::span{invalid}};
+    TEST_THROWS(borrowable.read(reader, borrowingOptions), InvalidEncodingError);
+  }
+
   void testBinaryElement() {
     BinaryElement<0x7373_id> elem{};
     static_assert(BinaryElement<0x7373_id>::maxNumBits() >= bml::ebml::detail::VINTMAX);
@@ -301,6 +399,104 @@ public:
     testValueElement(elem, elem.get(), {0x73, 0x73, 0x83, 0x01, 0x11, 0xFF}, "3 [0x01, 0x11, 0xff, ]", 6_bytes);
   }
 
+  void testBinaryDataElement() {
+    static_assert(BinaryDataElement<0x7373_id>::maxNumBits() >= bml::ebml::detail::VINTMAX);
+    const auto data = toBytes({0x00, 0x73, 0x73, 0x83, 0x01, 0x11, 0xFF});
+    const auto content = std::span{data}.subspan(4);
+
+    {
+      // Only the position of the content is stored
+      BinaryDataElement<0x7373_id> elem{};
+      BitReader reader{std::span{data}};
+      reader.skip(1_bytes);
+      elem.read(reader);
+      TEST_ASSERT_EQUALS(7_bytes, reader.position());
+      TEST_ASSERT_EQUALS((ByteRange{4_bytes, 3_bytes}), elem.data().byteRange());
+      TEST_ASSERT_FALSE(elem.data().hasData());
+      TEST_ASSERT_EQUALS(6_bytes, elem.numBits());
+      std::vector<std::byte> output{};
+      BitWriter writer{output, BitWriter::GROW};
+      TEST_THROWS(elem.write(writer), NoReferencedDataError);
+
+      fillDataRange(elem.data(), std::span{data}, DataRange::Mode::BORROWED);
+      TEST_ASSERT(elem.data().hasData());
+      TEST_ASSERT(std::ranges::equal(content, elem.data().data()));
+      checkWriteElement(std::span{data}.subspan(1), elem);
+    }
+
+    {
+      // The content is borrowed from the media data source
+      BinaryDataElement<0x7373_id> elem{};
+      BitReader reader{std::span{data}};
+      reader.skip(1_bytes);
+      elem.read(reader, ReadOptions{.mediaDataSource = std::span{data}});
+      TEST_ASSERT(elem.data().hasData());
+      TEST_ASSERT_EQUALS(content.data(), elem.data().data().data());
+    }
+
+    {
+      // The content is copied into memory
+      BinaryDataElement<0x7373_id> elem{};
+      BitReader reader{std::span{data}};
+      reader.skip(1_bytes);
+      elem.read(reader, ReadOptions{.readMediaData = true});
+      TEST_ASSERT(elem.data().hasData());
+      TEST_ASSERT(content.data() != elem.data().data().data());
+      TEST_ASSERT(std::ranges::equal(content, elem.data().data()));
+    }
+
+    {
+      // Empty content can always be written
+      BinaryDataElement<0x7373_id> elem{};
+      TEST_ASSERT(elem.data().empty());
+      TEST_ASSERT_EQUALS(3_bytes, elem.numBits());
+      checkWriteElement(toBytes({0x73, 0x73, 0x80}), elem);
+    }
+  }
+
+  void testElementHeader() {
+    struct Header {
+      std::vector<std::byte> data;
+      ElementId id;
+      ByteCount size;
+    };
+    const std::vector<Header> headers{
+        {toBytes({0xEC, 0x80}), ElementId{0xEC}, 0_bytes},
+        {toBytes({0x42, 0x86, 0x81}), ElementId{0x4286}, 1_bytes},
+        {toBytes({0x2A, 0xD7, 0xB1, 0x40, 0x02}), ElementId{0x2AD7B1}, 2_bytes},
+        {toBytes({0x18, 0x53, 0x80, 0x67, 0x20, 0x00, 0x03}), ElementId{0x18538067}, 3_bytes},
+        {toBytes({0x18, 0x53, 0x80, 0x67, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04}), ElementId{0x18538067},
+         4_bytes},
+        {toBytes({0x1F, 0x43, 0xB6, 0x75, 0xFF}), ElementId{0x1F43B675}, bml::ebml::detail::UNKNOWN_SIZE},
+        {toBytes({0x1F, 0x43, 0xB6, 0x75, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}), ElementId{0x1F43B675},
+         bml::ebml::detail::UNKNOWN_SIZE},
+    };
+
+    for (const auto &header : headers) {
+      // Without any trailing data (i.e. less than a full word available for peeking) and with enough content
+      for (std::size_t numTrailing : {0U, 16U}) {
+        auto data = header.data;
+        data.resize(data.size() + numTrailing);
+        BitReader reader{std::span{data}};
+        TEST_ASSERT_EQUALS(header.id, bml::ebml::detail::peekElementId(reader));
+        TEST_ASSERT_EQUALS(0_bits, reader.position());
+        TEST_ASSERT_EQUALS(header.size, bml::ebml::detail::readElementHeader(reader, header.id));
+        const auto headerSize = ByteCount{header.data.size()};
+        TEST_ASSERT_EQUALS(BitCount{headerSize}, reader.position());
+
+        reader.seek(0_bits);
+        TEST_THROWS(bml::ebml::detail::readElementHeader(reader, ElementId{0xBF}), std::invalid_argument);
+      }
+    }
+
+    {
+      // Truncated header
+      auto data = toBytes({0x18, 0x53, 0x80, 0x67, 0x01, 0x00, 0x00});
+      BitReader reader{std::span{data}};
+      TEST_THROWS(bml::ebml::detail::readElementHeader(reader, ElementId{0x18538067}), EndOfStreamError);
+    }
+  }
+
   void testIDMismatch() {
     CRC32 elem{};
     elem = 0xD1F5C58A;
@@ -323,6 +519,39 @@ public:
     TEST_THROWS(ext.read(reader, options), ChecksumMismatchError);
   }
 
+  void testWriteCRC32() {
+    // The CRC-32 values are calculated over the written members instead of writing the stored values
+    EBMLHeader header{};
+    header.crc32 = CRC32{0x12345678};
+    header.docType = "matroska";
+    auto &ext = header.docTypeExtensions.emplace_back();
+    ext.crc32 = CRC32{0xDEADBEEF};
+    ext.docTypeExtensionName = "FOO";
+    ext.docTypeExtensionVersion = 17U;
+
+    std::vector<std::byte> data{};
+    {
+      bml::BitWriter writer{data, bml::BitWriter::GROW};
+      header.write(writer);
+      writer.flush();
+    }
+
+    // The CRC-32 of the DocTypeExtension, see testCRC32Mismatch for the encoded members
+    const auto extBytes = toBytes({0x42, 0x83, 0x83, 0x46, 0x4F, 0x4F, 0x42, 0x84, 0x81, 0x11});
+    const auto extCRC = CRC32::calculate(extBytes);
+    TEST_ASSERT(std::search(data.begin(), data.end(), extBytes.begin(), extBytes.end()) != data.end());
+
+    ReadOptions options{};
+    options.validateCRC32 = true;
+    bml::BitReader reader{std::span{data}};
+    EBMLHeader result{};
+    TEST_THROWS_NOTHING(result.read(reader, options));
+    TEST_ASSERT(result.crc32);
+    TEST_ASSERT_NOT_EQUALS(0x12345678U, result.crc32->get());
+    TEST_ASSERT_EQUALS(1U, result.docTypeExtensions.size());
+    TEST_ASSERT_EQUALS(extCRC, result.docTypeExtensions[0].crc32);
+  }
+
   void testUnknownElement() {
     DocTypeExtension ext{};
 
@@ -706,6 +935,13 @@ public:
     elem = 0x8AC5F5D1;
 
     testElement(elem, {0xBF, 0x84, 0xD1, 0xF5, 0xC5, 0x8A}, "0x8ac5f5d1");
+
+    // Check value for the CRC-32 (IEEE) algorithm
+    const std::string_view DATA{"123456789"};
+    const auto bytes = std::as_bytes(std::span{DATA});
+    TEST_ASSERT_EQUALS(0xCBF43926U, CRC32::calculate(bytes).get());
+    TEST_ASSERT_EQUALS(0xCBF43926U, CRC32::calculate(bytes.subspan(5), CRC32::calculate(bytes.first(5))).get());
+    TEST_ASSERT_EQUALS(0U, CRC32::calculate({}).get());
   }
 
   void testVoid() {
@@ -1,5 +1,6 @@
 #include "mkv.hpp"
 #include "mkv_frames.hpp"
+#include "mkv_muxer.hpp"
 
 #include "ebml_common.hpp"
 #include "errors.hpp"
@@ -7,8 +8,11 @@
 #include "cpptest-main.h"
 
 #include <algorithm>
+#include <array>
 #include <deque>
+#include <memory_resource>
 #include <ranges>
+#include <sstream>
 
 using namespace bml;
 using namespace bml::ebml;
@@ -31,6 +35,7 @@ public:
     TEST_ADD(TestMkvElements::testTrackEntry);
     TEST_ADD(TestMkvElements::testTracks);
     TEST_ADD(TestMkvElements::testSimpleTag);
+    TEST_ADD(TestMkvElements::testSimpleTagBorrowedStrings);
     TEST_ADD(TestMkvElements::testTag);
     TEST_ADD(TestMkvElements::testTags);
     TEST_ADD(TestMkvElements::testCueTrackPositions);
@@ -38,9 +43,22 @@ public:
     TEST_ADD(TestMkvElements::testCues);
     TEST_ADD(TestMkvElements::testBlockGroup);
     TEST_ADD(TestMkvElements::testCluster);
+    TEST_ADD(TestMkvElements::testClusterBorrowedMediaData);
+    TEST_ADD(TestMkvElements::testClusterMediaDataResource);
     TEST_ADD(TestMkvElements::testSegment);
     TEST_ADD(TestMkvElements::testUnknownSizeSegmentWithCluster);
     TEST_ADD(TestMkvElements::testMatroskaChunked);
+    TEST_ADD(TestMkvElements::testMatroskaResumable);
+    TEST_ADD(TestMkvElements::testSegmentIndexed);
+    TEST_ADD(TestMkvElements::testProbe);
+    TEST_ADD(TestMkvElements::testReadParallel);
+    TEST_ADD(TestMkvElements::testReadParallelMediaDataResource);
+    TEST_ADD(TestMkvElements::testSkipElements);
+    TEST_ADD(TestMkvElements::testMuxerLive);
+    TEST_ADD(TestMkvElements::testMuxerSeekable);
+    TEST_ADD(TestMkvElements::testWriteGeneratedIndex);
+    TEST_ADD(TestMkvElements::testExtract);
+    TEST_ADD(TestMkvElements::testPrintStreaming);
   }
 
   void testSeek() {
@@ -274,6 +292,34 @@ trackEntries:
                 "tagName: 'TITLE'\ntagLanguage: 'und'\ntagDefault: true\ntagString: 'Elephant Dream - test 2'");
   }
 
+  void testSimpleTagBorrowedStrings() {
+    const auto DATA = toBytes({0x67, 0xC8, 0xA2, 0x45, 0xA3, 0x85, 0x54, 0x49, 0x54, 0x4C, 0x45, 0x44, 0x87,
+                               0x97, 0x45, 0x6C, 0x65, 0x70, 0x68, 0x61, 0x6E, 0x74, 0x20, 0x44, 0x72, 0x65,
+                               0x61, 0x6D, 0x20, 0x2D, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x32});
+
+    ReadOptions options{};
+    options.mediaDataSource = DATA;
+    bml::BitReader reader{std::span{DATA}};
+    SimpleTag elem{};
+    elem.read(reader, options);
+    TEST_ASSERT_FALSE(reader.hasMoreBytes());
+
+    TEST_ASSERT(elem.tagName.get() == u8"TITLE");
+    TEST_ASSERT(elem.tagName.get().isBorrowed());
+    TEST_ASSERT_EQUALS(reinterpret_cast<const char8_t *>(DATA.data() + 6), elem.tagName.get().view().data());
+    TEST_ASSERT(elem.tagString);
+    TEST_ASSERT(elem.tagString->get() == u8"Elephant Dream - test 2");
+    TEST_ASSERT(elem.tagString->get().isBorrowed());
+    TEST_ASSERT_EQUALS(reinterpret_cast<const char8_t *>(DATA.data() + 14), elem.tagString->get().view().data());
+
+    SimpleTag copied{};
+    reader = bml::BitReader{std::span{DATA}};
+    copied.read(reader, ReadOptions{});
+    TEST_ASSERT_FALSE(copied.tagName.get().isBorrowed());
+    TEST_ASSERT_FALSE(copied.tagString->get().isBorrowed());
+    TEST_ASSERT_EQUALS(copied, elem);
+  }
+
   void testTag() {
     Tag elem{};
     elem.targets = {};
@@ -456,6 +502,72 @@ blockGroups:
     referenceBlocks: [41, ])");
   }
 
+  void testClusterBorrowedMediaData() {
+    const auto DATA = toBytes({0x1F, 0x43, 0xB6, 0x75, 0xAC, 0xE7, 0x83, 0x03, 0x46, 0x34, 0xA7, 0x83, 0x5B, 0x7E,
+                               0x04, 0xAB, 0x83, 0x03, 0xAE, 0xEB, 0xA3, 0x88, 0x82, 0xFF, 0xFF, 0x00, 0xDE, 0xAD,
+                               0xBE, 0xAF, 0xA0, 0x91, 0xA1, 0x88, 0x81, 0x00, 0x00, 0x00, 0xDE, 0xAD, 0xBE, 0xEF,
+                               0x9B, 0x82, 0x03, 0x41, 0xFB, 0x81, 0x29});
+
+    ReadOptions options{};
+    options.mediaDataSource = DATA;
+    bml::BitReader reader{std::span{DATA}};
+    Cluster elem{};
+    elem.read(reader, options);
+    TEST_ASSERT_FALSE(reader.hasMoreBytes());
+
+    TEST_ASSERT_EQUALS(1U, elem.simpleBlocks.size());
+    TEST_ASSERT_EQUALS(1U, elem.simpleBlocks[0].frameDataRanges.size());
+    const auto &simpleFrame = elem.simpleBlocks[0].frameDataRanges[0];
+    TEST_ASSERT(simpleFrame.mode() == bml::DataRange::Mode::BORROWED);
+    TEST_ASSERT_EQUALS(DATA.data() + 26, simpleFrame.data().data());
+    TEST_ASSERT_EQUALS(4U, simpleFrame.data().size());
+
+    TEST_ASSERT_EQUALS(1U, elem.blockGroups.size());
+    TEST_ASSERT_EQUALS(1U, elem.blockGroups[0].block.frameDataRanges.size());
+    const auto &groupFrame = elem.blockGroups[0].block.frameDataRanges[0];
+    TEST_ASSERT(groupFrame.mode() == bml::DataRange::Mode::BORROWED);
+    TEST_ASSERT_EQUALS(DATA.data() + 38, groupFrame.data().data());
+    TEST_ASSERT_EQUALS(4U, groupFrame.data().size());
+  }
+
+  void testClusterMediaDataResource() {
+    const auto DATA = toBytes({0x1F, 0x43, 0xB6, 0x75, 0xAC, 0xE7, 0x83, 0x03, 0x46, 0x34, 0xA7, 0x83, 0x5B, 0x7E,
+                               0x04, 0xAB, 0x83, 0x03, 0xAE, 0xEB, 0xA3, 0x88, 0x82, 0xFF, 0xFF, 0x00, 0xDE, 0xAD,
+                               0xBE, 0xAF, 0xA0, 0x91, 0xA1, 0x88, 0x81, 0x00, 0x00, 0x00, 0xDE, 0xAD, 0xBE, 0xEF,
+                               0x9B, 0x82, 0x03, 0x41, 0xFB, 0x81, 0x29});
+
+    std::array<std::byte, 64> buffer{};
+    std::pmr::monotonic_buffer_resource resource{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    ReadOptions options{};
+    options.readMediaData = true;
+    options.frameDataResource = &resource;
+    bml::BitReader reader{std::span{DATA}};
+    Cluster elem{};
+    elem.read(reader, options);
+    TEST_ASSERT_FALSE(reader.hasMoreBytes());
+
+    const auto isInBuffer = [&buffer](const bml::DataRange &range) {
+      const auto *start = range.data().data();
+      return start >= buffer.data() && start + range.size() <= buffer.data() + buffer.size();
+    };
+
+    TEST_ASSERT_EQUALS(1U, elem.simpleBlocks.size());
+    TEST_ASSERT_EQUALS(1U, elem.simpleBlocks[0].frameDataRanges.size());
+    const auto &simpleFrame = elem.simpleBlocks[0].frameDataRanges[0];
+    TEST_ASSERT(simpleFrame.mode() == bml::DataRange::Mode::BORROWED);
+    TEST_ASSERT(isInBuffer(simpleFrame));
+    TEST_ASSERT_EQUALS(toBytes({0xDE, 0xAD, 0xBE, 0xAF}),
+                       std::vector<std::byte>(simpleFrame.data().begin(), simpleFrame.data().end()));
+
+    TEST_ASSERT_EQUALS(1U, elem.blockGroups.size());
+    TEST_ASSERT_EQUALS(1U, elem.blockGroups[0].block.frameDataRanges.size());
+    const auto &groupFrame = elem.blockGroups[0].block.frameDataRanges[0];
+    TEST_ASSERT(groupFrame.mode() == bml::DataRange::Mode::BORROWED);
+    TEST_ASSERT(isInBuffer(groupFrame));
+    TEST_ASSERT_EQUALS(toBytes({0xDE, 0xAD, 0xBE, 0xEF}),
+                       std::vector<std::byte>(groupFrame.data().begin(), groupFrame.data().end()));
+  }
+
   void testSegment() {
     Segment elem{};
 
@@ -760,6 +872,145 @@ tags:
     checkCopyElement<Segment>(std::span{DATA});
   }
 
+  void testSegmentIndexed() {
+    const auto writeToBytes = [](const auto &element) {
+      std::vector<std::byte> data{};
+      bml::BitWriter writer{data, bml::BitWriter::GROW};
+      element.write(writer);
+      writer.flush();
+      return data;
+    };
+
+    Info info{};
+    info.muxingApp = u8"libebml2 v0.11.0 + libmatroska2 v0.10.1";
+
+    Cluster cluster{};
+    cluster.timestamp = SegmentTimestamp<>{0x3E80};
+    {
+      SimpleBlock block{};
+      block.frameDataRanges.emplace_back(toBytes({0xDE, 0xAD, 0xBE, 0xAF}));
+      block.header.trackNumber = 1;
+      cluster.simpleBlocks.push_back(std::move(block));
+    }
+
+    Cues cues{};
+    {
+      CuePoint point{};
+      point.cueTime = MatroskaTimestamp{0x3E80};
+      CueTrackPositions pos{};
+      pos.cueTrack = 1;
+      point.cueTrackPositions.push_back(std::move(pos));
+      cues.cuePoints.push_back(std::move(point));
+    }
+
+    Tags tags{};
+    {
+      Tag tag{};
+      SimpleTag simpleTag{};
+      simpleTag.tagName = u8"TITLE";
+      simpleTag.tagString = u8"Elephant Dream - test 3";
+      tag.simpleTags.push_back(std::move(simpleTag));
+      tags.tags.push_back(std::move(tag));
+    }
+
+    const auto infoData = writeToBytes(info);
+    const auto clusterData = writeToBytes(cluster);
+    const auto cuesData = writeToBytes(cues);
+    const auto tagsData = writeToBytes(tags);
+
+    // The SeekHead size depends on the positions it stores, so iterate until the positions are stable
+    SeekHead seekHead{};
+    std::vector<std::byte> seekHeadData{};
+    for (std::size_t seekHeadSize = 0; seekHeadData.empty() || seekHeadSize != seekHeadData.size();) {
+      seekHeadSize = seekHeadData.size();
+      const auto cuesPosition = seekHeadSize + infoData.size() + clusterData.size();
+      seekHead.seeks.clear();
+      Seek seek{};
+      seek.seekID = toBytes({0x1C, 0x53, 0xBB, 0x6B});
+      seek.seekPosition = cuesPosition;
+      seekHead.seeks.push_back(seek);
+      seek.seekID = toBytes({0x12, 0x54, 0xC3, 0x67});
+      seek.seekPosition = cuesPosition + cuesData.size();
+      seekHead.seeks.push_back(seek);
+      // Cluster references are ignored
+      seek.seekID = toBytes({0x1F, 0x43, 0xB6, 0x75});
+      seek.seekPosition = seekHeadSize + infoData.size();
+      seekHead.seeks.push_back(seek);
+      seekHeadData = writeToBytes(seekHead);
+    }
+
+    const auto writeSegment = [&](bool withSeekHead) {
+      std::vector<std::byte> data{};
+      bml::BitWriter writer{data, bml::BitWriter::GROW};
+      auto size = infoData.size() + clusterData.size() + cuesData.size() + tagsData.size();
+      size += withSeekHead ? seekHeadData.size() : 0U;
+      bml::ebml::detail::writeElementHeader(writer, Segment::ID, bml::ByteCount{size});
+      if (withSeekHead) {
+        writer.writeBytes(seekHeadData);
+      }
+      writer.writeBytes(infoData);
+      writer.writeBytes(clusterData);
+      writer.writeBytes(cuesData);
+      writer.writeBytes(tagsData);
+      writer.flush();
+      return data;
+    };
+
+    {
+      const auto data = writeSegment(true);
+      bml::BitReader reader{std::span{data}};
+      Segment segment{};
+      const auto dataStart = segment.readIndexed(reader);
+      TEST_ASSERT_EQUALS(bml::ByteCount{data.size() - seekHeadData.size() - infoData.size() - clusterData.size() -
+                                        cuesData.size() - tagsData.size()},
+                         dataStart);
+      TEST_ASSERT_EQUALS(1U, segment.seekHeads.size());
+      TEST_ASSERT_EQUALS(seekHead, segment.seekHeads[0]);
+      TEST_ASSERT_EQUALS(info, segment.info);
+      TEST_ASSERT(segment.cues);
+      TEST_ASSERT_EQUALS(cues, *segment.cues);
+      TEST_ASSERT_EQUALS(1U, segment.tags.size());
+      TEST_ASSERT_EQUALS(tags, segment.tags[0]);
+      TEST_ASSERT(segment.clusters.empty());
+
+      // positioned at the first Cluster
+      TEST_ASSERT_EQUALS(dataStart + bml::ByteCount{seekHeadData.size() + infoData.size()}, reader.position());
+      Cluster readCluster{};
+      readCluster.read(reader);
+      TEST_ASSERT_EQUALS(cluster.timestamp, readCluster.timestamp);
+      TEST_ASSERT_EQUALS(1U, readCluster.simpleBlocks.size());
+    }
+
+    {
+      // Without SeekHead, the metadata after the Cluster is read linearly
+      const auto data = writeSegment(false);
+      bml::BitReader reader{std::span{data}};
+      Segment segment{};
+      const auto dataStart = segment.readIndexed(reader);
+      TEST_ASSERT(segment.seekHeads.empty());
+      TEST_ASSERT_EQUALS(info, segment.info);
+      TEST_ASSERT(segment.cues);
+      TEST_ASSERT_EQUALS(cues, *segment.cues);
+      TEST_ASSERT_EQUALS(1U, segment.tags.size());
+      TEST_ASSERT(segment.clusters.empty());
+      TEST_ASSERT_EQUALS(dataStart + bml::ByteCount{infoData.size()}, reader.position());
+    }
+
+    {
+      const auto data = writeSegment(true);
+      std::size_t index = 0;
+      bml::BitReader reader{[&](std::byte &out) {
+        if (index >= data.size()) {
+          return false;
+        }
+        out = data[index++];
+        return true;
+      }};
+      Segment segment{};
+      TEST_THROWS(segment.readIndexed(reader), std::invalid_argument);
+    }
+  }
+
   void testMatroskaChunked() {
     std::deque<uint8_t> buffer{0x1a, 0x45, 0xdf, 0xa3, 0xa9, 0xBF, 0x84, 0x84, 0x3f, 0xc8, 0xf0, 0x42,
                                0x86, 0x81, 0x02, 0x42, 0xf7, 0x81, 0x01, 0x42, 0xf2, 0x81, 0x04, 0x42,
@@ -838,6 +1089,805 @@ tags:
     TEST_ASSERT_FALSE(readChunked);
   }
 
+  void testMatroskaResumable() {
+    const std::vector<uint8_t> data{
+        /* EBMLHeader */ 0x1a, 0x45, 0xdf, 0xa3, 0xa9, 0xBF, 0x84, 0x84, 0x3f, 0xc8, 0xf0, 0x42, 0x86, 0x81, 0x02, 0x42,
+        0xf7, 0x81, 0x01, 0x42, 0xf2, 0x81, 0x04, 0x42, 0xf3, 0x81, 0x08, 0x42, 0x82, 0x88, 0x6d, 0x61, 0x74, 0x72,
+        0x6f, 0x73, 0x6b, 0x61, 0x42, 0x87, 0x81, 0x04, 0x42, 0x85, 0x81, 0x02,
+        /* Segment */ 0x18, 0x53, 0x80, 0x67, 0xFF,
+        /* Cues */ 0x1C, 0x53, 0xBB, 0x6B, 0x91, 0xBB, 0x8F, 0xB3, 0x82, 0xBB, 0xA9, 0xB7, 0x89, 0xF7, 0x81, 0x01, 0xF1,
+        0x84, 0x01, 0x3C, 0x56, 0xB8,
+        /* Cluster */ 0x1F, 0x43, 0xB6, 0x75, 0xFF, 0xE7, 0x82, 0x3E, 0x80, 0xA7, 0x83, 0x50, 0x16, 0x46,
+        /* SimpleBlock */ 0xA3, 0x88, 0x81, 0x00, 0x00, 0x00, 0xDE, 0xAD, 0xBE, 0xAF,
+        /* Cluster */ 0x1F, 0x43, 0xB6, 0x75, 0x98, 0xE7, 0x83, 0x03, 0x46, 0x34,
+        /* BlockGroup */ 0xA0, 0x91, 0xA1, 0x88, 0x81, 0x00, 0x00, 0x00, 0xDE, 0xAD, 0xBE, 0xEF, 0x9B, 0x82, 0x03, 0x41,
+        0xFB, 0x81, 0x29};
+
+    Matroska expected{};
+    {
+      bml::BitReader reader{std::as_bytes(std::span{data})};
+      expected.read(reader, {});
+    }
+    TEST_ASSERT_EQUALS(2U, expected.segment.clusters.size());
+
+    // Reading incomplete input without the resumable flag aborts
+    {
+      std::stringstream stream{};
+      stream.rdbuf()->sputn(reinterpret_cast<const char *>(data.data()), 20);
+      bml::BitReader reader{stream};
+      Matroska mkv{};
+      auto readChunked = mkv.readChunked(reader);
+      TEST_THROWS(readChunked(), EndOfStreamError);
+    }
+
+    // Append the input in small chunks and continue reading whenever more data is available
+    std::stringstream stream{};
+    bml::BitReader reader{stream};
+    Matroska mkv{};
+    auto readChunked = mkv.readChunked(reader, ReadOptions{.resumable = true});
+
+    std::vector<ElementId> elementIds{};
+    for (std::size_t offset = 0; offset < data.size(); offset += 7) {
+      auto numBytes = std::min<std::size_t>(7, data.size() - offset);
+      stream.rdbuf()->sputn(reinterpret_cast<const char *>(data.data() + offset),
+                            static_cast<std::streamsize>(numBytes));
+      while (readChunked) {
+        if (auto id = readChunked(); id != ElementId{}) {
+          elementIds.push_back(id);
+        } else {
+          TEST_ASSERT(readChunked.missingBytes() > 0_bytes);
+          break;
+        }
+      }
+    }
+
+    // The Segment has an Unknown Data Size and therefore is never finished
+    TEST_ASSERT(readChunked);
+    TEST_ASSERT_EQUALS(ElementId{}, readChunked());
+    TEST_ASSERT_EQUALS(1_bytes, readChunked.missingBytes());
+    TEST_ASSERT((std::vector<ElementId>{EBMLHeader::ID, Cues::ID, Cluster::ID, Cluster::ID}) == elementIds);
+    TEST_ASSERT_EQUALS(expected, mkv);
+  }
+
+  void testProbe() {
+    const auto writeToBytes = [](const auto &element) {
+      std::vector<std::byte> data{};
+      bml::BitWriter writer{data, bml::BitWriter::GROW};
+      element.write(writer);
+      writer.flush();
+      return data;
+    };
+
+    EBMLHeader header{};
+    header.docType = "webm";
+    header.docTypeVersion = 4U;
+
+    Info info{};
+    info.muxingApp = u8"libebml2 v0.11.0 + libmatroska2 v0.10.1";
+
+    Cluster cluster{};
+    {
+      SimpleBlock block{};
+      block.frameDataRanges.emplace_back(std::vector<std::byte>(1000, std::byte{0x17}));
+      block.header.trackNumber = 1;
+      cluster.simpleBlocks.push_back(std::move(block));
+    }
+
+    Tracks tracks{};
+    {
+      TrackEntry entry{};
+      entry.trackNumber = 1;
+      entry.trackUID = 0x6F1A06B3;
+      entry.trackType = TrackEntry::Type::VIDEO;
+      entry.codecID = "V_VP9";
+      tracks.trackEntries.push_back(std::move(entry));
+    }
+
+    const auto headerData = writeToBytes(header);
+    const auto infoData = writeToBytes(info);
+    const auto clusterData = writeToBytes(cluster);
+    const auto tracksData = writeToBytes(tracks);
+
+    // The Tracks are located after the Cluster and only referenced by the SeekHead
+    SeekHead seekHead{};
+    {
+      Seek seek{};
+      seek.seekID = toBytes({0x16, 0x54, 0xAE, 0x6B});
+      seek.seekPosition = 2U * 1024U;
+      seekHead.seeks.push_back(seek);
+    }
+    const auto seekHeadData = writeToBytes(seekHead);
+    const auto voidSize = 2U * 1024U - seekHeadData.size() - infoData.size() - clusterData.size();
+
+    std::vector<std::byte> data{};
+    {
+      bml::BitWriter writer{data, bml::BitWriter::GROW};
+      writer.writeBytes(headerData);
+      bml::ebml::detail::writeElementHeader(writer, Segment::ID, bml::ByteCount{2U * 1024U + tracksData.size()});
+      writer.writeBytes(seekHeadData);
+      writer.writeBytes(infoData);
+      writer.writeBytes(clusterData);
+      Void::fill(writer, bml::ByteCount{voidSize});
+      writer.writeBytes(tracksData);
+      writer.flush();
+    }
+    const auto segmentDataStart = bml::ByteCount{data.size() - 2U * 1024U - tracksData.size()};
+
+    {
+      const auto result = Matroska::probe(data);
+      TEST_ASSERT(result.isComplete());
+      TEST_ASSERT(result.isMatroska());
+      TEST_ASSERT_EQUALS(header, result.header.value());
+      TEST_ASSERT_EQUALS(segmentDataStart, result.segmentDataStart.value());
+      TEST_ASSERT_EQUALS(1U, result.seekHeads.size());
+      TEST_ASSERT_EQUALS(info, result.info.value());
+      TEST_ASSERT_EQUALS(tracks, result.tracks.value());
+      TEST_ASSERT_EQUALS(segmentDataStart + bml::ByteCount{seekHeadData.size() + infoData.size()},
+                         result.firstClusterPosition.value());
+    }
+
+    {
+      // The Tracks are not completely contained in the probed bytes
+      const auto result = Matroska::probe(data, bml::ByteCount{data.size() - 1U});
+      TEST_ASSERT_FALSE(result.isComplete());
+      TEST_ASSERT(result.header);
+      TEST_ASSERT(result.info);
+      TEST_ASSERT(result.firstClusterPosition);
+      TEST_ASSERT_FALSE(result.tracks);
+    }
+
+    {
+      // The EBML Header is not completely contained in the probed bytes
+      const auto result = Matroska::probe(data, bml::ByteCount{headerData.size() - 1U});
+      TEST_ASSERT_FALSE(result.header);
+      TEST_ASSERT_FALSE(result.isMatroska());
+      TEST_ASSERT_FALSE(result.segmentDataStart);
+    }
+
+    {
+      // Not an EBML document at all
+      const auto riffData = toBytes({'R', 'I', 'F', 'F', 0x24, 0x08, 0x00, 0x00, 'W', 'A', 'V', 'E'});
+      ProbeResult result{};
+      TEST_THROWS_NOTHING(result = Matroska::probe(riffData));
+      TEST_ASSERT_FALSE(result.header);
+      TEST_ASSERT_FALSE(result.isMatroska());
+      TEST_THROWS_NOTHING(result = Matroska::probe({}));
+      TEST_ASSERT_FALSE(result.header);
+    }
+  }
+
+  void testReadParallel() {
+    Matroska mkv{};
+    mkv.header.docType = "matroska";
+    {
+      TrackEntry track{};
+      track.trackNumber = 1U;
+      Tracks tracks{};
+      tracks.trackEntries.push_back(std::move(track));
+      mkv.segment.tracks = std::move(tracks);
+    }
+    for (uintmax_t i = 0; i < 16; ++i) {
+      Cluster cluster{};
+      cluster.timestamp = SegmentTimestamp<>{1000 * i};
+      for (int16_t offset : {int16_t{0}, int16_t{500}}) {
+        SimpleBlock block{};
+        block.header.trackNumber = 1;
+        block.header.timestampOffset = offset;
+        block.frameDataRanges.emplace_back(toBytes({0xDE, 0xAD, 0xBE, static_cast<uint8_t>(i)}));
+        cluster.simpleBlocks.push_back(std::move(block));
+      }
+      mkv.segment.clusters.push_back(std::move(cluster));
+    }
+    mkv.segment.tags.emplace_back().tags.emplace_back();
+
+    std::vector<std::byte> data{};
+    {
+      bml::BitWriter writer{data, bml::BitWriter::GROW};
+      mkv.write(writer);
+      writer.flush();
+    }
+
+    const ReadOptions options{.validateCRC32 = true, .readMediaData = true};
+    Matroska expected{};
+    {
+      bml::BitReader reader{std::span{data}};
+      expected.read(reader, options);
+    }
+    TEST_ASSERT_EQUALS(16U, expected.segment.clusters.size());
+
+    for (std::size_t numThreads : {1U, 3U, 0U}) {
+      Matroska parallel{};
+      TEST_THROWS_NOTHING(parallel.readParallel(data, options, numThreads));
+      TEST_ASSERT_EQUALS(expected, parallel);
+    }
+
+    ReadStatistics linearStats{};
+    {
+      Matroska mkv{};
+      bml::BitReader reader{std::span{data}};
+      auto statsOptions = options;
+      statsOptions.statistics = &linearStats;
+      TEST_THROWS_NOTHING(mkv.read(reader, statsOptions));
+    }
+    TEST_ASSERT_EQUALS(16U, linearStats.elements.at(Cluster::ID).count);
+    TEST_ASSERT_EQUALS(32U, linearStats.elements.at(SimpleBlock::ID).count);
+    TEST_ASSERT_EQUALS(32U, linearStats.numFrames);
+    TEST_ASSERT(linearStats.elements.at(SimpleBlock::ID).numBytes > 0_bytes);
+    TEST_ASSERT(linearStats.elements.at(Cluster::ID).numBytes > linearStats.elements.at(SimpleBlock::ID).numBytes);
+    TEST_ASSERT_EQUALS(0U, linearStats.numUnknownElements);
+    // Time is only measured on request
+    TEST_ASSERT_EQUALS(std::chrono::nanoseconds{}, linearStats.elements.at(Cluster::ID).duration);
+
+    for (std::size_t numThreads : {1U, 3U}) {
+      ReadStatistics stats{};
+      stats.measureTime = true;
+      auto statsOptions = options;
+      statsOptions.statistics = &stats;
+      Matroska parallel{};
+      TEST_THROWS_NOTHING(parallel.readParallel(data, statsOptions, numThreads));
+      TEST_ASSERT_EQUALS(expected, parallel);
+      // The statistics of all threads are merged
+      TEST_ASSERT_EQUALS(16U, stats.elements.at(Cluster::ID).count);
+      const auto clusterBytes = stats.elements.at(Cluster::ID).numBytes;
+      TEST_ASSERT_EQUALS(linearStats.elements.at(Cluster::ID).numBytes, clusterBytes);
+      TEST_ASSERT_EQUALS(32U, stats.elements.at(SimpleBlock::ID).count);
+      TEST_ASSERT_EQUALS(32U, stats.numFrames);
+      TEST_ASSERT(stats.elements.at(Cluster::ID).duration > std::chrono::nanoseconds{});
+    }
+  }
+
+  void testReadParallelMediaDataResource() {
+    Matroska mkv{};
+    mkv.header.docType = "matroska";
+    mkv.segment.tracks.emplace().trackEntries.emplace_back().trackNumber = 1U;
+    for (uintmax_t i = 0; i < 32; ++i) {
+      Cluster cluster{};
+      cluster.timestamp = SegmentTimestamp<>{1000 * i};
+      for (int16_t offset = 0; offset < 1000; offset += 50) {
+        SimpleBlock block{};
+        block.header.trackNumber = 1;
+        block.header.timestampOffset = offset;
+        block.frameDataRanges.emplace_back(
+            std::vector<std::byte>(32U + static_cast<std::size_t>(offset) / 10U, static_cast<std::byte>(i)));
+        cluster.simpleBlocks.push_back(std::move(block));
+      }
+      mkv.segment.clusters.push_back(std::move(cluster));
+    }
+
+    std::vector<std::byte> data{};
+    {
+      bml::BitWriter writer{data, bml::BitWriter::GROW};
+      mkv.write(writer);
+      writer.flush();
+    }
+
+    for (std::size_t numThreads : {1U, 4U}) {
+      // The monotonic buffer resource is not thread-safe itself
+      std::pmr::monotonic_buffer_resource resource{};
+      ReadOptions options{};
+      options.readMediaData = true;
+      options.frameDataResource = &resource;
+      Matroska parallel{};
+      TEST_THROWS_NOTHING(parallel.readParallel(data, options, numThreads));
+      TEST_ASSERT_EQUALS(mkv.segment.clusters.size(), parallel.segment.clusters.size());
+      bool allAllocated = true;
+      for (std::size_t i = 0; i < mkv.segment.clusters.size(); ++i) {
+        const auto &expectedBlocks = mkv.segment.clusters[i].simpleBlocks;
+        const auto &blocks = parallel.segment.clusters[i].simpleBlocks;
+        TEST_ASSERT_EQUALS(expectedBlocks.size(), blocks.size());
+        for (std::size_t j = 0; j < blocks.size(); ++j) {
+          const auto &frame = blocks[j].frameDataRanges.at(0);
+          const auto expectedFrame = expectedBlocks[j].frameDataRanges.at(0).data();
+          allAllocated &= frame.mode() == bml::DataRange::Mode::BORROWED &&
+                          std::ranges::equal(expectedFrame, frame.data());
+        }
+      }
+      TEST_ASSERT(allAllocated);
+    }
+  }
+
+  void testSkipElements() {
+    Matroska mkv{};
+    mkv.header.docType = "matroska";
+    {
+      Tracks tracks{};
+      tracks.trackEntries.emplace_back().trackNumber = 1U;
+      mkv.segment.tracks = std::move(tracks);
+    }
+    for (uintmax_t i = 0; i < 4; ++i) {
+      Cluster cluster{};
+      cluster.timestamp = SegmentTimestamp<>{1000 * i};
+      for (int16_t offset : {int16_t{0}, int16_t{500}}) {
+        SimpleBlock block{};
+        block.header.trackNumber = 1U;
+        block.header.timestampOffset = offset;
+        block.header.keyframe = true;
+        block.frameDataRanges.emplace_back(toBytes({0xDE, 0xAD, 0xBE, static_cast<uint8_t>(i)}));
+        cluster.simpleBlocks.push_back(std::move(block));
+      }
+      mkv.segment.clusters.push_back(std::move(cluster));
+    }
+    mkv.segment.tags.emplace_back().tags.emplace_back();
+
+    std::vector<std::byte> data{};
+    {
+      bml::BitWriter writer{data, bml::BitWriter::GROW};
+      mkv.write(writer, WriteOptions{.generateIndex = true});
+      writer.flush();
+    }
+
+    ReadStatistics stats{};
+    static constexpr std::array SKIPPED_IDS{Cues::ID, Tags::ID, SimpleBlock::ID};
+    const ReadOptions options{.skipElements = SKIPPED_IDS, .statistics = &stats};
+    const auto checkSkipped = [&](const Matroska &result) {
+      TEST_ASSERT(result.segment.tracks);
+      TEST_ASSERT_EQUALS(mkv.segment.tracks, result.segment.tracks);
+      TEST_ASSERT_FALSE(result.segment.cues);
+      TEST_ASSERT(result.segment.tags.empty());
+      TEST_ASSERT_EQUALS(4U, result.segment.clusters.size());
+      for (std::size_t i = 0; i < result.segment.clusters.size(); ++i) {
+        TEST_ASSERT_EQUALS(mkv.segment.clusters[i].timestamp, result.segment.clusters[i].timestamp);
+        TEST_ASSERT(result.segment.clusters[i].simpleBlocks.empty());
+      }
+    };
+
+    {
+      Matroska linear{};
+      bml::BitReader reader{std::span{data}};
+      TEST_THROWS_NOTHING(linear.read(reader, options));
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+      checkSkipped(linear);
+      // 8 SimpleBlocks, the Cues and the Tags
+      TEST_ASSERT_EQUALS(10U, stats.numSkippedElements);
+      TEST_ASSERT(stats.skippedElementBytes > 8 * 7_bytes);
+      TEST_ASSERT_FALSE(stats.elements.contains(SimpleBlock::ID));
+      TEST_ASSERT_EQUALS(0U, stats.numUnknownElements);
+    }
+
+    {
+      stats = {};
+      Matroska chunked{};
+      bml::BitReader reader{std::span{data}};
+      auto readChunked = chunked.readChunked(reader, options);
+      while (readChunked) {
+        TEST_ASSERT_NOT_EQUALS(SimpleBlock::ID, readChunked());
+      }
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+      checkSkipped(chunked);
+      // 8 SimpleBlocks, the Cues and the Tags
+      TEST_ASSERT_EQUALS(10U, stats.numSkippedElements);
+      TEST_ASSERT(stats.skippedElementBytes > 8 * 7_bytes);
+    }
+
+    {
+      // Skipped Elements are not seeked to
+      stats = {};
+      Matroska indexed{};
+      bml::BitReader reader{std::span{data}};
+      static constexpr std::array SKIPPED_TAGS{Tracks::ID, Tags::ID};
+      TEST_THROWS_NOTHING(
+          indexed.readIndexed(reader, ReadOptions{.skipElements = SKIPPED_TAGS, .statistics = &stats}));
+      TEST_ASSERT(indexed.segment.cues);
+      TEST_ASSERT_FALSE(indexed.segment.tracks);
+      TEST_ASSERT(indexed.segment.tags.empty());
+      // Only the Tracks are located before the first Cluster and therefore skipped linearly
+      TEST_ASSERT_EQUALS(1U, stats.numSkippedElements);
+      TEST_ASSERT(stats.skippedElementBytes > 0_bytes);
+      const auto tracksBytes = stats.skippedElementBytes;
+
+      stats = {};
+      Matroska streamed{};
+      bml::BitReader streamReader{std::span{data}};
+      auto stream = streamed.readFrames(streamReader, ReadOptions{.skipElements = SKIPPED_TAGS, .statistics = &stats});
+      std::size_t numFrames = 0;
+      while (stream()) {
+        ++numFrames;
+      }
+      TEST_ASSERT_EQUALS(8U, numFrames);
+      TEST_ASSERT_FALSE(streamed.segment.tracks);
+      TEST_ASSERT(streamed.segment.tags.empty());
+      // The Tracks and the Tags
+      TEST_ASSERT_EQUALS(2U, stats.numSkippedElements);
+      TEST_ASSERT(stats.skippedElementBytes > tracksBytes);
+
+      Matroska parallel{};
+      static constexpr std::array SKIPPED_CLUSTERS{Cluster::ID};
+      TEST_THROWS_NOTHING(parallel.readParallel(data, ReadOptions{.skipElements = SKIPPED_CLUSTERS}, 2));
+      TEST_ASSERT(parallel.segment.clusters.empty());
+      TEST_ASSERT(parallel.segment.tracks);
+    }
+  }
+
+  void testMuxerLive() {
+    EBMLHeader header{};
+    header.docType = "matroska";
+    Tracks tracks{};
+    tracks.trackEntries.emplace_back().trackNumber = 1U;
+    const auto frame = toBytes({0xDE, 0xAD, 0xBE, 0xEF});
+
+    std::vector<std::byte> data{};
+    {
+      bml::BitWriter writer{data, bml::BitWriter::GROW};
+      Muxer muxer{writer, header, Info{}, tracks, MuxerOptions{.maxClusterDuration = 10}};
+      TEST_ASSERT_FALSE(muxer.isSeekable());
+      muxer.writeFrame(1, SegmentTimestamp<>{0}, frame, true);
+      muxer.writeFrame(1, SegmentTimestamp<>{5}, frame, false);
+      muxer.writeFrame(1, SegmentTimestamp<>{20}, frame, true);
+      muxer.finalize();
+      TEST_THROWS(muxer.writeFrame(1, SegmentTimestamp<>{30}, frame, true), std::logic_error);
+    }
+
+    // Segment with Unknown Data Size
+    auto segmentStart = std::ranges::search(data, toBytes({0x18, 0x53, 0x80, 0x67}));
+    TEST_ASSERT_FALSE(segmentStart.empty());
+    TEST_ASSERT_EQUALS(std::byte{0xFF}, *segmentStart.end());
+
+    Matroska mkv{};
+    bml::BitReader reader{std::span{data}};
+    TEST_THROWS_NOTHING(mkv.read(reader, ReadOptions{.readMediaData = true}));
+    TEST_ASSERT(mkv.segment.seekHeads.empty());
+    TEST_ASSERT_FALSE(mkv.segment.cues);
+    TEST_ASSERT_EQUALS(1U, mkv.segment.tracks->trackEntries.size());
+    TEST_ASSERT_EQUALS(2U, mkv.segment.clusters.size());
+    TEST_ASSERT_EQUALS(SegmentTimestamp<>{0}, mkv.segment.clusters[0].timestamp.get());
+    TEST_ASSERT_EQUALS(2U, mkv.segment.clusters[0].simpleBlocks.size());
+    TEST_ASSERT(mkv.segment.clusters[0].simpleBlocks[0].header.keyframe);
+    TEST_ASSERT_EQUALS(5, mkv.segment.clusters[0].simpleBlocks[1].header.timestampOffset);
+    TEST_ASSERT_FALSE(mkv.segment.clusters[0].simpleBlocks[1].header.keyframe);
+    TEST_ASSERT_EQUALS(SegmentTimestamp<>{20}, mkv.segment.clusters[1].timestamp.get());
+    TEST_ASSERT_EQUALS(1U, mkv.segment.clusters[1].simpleBlocks.size());
+    TEST_ASSERT_EQUALS(0, mkv.segment.clusters[1].simpleBlocks[0].header.timestampOffset);
+    TEST_ASSERT_EQUALS(1U, mkv.segment.clusters[1].simpleBlocks[0].frameDataRanges.size());
+    TEST_ASSERT(std::ranges::equal(frame, mkv.segment.clusters[1].simpleBlocks[0].frameDataRanges[0].data()));
+  }
+
+  void testMuxerSeekable() {
+    EBMLHeader header{};
+    header.docType = "matroska";
+    Tracks tracks{};
+    tracks.trackEntries.emplace_back().trackNumber = 1U;
+    tracks.trackEntries.emplace_back().trackNumber = 2U;
+    const auto frame = toBytes({0xDE, 0xAD, 0xBE, 0xEF});
+
+    std::stringstream output{};
+    {
+      Muxer muxer{output, header, Info{}, tracks, MuxerOptions{.maxClusterSize = 8_bytes}};
+      TEST_ASSERT(muxer.isSeekable());
+      muxer.writeFrame(1, SegmentTimestamp<>{0}, frame, true);
+      muxer.writeFrame(2, SegmentTimestamp<>{0}, frame, true);
+      // Cluster is full, starts a new Cluster
+      muxer.writeFrame(1, SegmentTimestamp<>{10}, frame, false);
+      muxer.writeFrame(2, SegmentTimestamp<>{10}, frame, true);
+      muxer.finalize();
+    }
+    const auto str = output.str();
+    const auto data = std::as_bytes(std::span{str});
+
+    Matroska mkv{};
+    {
+      bml::BitReader reader{data};
+      TEST_THROWS_NOTHING(mkv.read(reader, ReadOptions{.readMediaData = true}));
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+    }
+    TEST_ASSERT_EQUALS(1U, mkv.segment.seekHeads.size());
+    TEST_ASSERT_EQUALS(3U, mkv.segment.seekHeads[0].seeks.size());
+    TEST_ASSERT_EQUALS(1U, mkv.segment.voidElements.size());
+    TEST_ASSERT_EQUALS(2U, mkv.segment.clusters.size());
+    TEST_ASSERT_EQUALS(2U, mkv.segment.clusters[0].simpleBlocks.size());
+    TEST_ASSERT_EQUALS(SegmentTimestamp<>{10}, mkv.segment.clusters[1].timestamp.get());
+    TEST_ASSERT_EQUALS(2U, mkv.segment.clusters[1].simpleBlocks.size());
+    TEST_ASSERT(mkv.segment.cues);
+    // The first keyframe of every Track in every Cluster
+    TEST_ASSERT_EQUALS(3U, mkv.segment.cues->cuePoints.size());
+    TEST_ASSERT_EQUALS(2U, mkv.segment.cues->cuePoints[2].cueTrackPositions[0].cueTrack.get());
+    TEST_ASSERT_EQUALS(mkv.segment.cues->cuePoints[0].cueTrackPositions[0].cueClusterPosition.get(),
+                       mkv.segment.cues->cuePoints[1].cueTrackPositions[0].cueClusterPosition.get());
+
+    Matroska indexed{};
+    bml::BitReader reader{data};
+    const auto segmentDataStart = indexed.readIndexed(reader, ReadOptions{});
+    TEST_ASSERT(indexed.segment.cues);
+    TEST_ASSERT_EQUALS(mkv.segment.cues, indexed.segment.cues);
+    TEST_ASSERT_EQUALS(mkv.segment.tracks, indexed.segment.tracks);
+
+    // The Cue positions point to the actual Clusters
+    for (const auto &cuePoint : indexed.segment.cues->cuePoints) {
+      reader.seek(segmentDataStart + BitCount{ByteCount{cuePoint.cueTrackPositions[0].cueClusterPosition.get()}});
+      Cluster cluster{};
+      TEST_THROWS_NOTHING(cluster.read(reader));
+      TEST_ASSERT_EQUALS(SegmentTimestamp<>{cuePoint.cueTime.get().value}, cluster.timestamp.get());
+    }
+    // A zero relative position (directly after a default Cluster Timestamp) is omitted as default value
+    TEST_ASSERT(indexed.segment.cues->cuePoints[2].cueTrackPositions[0].cueRelativePosition);
+  }
+
+  void testWriteGeneratedIndex() {
+    Matroska mkv{};
+    mkv.header.docType = "matroska";
+    {
+      Tracks tracks{};
+      tracks.trackEntries.emplace_back().trackNumber = 1U;
+      tracks.trackEntries.emplace_back().trackNumber = 2U;
+      mkv.segment.tracks = std::move(tracks);
+    }
+    for (uintmax_t i = 0; i < 3; ++i) {
+      Cluster cluster{};
+      cluster.timestamp = SegmentTimestamp<>{1000 * i};
+      for (int16_t offset : {int16_t{0}, int16_t{20}, int16_t{40}}) {
+        SimpleBlock block{};
+        block.header.trackNumber = offset == 20 ? 2U : 1U;
+        block.header.timestampOffset = offset;
+        // Track 1 only has a keyframe in the first Cluster
+        block.header.keyframe = offset != 0 || i == 0;
+        block.frameDataRanges.emplace_back(toBytes({0xDE, 0xAD, 0xBE, static_cast<uint8_t>(i)}));
+        cluster.simpleBlocks.push_back(std::move(block));
+      }
+      mkv.segment.clusters.push_back(std::move(cluster));
+    }
+    mkv.segment.tags.emplace_back().tags.emplace_back();
+    // Any already present Cues are replaced
+    mkv.segment.cues.emplace().cuePoints.emplace_back();
+
+    std::vector<std::byte> data{};
+    {
+      bml::BitWriter writer{data, bml::BitWriter::GROW};
+      mkv.write(writer, WriteOptions{.generateIndex = true});
+      writer.flush();
+    }
+
+    Matroska linear{};
+    {
+      bml::BitReader reader{std::span{data}};
+      TEST_THROWS_NOTHING(linear.read(reader, ReadOptions{.readMediaData = true}));
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+    }
+    TEST_ASSERT_EQUALS(1U, linear.segment.seekHeads.size());
+    // Info, Tracks, Tags and Cues
+    TEST_ASSERT_EQUALS(4U, linear.segment.seekHeads[0].seeks.size());
+    TEST_ASSERT_EQUALS(1U, linear.segment.voidElements.size());
+    TEST_ASSERT_EQUALS(mkv.segment.clusters, linear.segment.clusters);
+    TEST_ASSERT(linear.segment.cues);
+    TEST_ASSERT_EQUALS(6U, linear.segment.cues->cuePoints.size());
+
+    Matroska indexed{};
+    bml::BitReader reader{std::span{data}};
+    const auto segmentDataStart = indexed.readIndexed(reader, ReadOptions{});
+    TEST_ASSERT_EQUALS(linear.segment.cues, indexed.segment.cues);
+    TEST_ASSERT_EQUALS(linear.segment.tags, indexed.segment.tags);
+
+    // The Cue positions point to the indexed SimpleBlocks
+    for (const auto &cuePoint : indexed.segment.cues->cuePoints) {
+      const auto &positions = cuePoint.cueTrackPositions.at(0);
+      const auto clusterPosition = segmentDataStart + BitCount{ByteCount{positions.cueClusterPosition.get()}};
+      reader.seek(clusterPosition);
+      Cluster cluster{};
+      TEST_THROWS_NOTHING(cluster.read(reader));
+      reader.seek(clusterPosition);
+      bml::ebml::detail::readElementHeader(reader, Cluster::ID);
+      const auto relativePosition = positions.cueRelativePosition.value_or(UnsignedIntElement<0xF0_id>{}).get();
+      reader.seek(reader.position() + BitCount{ByteCount{relativePosition}});
+      SimpleBlock block{};
+      TEST_THROWS_NOTHING(block.read(reader));
+      TEST_ASSERT(block.header.keyframe);
+      TEST_ASSERT_EQUALS(positions.cueTrack.get(), block.header.trackNumber.get());
+      TEST_ASSERT_EQUALS(cuePoint.cueTime.get().value,
+                         cluster.timestamp.get().value + static_cast<uintmax_t>(block.header.timestampOffset.get()));
+    }
+  }
+
+  void testExtract() {
+    Matroska mkv{};
+    mkv.header.docType = "matroska";
+    mkv.segment.info.duration = SegmentTimestamp<float>{5000.0F};
+    {
+      Tracks tracks{};
+      tracks.trackEntries.emplace_back().trackNumber = 1U;
+      tracks.trackEntries.emplace_back().trackNumber = 2U;
+      mkv.segment.tracks = std::move(tracks);
+    }
+    for (uintmax_t i = 0; i < 5; ++i) {
+      Cluster cluster{};
+      cluster.timestamp = SegmentTimestamp<>{1000 * i};
+      for (int16_t offset : {int16_t{0}, int16_t{20}, int16_t{40}}) {
+        SimpleBlock block{};
+        block.header.trackNumber = offset == 20 ? 2U : 1U;
+        block.header.timestampOffset = offset;
+        // Track 1 only has keyframes in the second and fourth Cluster
+        block.header.keyframe = offset == 20 || i == 1 || i == 3;
+        block.frameDataRanges.emplace_back(toBytes({0xDE, 0xAD, 0xBE, static_cast<uint8_t>(i)}));
+        cluster.simpleBlocks.push_back(std::move(block));
+      }
+      mkv.segment.clusters.push_back(std::move(cluster));
+    }
+    mkv.segment.chapters.emplace();
+    {
+      // The extraction reads the source without media data, so the attached file contents are only referenced
+      AttachedFile file{};
+      file.fileName = u8"cover.jpg";
+      file.fileMediaType = "image/jpeg";
+      file.fileData = DataRange{toBytes({0xFF, 0xD8, 0xFF, 0xD9})};
+      file.fileUID = 42U;
+      Attachments attachments{};
+      attachments.attachedFiles.push_back(std::move(file));
+      mkv.segment.attachments = std::move(attachments);
+    }
+
+    const auto extract = [](std::span<const std::byte> data, uintmax_t start, uintmax_t end) {
+      static constexpr uintmax_t TICK = 1000000; // default Timestamp Scale
+      std::vector<std::byte> output{};
+      bml::BitReader reader{data};
+      bml::BitWriter writer{output, bml::BitWriter::GROW};
+      Matroska::extract(reader, writer, MatroskaTimestamp{start * TICK}, MatroskaTimestamp{end * TICK});
+      writer.flush();
+
+      Matroska result{};
+      bml::BitReader outputReader{std::span{output}};
+      result.read(outputReader, ReadOptions{.readMediaData = true});
+      TEST_ASSERT_FALSE(outputReader.hasMoreBytes());
+
+      // The index is valid for the extracted document
+      Matroska indexed{};
+      outputReader.seek(0_bits);
+      const auto segmentDataStart = indexed.readIndexed(outputReader, ReadOptions{});
+      TEST_ASSERT_EQUALS(result.segment.info, indexed.segment.info);
+      TEST_ASSERT_EQUALS(result.segment.cues, indexed.segment.cues);
+      if (result.segment.cues) {
+        for (const auto &cuePoint : result.segment.cues->cuePoints) {
+          const auto &positions = cuePoint.cueTrackPositions.at(0);
+          outputReader.seek(segmentDataStart + BitCount{ByteCount{positions.cueClusterPosition.get()}});
+          Cluster cluster{};
+          TEST_THROWS_NOTHING(cluster.read(outputReader));
+          TEST_ASSERT_EQUALS(cuePoint.cueTime.get().value / 1000U * 1000U, cluster.timestamp.get().value);
+        }
+      }
+      return result;
+    };
+
+    const auto checkClusters = [&mkv](const Matroska &result, std::size_t firstCluster, std::size_t numClusters,
+                                      float duration) {
+      TEST_ASSERT_EQUALS(mkv.header, result.header);
+      TEST_ASSERT_EQUALS(mkv.segment.tracks, result.segment.tracks);
+      TEST_ASSERT_FALSE(result.segment.chapters);
+      TEST_ASSERT_EQUALS(mkv.segment.attachments, result.segment.attachments);
+      TEST_ASSERT_EQUALS(1U, result.segment.seekHeads.size());
+      TEST_ASSERT_EQUALS(numClusters, result.segment.clusters.size());
+      for (std::size_t i = 0; i < std::min(numClusters, result.segment.clusters.size()); ++i) {
+        TEST_ASSERT_EQUALS(mkv.segment.clusters.at(firstCluster + i), result.segment.clusters[i]);
+      }
+      TEST_ASSERT(result.segment.info.duration);
+      if (result.segment.info.duration) {
+        TEST_ASSERT_EQUALS(duration, result.segment.info.duration->get().value);
+      }
+    };
+
+    std::vector<std::byte> indexedData{};
+    {
+      bml::BitWriter writer{indexedData, bml::BitWriter::GROW};
+      mkv.write(writer, WriteOptions{.generateIndex = true});
+      writer.flush();
+    }
+    std::vector<std::byte> linearData{};
+    {
+      bml::BitWriter writer{linearData, bml::BitWriter::GROW};
+      mkv.write(writer);
+      writer.flush();
+    }
+
+    {
+      // Starts at the last keyframe of Track 1 before the start
+      auto result = extract(indexedData, 2500, 3500);
+      checkClusters(result, 1U, 3U, 3000.0F);
+      TEST_ASSERT(result.segment.cues);
+      // 1 Cue Point for Track 1 and one for Track 2 per Cluster
+      TEST_ASSERT_EQUALS(5U, result.segment.cues->cuePoints.size());
+
+      // Starts at the last keyframe of Track 2 before the start
+      result = extract(indexedData, 3000, 3001);
+      checkClusters(result, 2U, 2U, 2000.0F);
+
+      // Up to the end of the source document
+      result = extract(indexedData, 0, 10000);
+      checkClusters(result, 0U, 5U, 5000.0F);
+
+      // A Cluster starting within the last Segment Tick before the end is included
+      std::vector<std::byte> output{};
+      bml::BitReader reader{std::span{indexedData}};
+      bml::BitWriter writer{output, bml::BitWriter::GROW};
+      Matroska::extract(reader, writer, MatroskaTimestamp{0}, MatroskaTimestamp{3000000001});
+      writer.flush();
+      Matroska fractionalEnd{};
+      bml::BitReader outputReader{std::span{output}};
+      fractionalEnd.read(outputReader, ReadOptions{.readMediaData = true});
+      checkClusters(fractionalEnd, 0U, 4U, 4000.0F);
+    }
+
+    {
+      // Without Cues, every Cluster is assumed to start with a keyframe
+      auto result = extract(linearData, 2500, 3500);
+      checkClusters(result, 2U, 2U, 2000.0F);
+      TEST_ASSERT(result.segment.cues);
+      // Cue Points are generated for the first keyframe of every Track per Cluster
+      TEST_ASSERT_EQUALS(3U, result.segment.cues->cuePoints.size());
+
+      result = extract(linearData, 4500, 10000);
+      checkClusters(result, 4U, 1U, 1000.0F);
+    }
+
+    {
+      std::vector<std::byte> output{};
+      bml::BitReader reader{std::span{indexedData}};
+      bml::BitWriter writer{output, bml::BitWriter::GROW};
+      TEST_THROWS(Matroska::extract(reader, writer, MatroskaTimestamp{1000}, MatroskaTimestamp{1000}),
+                  std::invalid_argument);
+    }
+  }
+
+  void testPrintStreaming() {
+    Matroska mkv{};
+    mkv.header.docType = "matroska";
+    mkv.segment.info.title = u8"Title";
+    for (uintmax_t i = 0; i < 2; ++i) {
+      Cluster cluster{};
+      cluster.timestamp = SegmentTimestamp<>{1000 * (i + 1)};
+      for (int16_t offset = 0; offset < 10; ++offset) {
+        SimpleBlock block{};
+        block.header.trackNumber = 1;
+        block.header.timestampOffset = offset;
+        block.frameDataRanges.emplace_back(toBytes({0xDE, 0xAD, 0xBE, static_cast<uint8_t>(offset)}));
+        cluster.simpleBlocks.push_back(std::move(block));
+      }
+      mkv.segment.clusters.push_back(std::move(cluster));
+    }
+
+    std::vector<std::byte> data{};
+    {
+      bml::BitWriter writer{data, bml::BitWriter::GROW};
+      mkv.write(writer);
+      writer.flush();
+    }
+
+    bml::yaml::Options options{};
+    options.truncateSequenceLimit = 4;
+    options.flags = bml::yaml::PrintFlags::HIDE_EMPTY | bml::yaml::PrintFlags::HIDE_DEFAULT;
+    std::string expectedInfo{};
+    {
+      std::stringstream ss{};
+      mkv.segment.info.printYAML(ss, options.nextLevel().nextLevel(true).nextLevel());
+      expectedInfo = ss.str();
+    }
+
+    std::stringstream ss{};
+    {
+      bml::BitReader reader{std::span{data}};
+      TEST_THROWS_NOTHING(Matroska::printYAML(ss, reader, ReadOptions{}, options));
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+    }
+    const auto yaml = ss.str();
+    const auto countOccurrences = [&yaml](std::string_view pattern) {
+      std::size_t count = 0;
+      for (auto pos = yaml.find(pattern); pos != std::string::npos; pos = yaml.find(pattern, pos + 1)) {
+        ++count;
+      }
+      return count;
+    };
+    TEST_ASSERT(yaml.starts_with("header:\n  docType: 'matroska'"));
+    TEST_ASSERT(yaml.find("\nsegment:\n  - info:" + expectedInfo) != std::string::npos);
+    TEST_ASSERT_EQUALS(2U, countOccurrences("\n  - cluster:\n      - timestamp: "));
+    TEST_ASSERT_EQUALS(8U, countOccurrences("\n      - simpleBlock:"));
+    TEST_ASSERT_EQUALS(2U, countOccurrences("\n      - skippedBlocks: 6"));
+
+    ss.str("");
+    {
+      bml::BitReader reader{std::span{data}};
+      TEST_THROWS_NOTHING(Matroska::print(ss, reader, ReadOptions{}));
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+    }
+    std::stringstream expected{};
+    expected << "Matroska{header = " << mkv.header << ", segment = [" << mkv.segment.info << ", "
+             << mkv.segment.clusters[0] << ", " << mkv.segment.clusters[1] << "]}";
+    TEST_ASSERT_EQUALS(expected.str(), ss.str());
+  }
+
 private:
   template <EBMLElement Element, bool WithContent = false>
   void testElement(const Element &expectedElement, const std::vector<uint8_t> &data,
@@ -861,7 +1911,12 @@ public:
     TEST_ADD(TestMkvFrames::testBlockXiphLacing);
     TEST_ADD(TestMkvFrames::testBlockFixedLacing);
     TEST_ADD(TestMkvFrames::testBlockEBMLLacing);
+    TEST_ADD(TestMkvFrames::testBlockSharedMediaData);
+    TEST_ADD(TestMkvFrames::testBlockLacingInMemory);
     TEST_ADD(TestMkvFrames::testFrameView);
+    TEST_ADD(TestMkvFrames::testSeekFrames);
+    TEST_ADD(TestMkvFrames::testLazyFrameView);
+    TEST_ADD(TestMkvFrames::testFrameStream);
     TEST_ADD(TestMkvFrames::testFillFrameDataView);
   }
 
@@ -950,6 +2005,89 @@ frames:
   - [0xde, 0xad, 0xbe, 0xef, 0xf0, 0x0b, ])");
   }
 
+  void testBlockLacingInMemory() {
+    const std::vector<std::pair<BlockHeader::Lacing, std::vector<std::size_t>>> FRAME_SIZES{
+        {BlockHeader::Lacing::XIPH, {2100U, 3U, 700U, 0U, 5U}},
+        {BlockHeader::Lacing::EBML, {300U, 290U, 310U, 305U, 5U}}};
+    for (const auto &[lacing, sizes] : FRAME_SIZES) {
+      SimpleBlock block{};
+      block.header.lacing = lacing;
+      for (auto size : sizes) {
+        std::vector<std::byte> frame(size);
+        std::fill(frame.begin(), frame.end(), std::byte{static_cast<uint8_t>(size)});
+        block.frameDataRanges.emplace_back(std::move(frame));
+      }
+
+      std::vector<std::byte> data{};
+      {
+        bml::BitWriter writer{data, bml::BitWriter::GROW};
+        block.write(writer);
+        writer.flush();
+      }
+
+      ReadOptions options{};
+      options.mediaDataSource = data;
+      bml::BitReader reader{std::span{data}};
+      SimpleBlock borrowedBlock{};
+      borrowedBlock.read(reader, options);
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+
+      options = ReadOptions{};
+      options.readMediaData = true;
+      reader = bml::BitReader{std::span{data}};
+      SimpleBlock ownedBlock{};
+      ownedBlock.read(reader, options);
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+
+      TEST_ASSERT_EQUALS(block.frameDataRanges.size(), borrowedBlock.frameDataRanges.size());
+      TEST_ASSERT_EQUALS(block.frameDataRanges.size(), ownedBlock.frameDataRanges.size());
+      for (std::size_t i = 0; i < block.frameDataRanges.size(); ++i) {
+        TEST_ASSERT(borrowedBlock.frameDataRanges[i].mode() == DataRange::Mode::BORROWED);
+        TEST_ASSERT_EQUALS(block.frameDataRanges[i].data(), borrowedBlock.frameDataRanges[i].data());
+        TEST_ASSERT_EQUALS(block.frameDataRanges[i].data(), ownedBlock.frameDataRanges[i].data());
+      }
+    }
+  }
+
+  void testBlockSharedMediaData() {
+    const auto DATA = toBytes({0xA3, 0x93, 0x80, 0x00, 0x00, 0x02, 0x02, 0x04, 0x2,  0xDE, 0xAD,
+                               0xBE, 0xEF, 0xB0, 0x0B, 0xDE, 0xAD, 0xBE, 0xEF, 0xF0, 0x0B});
+
+    std::vector<DataRange> frames{};
+    {
+      ReadOptions options{};
+      options.readMediaData = true;
+      options.shareMediaData = true;
+      bml::BitReader reader{std::span{DATA}};
+      SimpleBlock block{};
+      block.read(reader, options);
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+      frames = block.frameDataRanges;
+    }
+
+    // The Frames share a single chunk and stay valid after the Block is destroyed
+    TEST_ASSERT_EQUALS(3U, frames.size());
+    for (const auto &frame : frames) {
+      TEST_ASSERT(frame.mode() == DataRange::Mode::SHARED);
+    }
+    TEST_ASSERT_EQUALS(frames[0].data().data() + 4, frames[1].data().data());
+    TEST_ASSERT_EQUALS(frames[1].data().data() + 2, frames[2].data().data());
+    TEST_ASSERT_EQUALS(std::span{DATA}.subspan(9, 4), frames[0].data());
+    TEST_ASSERT_EQUALS(std::span{DATA}.subspan(13, 2), frames[1].data());
+    TEST_ASSERT_EQUALS(std::span{DATA}.subspan(15, 6), frames[2].data());
+
+    // Shared Frames can be written back
+    std::vector<std::byte> result{};
+    bml::BitWriter writer{result, bml::BitWriter::GROW};
+    SimpleBlock block{};
+    block.header.lacing = BlockHeader::Lacing::XIPH;
+    block.frameDataRanges = frames;
+    block.write(writer);
+    writer.flush();
+    TEST_ASSERT_EQUALS(DATA, result);
+  }
+
+
   void testFrameView() {
     Matroska mkv{};
 
@@ -1080,6 +2218,439 @@ frames:
       frames = std::vector<Frame>(tmp.begin(), tmp.end());
       TEST_ASSERT(frames.empty());
     }
+
+    {
+      TEST_ASSERT(mkv.indexFrames(3U).empty());
+
+      const auto index = mkv.indexFrames(2U);
+      TEST_ASSERT_EQUALS(2U, index.track());
+      TEST_ASSERT_EQUALS(9U, index.size());
+      const std::vector<bool> EXPECTED_KEYFRAMES{false, true, true, true, true, true, true, false, false};
+      const std::vector<uint8_t> EXPECTED_LACE_INDICES{0, 0, 1, 2, 0, 1, 2, 0, 1};
+
+      // Same Frames as produced by the FrameView
+      std::size_t i = 0;
+      for (auto frame : mkv.viewFrames(2U)) {
+        auto indexed = index[i];
+        TEST_ASSERT_EQUALS(frame.timestamp, indexed.timestamp);
+        TEST_ASSERT_EQUALS(frame.trackNumber, indexed.trackNumber);
+        TEST_ASSERT_EQUALS(frame.data.data().data(), indexed.data.data().data());
+        TEST_ASSERT_EQUALS(frame.data.size(), index.data(i).size());
+        TEST_ASSERT_EQUALS(EXPECTED_KEYFRAMES.at(i), index.isKeyframe(i));
+        TEST_ASSERT_EQUALS(EXPECTED_LACE_INDICES.at(i), index.laceIndex(i));
+        ++i;
+      }
+      TEST_ASSERT_EQUALS(index.size(), i);
+      TEST_ASSERT_EQUALS(1000U / 2U - 7U, index.timestamp(2).value);
+
+      // Same start Frames as the FrameView
+      const std::vector<std::pair<uintmax_t, std::size_t>> EXPECTED_STARTS{{50, 0}, {490, 1}, {500, 4}, {1000, 7},
+                                                                            {1500, 9}};
+      for (const auto &[start, expectedIndex] : EXPECTED_STARTS) {
+        TEST_ASSERT_EQUALS(expectedIndex, index.lowerBound(TrackTimestamp<>{start}));
+        auto frames = index.frames(TrackTimestamp<>{start});
+        TEST_ASSERT_EQUALS(index.size() - expectedIndex, static_cast<std::size_t>(std::ranges::size(frames)));
+      }
+
+      TEST_ASSERT_EQUALS(6U, index.findKeyframe(TrackTimestamp<>{1000 + 117}).value());
+      TEST_ASSERT_EQUALS(4U, index.findKeyframe(TrackTimestamp<>{1000 - 50}).value());
+      // The last laced Frame of the previous keyframe Block
+      TEST_ASSERT_EQUALS(3U, index.findKeyframe(TrackTimestamp<>{500}).value());
+      TEST_ASSERT_FALSE(index.findKeyframe(TrackTimestamp<>{400}));
+    }
+
+    {
+      // Split views produce the same Frames as the whole view
+      for (uintmax_t start : {0U, 490U, 1000U}) {
+        auto tmp = mkv.viewFrames(2U, TrackTimestamp<>{start}) | std::views::common;
+        const std::vector<Frame> expected(tmp.begin(), tmp.end());
+        for (std::size_t numParts : {0U, 1U, 2U, 3U, 17U}) {
+          const auto parts = mkv.viewFrames(2U, TrackTimestamp<>{start}).split(numParts);
+          TEST_ASSERT(!parts.empty());
+          TEST_ASSERT(parts.size() <= std::max(numParts, std::size_t{1}));
+          std::vector<Frame> frames{};
+          for (const auto &part : parts) {
+            for (auto frame : part) {
+              frames.push_back(std::move(frame));
+            }
+          }
+          TEST_ASSERT_EQUALS(expected.size(), frames.size());
+          for (std::size_t i = 0; i < std::min(expected.size(), frames.size()); ++i) {
+            TEST_ASSERT_EQUALS(expected[i].timestamp, frames[i].timestamp);
+            TEST_ASSERT_EQUALS(expected[i].data.data().data(), frames[i].data.data().data());
+          }
+        }
+      }
+    }
+  }
+
+  void testSeekFrames() {
+    Matroska mkv{};
+    {
+      TrackEntry track{};
+      track.trackNumber = 1U;
+      Tracks tracks{};
+      tracks.trackEntries.push_back(std::move(track));
+      mkv.segment.tracks = std::move(tracks);
+    }
+
+    // Write 4 Clusters with 2 Blocks each as Segment Data
+    std::vector<std::byte> data{};
+    std::vector<std::size_t> clusterPositions{};
+    {
+      bml::BitWriter writer{data, bml::BitWriter::GROW};
+      for (uintmax_t i = 0; i < 4; ++i) {
+        Cluster cluster{};
+        cluster.timestamp = SegmentTimestamp<>{1000 * i};
+        for (int16_t offset : {int16_t{0}, int16_t{500}}) {
+          SimpleBlock block{};
+          block.header.trackNumber = 1;
+          block.header.timestampOffset = offset;
+          block.frameDataRanges.emplace_back(toBytes({0xDE, 0xAD, 0xBE, 0xEF}));
+          cluster.simpleBlocks.push_back(std::move(block));
+        }
+        clusterPositions.push_back(writer.position().divide<8>().num);
+        cluster.write(writer);
+      }
+      writer.flush();
+    }
+
+    Cues cues{};
+    for (uintmax_t i = 0; i < 4; ++i) {
+      CuePoint point{};
+      point.cueTime = MatroskaTimestamp{1000 * i};
+      CueTrackPositions pos{};
+      pos.cueTrack = 1;
+      pos.cueClusterPosition = clusterPositions[i];
+      point.cueTrackPositions.push_back(std::move(pos));
+      cues.cuePoints.push_back(std::move(point));
+    }
+
+    {
+      auto index = ClusterIndex::fromCues(cues, 1U);
+      TEST_ASSERT_EQUALS(4U, index.entries.size());
+      TEST_ASSERT_EQUALS(ByteCount{clusterPositions[0]}, index.find(SegmentTimestamp<>{0})->position);
+      TEST_ASSERT_EQUALS(ByteCount{clusterPositions[1]}, index.find(SegmentTimestamp<>{1999})->position);
+      TEST_ASSERT_EQUALS(ByteCount{clusterPositions[2]}, index.find(SegmentTimestamp<>{2000})->position);
+      TEST_ASSERT_EQUALS(ByteCount{clusterPositions[3]}, index.find(SegmentTimestamp<>{10000})->position);
+      TEST_ASSERT(ClusterIndex::fromCues(cues, 2U).entries.empty());
+      TEST_ASSERT_FALSE(ClusterIndex{}.find(SegmentTimestamp<>{0}));
+
+      bml::BitReader reader{std::span{data}};
+      auto scanned = ClusterIndex::scan(reader, 0_bits);
+      TEST_ASSERT_EQUALS(index, scanned);
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+    }
+
+    const auto checkFrames = [&](const TrackTimestamp<> &start, std::size_t numClustersSkipped,
+                                 std::size_t numFramesExpected, uintmax_t firstTimestamp) {
+      bml::BitReader reader{std::span{data}};
+      ReadStatistics statistics{};
+      auto tmp = mkv.seekFrames(reader, 0_bits, 1U, start, ReadOptions{.statistics = &statistics}) | std::views::common;
+      std::vector<Frame> frames(tmp.begin(), tmp.end());
+      // The Clusters before the one containing the start Frame are never read, all following Clusters are read lazily
+      TEST_ASSERT_EQUALS(2U * (4U - numClustersSkipped), statistics.elements[SimpleBlock::ID].count);
+      TEST_ASSERT(mkv.segment.clusters.empty());
+      TEST_ASSERT_EQUALS(numFramesExpected, frames.size());
+      TEST_ASSERT_EQUALS(firstTimestamp, frames.front().timestamp.value().value);
+    };
+
+    for (bool withCues : {true, false}) {
+      if (withCues) {
+        mkv.segment.cues = cues;
+      } else {
+        mkv.segment.cues.reset();
+      }
+
+      checkFrames(TrackTimestamp<>{0}, 0U, 8U, 0U);
+      checkFrames(TrackTimestamp<>{2000}, 1U, 4U, 2000U);
+      checkFrames(TrackTimestamp<>{2200}, 2U, 3U, 2500U);
+      // The start Frame is located in the next Cluster
+      checkFrames(TrackTimestamp<>{2700}, 2U, 2U, 3000U);
+
+      bml::BitReader reader{std::span{data}};
+      auto frames = mkv.seekFrames(reader, 0_bits, 1U, TrackTimestamp<>{4000});
+      TEST_ASSERT(frames.begin() == frames.end());
+      frames = mkv.seekFrames(reader, 0_bits, 2U, TrackTimestamp<>{0});
+      TEST_ASSERT(frames.begin() == frames.end());
+    }
+
+    {
+      // Only some Clusters are referenced by the Cues, the others are still found while iterating
+      mkv.segment.cues = cues;
+      mkv.segment.cues->cuePoints.erase(mkv.segment.cues->cuePoints.begin() + 1);
+      mkv.segment.cues->cuePoints.pop_back();
+      bml::BitReader reader{std::span{data}};
+      auto tmp = mkv.seekFrames(reader, 0_bits, 1U, TrackTimestamp<>{1500}) | std::views::common;
+      std::vector<Frame> frames(tmp.begin(), tmp.end());
+      TEST_ASSERT_EQUALS(5U, frames.size());
+      TEST_ASSERT_EQUALS(1500U, frames.front().timestamp.value().value);
+    }
+  }
+
+  void testLazyFrameView() {
+    Matroska mkv{};
+    {
+      TrackEntry track{};
+      track.trackNumber = 1U;
+      Tracks tracks{};
+      tracks.trackEntries.push_back(std::move(track));
+      mkv.segment.tracks = std::move(tracks);
+    }
+
+    // Write 4 Clusters with 2 Blocks each (only the 2nd Cluster has Blocks for Track 2) after some other Element
+    std::vector<std::byte> data{};
+    std::vector<ClusterDescriptor> descriptors{};
+    {
+      bml::BitWriter writer{data, bml::BitWriter::GROW};
+      Tags tags{};
+      tags.tags.emplace_back();
+      tags.write(writer);
+      for (uintmax_t i = 0; i < 4; ++i) {
+        Cluster cluster{};
+        cluster.timestamp = SegmentTimestamp<>{1000 * i};
+        for (int16_t offset : {int16_t{0}, int16_t{500}}) {
+          SimpleBlock block{};
+          block.header.trackNumber = i == 1 ? 2 : 1;
+          block.header.timestampOffset = offset;
+          block.frameDataRanges.emplace_back(toBytes({0xDE, 0xAD, 0xBE, static_cast<uint8_t>(i)}));
+          cluster.simpleBlocks.push_back(std::move(block));
+        }
+        auto start = writer.position().divide<8>();
+        cluster.write(writer);
+        descriptors.push_back(ClusterDescriptor{start, writer.position().divide<8>() - start, cluster.timestamp.get()});
+      }
+      writer.flush();
+    }
+
+    {
+      bml::BitReader reader{std::span{data}};
+      TEST_ASSERT_EQUALS(descriptors, ClusterDescriptor::scan(reader, 0_bits));
+    }
+
+    bml::BitReader reader{std::span{data}};
+    ClusterCache clusters{reader, 0_bits, descriptors, 2U, ReadOptions{.readMediaData = true}};
+    TEST_ASSERT_EQUALS(4U, clusters.size());
+    TEST_ASSERT_EQUALS(0U, clusters.numCached());
+    TEST_ASSERT_EQUALS(clusters.get(3), clusters.get(3));
+    TEST_ASSERT_EQUALS(SegmentTimestamp<>{3000}, clusters.get(3)->timestamp.get());
+    TEST_THROWS(clusters.get(4), std::out_of_range);
+
+    {
+      const std::vector<uintmax_t> EXPECTED_TIMESTAMPS{0, 500, 2000, 2500, 3000, 3500};
+      std::vector<uintmax_t> timestamps{};
+      for (auto frame : mkv.viewFrames(clusters, 1U)) {
+        TEST_ASSERT(frame.data.hasData());
+        TEST_ASSERT_EQUALS(frame.timestamp.value().value / 1000U, std::to_integer<uintmax_t>(frame.data.data()[3]));
+        timestamps.push_back(frame.timestamp.value().value);
+        TEST_ASSERT(clusters.numCached() <= 2U);
+      }
+      TEST_ASSERT_EQUALS(EXPECTED_TIMESTAMPS, timestamps);
+    }
+
+    {
+      // Start in the middle of the Segment
+      auto tmp = mkv.viewFrames(clusters, 1U, TrackTimestamp<>{600}) | std::views::common;
+      std::vector<Frame> frames(tmp.begin(), tmp.end());
+      TEST_ASSERT_EQUALS(4U, frames.size());
+      TEST_ASSERT_EQUALS(2000U, frames.front().timestamp.value().value);
+
+      tmp = mkv.viewFrames(clusters, 1U, TrackTimestamp<>{3500}) | std::views::common;
+      frames = std::vector<Frame>(tmp.begin(), tmp.end());
+      TEST_ASSERT_EQUALS(1U, frames.size());
+
+      tmp = mkv.viewFrames(clusters, 1U, TrackTimestamp<>{3600}) | std::views::common;
+      TEST_ASSERT(tmp.begin() == tmp.end());
+    }
+
+    {
+      auto cache = std::make_unique<ClusterCache>(reader, 0_bits, descriptors, 2U);
+      TrackEntry track{};
+      track.trackNumber = 2U;
+      mkv.segment.tracks->trackEntries.push_back(std::move(track));
+      auto tmp = mkv.viewFrames(*cache, 2U) | std::views::common;
+      std::vector<Frame> frames(tmp.begin(), tmp.end());
+      TEST_ASSERT_EQUALS(2U, frames.size());
+      TEST_ASSERT_EQUALS(1000U, frames.front().timestamp.value().value);
+    }
+
+    {
+      // The Clusters are determined from the Cues, only the 1st and 3rd Cluster are referenced
+      Segment segment{};
+      segment.cues.emplace();
+      for (std::size_t i : {0U, 2U}) {
+        CuePoint point{};
+        point.cueTime = MatroskaTimestamp{descriptors[i].timestamp.value};
+        CueTrackPositions pos{};
+        pos.cueTrack = 1;
+        pos.cueClusterPosition = descriptors[i].position.num;
+        point.cueTrackPositions.push_back(std::move(pos));
+        segment.cues->cuePoints.push_back(std::move(point));
+      }
+      const std::vector<ClusterDescriptor> EXPECTED_DESCRIPTORS{
+          ClusterDescriptor{descriptors[0].position, 0_bytes, descriptors[0].timestamp},
+          ClusterDescriptor{descriptors[2].position, 0_bytes, descriptors[2].timestamp}};
+      TEST_ASSERT_EQUALS(EXPECTED_DESCRIPTORS, ClusterDescriptor::fromCues(*segment.cues));
+
+      bml::BitReader cueReader{std::span{data}};
+      ClusterCache cache{cueReader, 0_bits, segment, 2U, ReadOptions{.readMediaData = true}};
+      TEST_ASSERT_EQUALS(0_bits, cueReader.position());
+      TEST_ASSERT_EQUALS(2U, cache.size());
+
+      // Starting in the middle does not access any preceding Cluster
+      auto tmp = mkv.viewFrames(cache, 1U, TrackTimestamp<>{2600}) | std::views::common;
+      std::vector<Frame> frames(tmp.begin(), tmp.end());
+      TEST_ASSERT_EQUALS(2U, frames.size());
+      TEST_ASSERT_EQUALS(3000U, frames.front().timestamp.value().value);
+      TEST_ASSERT_EQUALS(0_bytes, cache.descriptors()[0].size);
+      TEST_ASSERT_EQUALS(3U, cache.size());
+
+      // The Clusters not referenced by the Cues are found while iterating
+      const std::vector<uintmax_t> EXPECTED_TIMESTAMPS{0, 500, 2000, 2500, 3000, 3500};
+      std::vector<uintmax_t> timestamps{};
+      for (auto frame : mkv.viewFrames(cache, 1U)) {
+        timestamps.push_back(frame.timestamp.value().value);
+      }
+      TEST_ASSERT_EQUALS(EXPECTED_TIMESTAMPS, timestamps);
+      TEST_ASSERT_EQUALS(4U, cache.size());
+      TEST_ASSERT(std::ranges::equal(descriptors, cache.descriptors()));
+
+      // Without Cues, the Clusters are scanned
+      segment.cues.reset();
+      bml::BitReader scanReader{std::span{data}};
+      ClusterCache scanned{scanReader, 0_bits, segment};
+      TEST_ASSERT(std::ranges::equal(descriptors, scanned.descriptors()));
+    }
+
+    {
+      std::size_t index = 0;
+      bml::BitReader streamReader{[&](std::byte &out) {
+        if (index >= data.size()) {
+          return false;
+        }
+        out = data[index++];
+        return true;
+      }};
+      TEST_THROWS(ClusterCache(streamReader, 0_bits, descriptors), std::invalid_argument);
+    }
+  }
+
+  void testFrameStream() {
+    std::vector<std::byte> data{};
+    Matroska expected{};
+    {
+      expected.header.docType = "matroska";
+      expected.segment.info.muxingApp = u8"bml";
+      Tracks tracks{};
+      TrackEntry track{};
+      track.trackNumber = 1U;
+      tracks.trackEntries.push_back(track);
+      track.trackNumber = 2U;
+      track.trackTimestampScale = TrackTimescale{2.0F};
+      tracks.trackEntries.push_back(track);
+      expected.segment.tracks = std::move(tracks);
+
+      for (uintmax_t i = 1; i <= 2; ++i) {
+        Cluster cluster{};
+        cluster.timestamp = SegmentTimestamp<>{1000 * i};
+        SimpleBlock block{};
+        block.header.trackNumber = 1;
+        block.header.timestampOffset = 10;
+        block.frameDataRanges.emplace_back(toBytes({0xDE, 0xAD, 0xBE, 0xEF}));
+        cluster.simpleBlocks.push_back(std::move(block));
+        BlockGroup group{};
+        group.block.header.trackNumber = 2;
+        group.block.header.timestampOffset = 20;
+        group.block.header.lacing = BlockHeader::Lacing::XIPH;
+        group.block.frameDataRanges.emplace_back(toBytes({0xB0, 0x0B}));
+        group.block.frameDataRanges.emplace_back(toBytes({0xF0, 0x0B, 0xA4}));
+        cluster.blockGroups.push_back(std::move(group));
+        expected.segment.clusters.push_back(std::move(cluster));
+      }
+
+      bml::BitWriter writer{data, bml::BitWriter::GROW};
+      expected.write(writer);
+      writer.flush();
+    }
+
+    struct ExpectedFrame {
+      uint32_t trackNumber;
+      std::optional<uintmax_t> timestamp;
+      std::vector<std::byte> data;
+    };
+    const std::vector<ExpectedFrame> EXPECTED_FRAMES{
+        {1U, 1010U, toBytes({0xDE, 0xAD, 0xBE, 0xEF})}, {2U, 520U, toBytes({0xB0, 0x0B})},
+        {2U, {}, toBytes({0xF0, 0x0B, 0xA4})},          {1U, 2010U, toBytes({0xDE, 0xAD, 0xBE, 0xEF})},
+        {2U, 1020U, toBytes({0xB0, 0x0B})},             {2U, {}, toBytes({0xF0, 0x0B, 0xA4})},
+    };
+
+    {
+      // Read from a non-seekable source with data
+      std::size_t index = 0;
+      bml::BitReader reader{[&](std::byte &out) {
+        if (index >= data.size()) {
+          return false;
+        }
+        out = data[index++];
+        return true;
+      }};
+      Matroska mkv{};
+      auto stream = mkv.readFrames(reader, ReadOptions{.readMediaData = true});
+      // Nothing is read before the first Frame is requested
+      TEST_ASSERT_EQUALS(0U, index);
+
+      std::size_t i = 0;
+      while (auto frame = stream()) {
+        const auto &expectedFrame = EXPECTED_FRAMES.at(i);
+        TEST_ASSERT_EQUALS(expectedFrame.trackNumber, frame->trackNumber);
+        if (expectedFrame.timestamp) {
+          TEST_ASSERT_EQUALS(*expectedFrame.timestamp, frame->timestamp.value().value);
+        } else {
+          TEST_ASSERT_FALSE(frame->timestamp);
+        }
+        TEST_ASSERT(frame->data.hasData());
+        TEST_ASSERT(std::ranges::equal(expectedFrame.data, frame->data.data()));
+        if (i == 0) {
+          // Metadata is read before the first Frame
+          TEST_ASSERT_EQUALS(expected.header, mkv.header);
+          TEST_ASSERT_EQUALS(expected.segment.info, mkv.segment.info);
+          TEST_ASSERT(expected.segment.tracks == mkv.segment.tracks);
+        }
+        ++i;
+      }
+      TEST_ASSERT_EQUALS(EXPECTED_FRAMES.size(), i);
+      TEST_ASSERT_FALSE(stream);
+      TEST_ASSERT(mkv.segment.clusters.empty());
+      TEST_ASSERT_FALSE(stream());
+    }
+
+    {
+      // Read without data
+      bml::BitReader reader{std::span{data}};
+      Matroska mkv{};
+      auto stream = mkv.readFrames(reader);
+      std::size_t i = 0;
+      while (auto frame = stream()) {
+        TEST_ASSERT_FALSE(frame->data.hasData());
+        TEST_ASSERT(frame->data.byteRange());
+        TEST_ASSERT(std::ranges::equal(EXPECTED_FRAMES.at(i).data, frame->data.byteRange().applyTo(std::span{data})));
+        ++i;
+      }
+      TEST_ASSERT_EQUALS(EXPECTED_FRAMES.size(), i);
+    }
+
+    {
+      // Errors are forwarded
+      data.resize(data.size() - 2U);
+      bml::BitReader reader{std::span{data}};
+      Matroska mkv{};
+      auto stream = mkv.readFrames(reader);
+      const auto drainStream = [&stream]() {
+        while (stream()) {
+        }
+      };
+      TEST_THROWS(drainStream(), bml::EndOfStreamError);
+    }
   }
 
   void testFillFrameDataView() {
@@ -1174,6 +2745,34 @@ frames:
     }
     TEST_ASSERT_EQUALS(3, std::distance(FRAMES_DATA.begin(), it));
 
+    for (auto maxGap : {0_bytes, 4_bytes, 64_bytes}) {
+      std::stringstream stream{};
+      stream.write(reinterpret_cast<const char *>(DATA.data()), static_cast<std::streamsize>(DATA.size()));
+      auto range3 = mkv.viewFrames(1) | std::ranges::views::take(5) |
+                    BufferedFillDataRange<Frame>{bml::DataRangeBuffer{stream, maxGap}, &Frame::data};
+      it = FRAMES_DATA.begin();
+      for (auto frame : range3) {
+        TEST_ASSERT(frame.data.mode() == bml::DataRange::Mode::BORROWED);
+        TEST_ASSERT_EQUALS(it->second, frame.data.data());
+        ++it;
+      }
+      TEST_ASSERT(it == FRAMES_DATA.end());
+    }
+
+    {
+      std::stringstream stream{};
+      stream.write(reinterpret_cast<const char *>(DATA.data()), static_cast<std::streamsize>(DATA.size()));
+      bml::DataRangeBuffer buffer{stream, 4_bytes};
+      const std::vector<ByteRange> RANGES{{4_bytes, 4_bytes}, {15_bytes, 4_bytes}};
+      TEST_ASSERT_EQUALS(FRAMES_DATA[0].second, buffer.read(ByteRange{0_bytes, 4_bytes}, RANGES));
+      TEST_ASSERT(buffer.contains(RANGES[0]));
+      TEST_ASSERT_FALSE(buffer.contains(RANGES[1]));
+      TEST_ASSERT_EQUALS(FRAMES_DATA[1].second, buffer.read(RANGES[0]));
+      TEST_ASSERT_EQUALS(FRAMES_DATA[2].second, buffer.read(RANGES[1]));
+      TEST_ASSERT_FALSE(buffer.contains(RANGES[0]));
+      TEST_THROWS(buffer.read(ByteRange{27_bytes, 2_bytes}), EndOfStreamError);
+    }
+
     // Check error on Frame byte range not in source
     {
       auto fullIt = (mkv.viewFrames(1) | fillFrameData(DATA)).begin();
@@ -1194,6 +2793,17 @@ frames:
       }
       TEST_THROWS(*fullIt, EndOfStreamError);
     }
+
+    {
+      std::stringstream stream{};
+      stream.write(reinterpret_cast<const char *>(DATA.data()), static_cast<std::streamsize>(DATA.size()));
+      auto fullRange = mkv.viewFrames(1) | fillFrameDataBuffered(stream);
+      auto fullIt = fullRange.begin();
+      for (uint32_t i = 0; i < 4; ++i) {
+        TEST_THROWS_NOTHING(++fullIt);
+      }
+      TEST_THROWS(++fullIt, EndOfStreamError);
+    }
   }
 
 private:
@@ -1,12 +1,84 @@
 #include "types.hpp"
 
+#include "buffer_pool.hpp"
 #include "errors.hpp"
+#include "mapped_file.hpp"
+#include "span_reader.hpp"
+#include "span_writer.hpp"
 #include "test_helper.hpp"
 
 #include "cpptest-main.h"
 
+#include <filesystem>
+#include <fstream>
+#include <streambuf>
+#include <system_error>
+#include <thread>
+
 using namespace bml;
 
+/**
+ * Seekable stream buffer over the given data, handing out only small chunks and yielding the thread on every refill
+ * to provoke interleaved accesses from multiple threads.
+ */
+class SlowStreamBuffer : public std::streambuf {
+public:
+  explicit SlowStreamBuffer(std::span<const std::byte> bytes)
+      : begin(const_cast<char *>(reinterpret_cast<const char *>(bytes.data()))), end(begin + bytes.size()) {
+    setg(begin, begin, begin);
+  }
+
+protected:
+  int_type underflow() override {
+    std::this_thread::yield();
+    if (gptr() == end) {
+      return traits_type::eof();
+    }
+    setg(begin, gptr(), std::min(gptr() + CHUNK_SIZE, end));
+    return traits_type::to_int_type(*gptr());
+  }
+
+  pos_type seekoff(off_type offset, std::ios::seekdir dir, std::ios::openmode) override {
+    auto base = dir == std::ios::beg ? begin : (dir == std::ios::end ? end : gptr());
+    return seekpos(pos_type(base - begin + offset), std::ios::in);
+  }
+
+  pos_type seekpos(pos_type position, std::ios::openmode) override {
+    if (position < 0 || position > end - begin) {
+      return pos_type(off_type(-1));
+    }
+    setg(begin, begin + position, begin + position);
+    return position;
+  }
+
+private:
+  static constexpr std::ptrdiff_t CHUNK_SIZE = 64;
+  char *begin;
+  char *end;
+};
+
+/** Aggregate with a custom binary representation, which must not be read/written member-wise by any other reader */
+struct Nibbles {
+  uint8_t high;
+  uint8_t low;
+
+  void read(BitReader &reader) {
+    high = reader.read<uint8_t>(4_bits);
+    low = reader.read<uint8_t>(4_bits);
+  }
+
+  void write(BitWriter &writer) const {
+    writer.write(high, 4_bits);
+    writer.write(low, 4_bits);
+  }
+};
+
+template <typename Reader, typename Type>
+concept ReadableWith = requires(Reader &reader, Type &obj) { bml::read(reader, obj); };
+
+template <typename Writer, typename Type>
+concept WritableWith = requires(Writer &writer, const Type &obj) { bml::write(writer, obj); };
+
 struct TestBase : public Test::Suite {
 protected:
   TestBase(const std::string &name) : Test::Suite(name) {}
@@ -56,6 +128,16 @@ protected:
     TEST_ASSERT_EQUALS(numBits, writer.position());
     writer.flush();
     TEST_ASSERT_EQUALS(expectedData, data);
+
+    std::stringstream output{};
+    writer = BitWriter{output};
+    TEST_THROWS_NOTHING(bml::write(writer, value));
+    TEST_ASSERT_EQUALS(numBits, writer.position());
+    writer.flush();
+    auto outputData = output.str();
+    data.assign(reinterpret_cast<const std::byte *>(outputData.data()),
+                reinterpret_cast<const std::byte *>(outputData.data() + outputData.size()));
+    TEST_ASSERT_EQUALS(expectedData, data);
   }
 
   template <typename T>
@@ -153,11 +235,26 @@ public:
     TEST_ADD(TestIO::testEmptyReader);
     TEST_ADD(TestIO::testEmptyWriter);
     TEST_ADD(TestIO::testReaderEos);
+    TEST_ADD(TestIO::testSpanReader);
+    TEST_ADD(TestIO::testSpanWriter);
+    TEST_ADD(TestIO::testSpanConstantEvaluation);
+    TEST_ADD(TestIO::testBufferedReader);
+    TEST_ADD(TestIO::testPrefetchingReader);
+    TEST_ADD(TestIO::testBytesUntil);
+    TEST_ADD(TestIO::testSeek);
+    TEST_ADD(TestIO::testSubReader);
+    TEST_ADD(TestIO::testBaseReader);
+    TEST_ADD(TestIO::testReaderStatistics);
     TEST_ADD(TestIO::testWriterEos);
+    TEST_ADD(TestIO::testWriterBulk);
+    TEST_ADD(TestIO::testWriteBufferPool);
+    TEST_ADD(TestIO::testCopyBytes);
+    TEST_ADD(TestIO::testBatchCodes);
     TEST_ADD(TestIO::testBool);
     TEST_ADD(TestIO::testByte);
     TEST_ADD(TestIO::testChar);
     TEST_ADD(TestIO::testIntegral);
+    TEST_ADD(TestIO::testBulkIntegral);
     TEST_ADD(TestIO::testEnum);
     TEST_ADD(TestIO::testNonTrivial);
     TEST_ADD(TestIO::testMemberFunctions);
@@ -168,6 +265,7 @@ public:
     TEST_ADD(TestIO::testRawBytes);
     TEST_ADD(TestIO::testSizes);
     TEST_ADD(TestIO::testReadOptional);
+    TEST_ADD(TestIO::testMappedFile);
   }
 
   void testEmptyReader() {
@@ -242,6 +340,580 @@ public:
     }
   }
 
+  void testSpanReader() {
+    const auto data = toBytes({0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0, 0x0F, 0xED, 0xCB, 0xA9, 0x87, 0x65,
+                               0x43, 0x21, 0xFF, 0x00, 0xAA, 0x55});
+    {
+      // Compare with BitReader on same input
+      BitReader bitReader{data};
+      SpanReader spanReader{data};
+      for (auto numBits : {3_bits, 1_bits, 17_bits, 64_bits, 7_bits, 8_bits, 33_bits, 20_bits, 3_bits}) {
+        TEST_ASSERT_EQUALS(bitReader.position(), spanReader.position());
+        if (auto peeked = bitReader.peek(numBits)) {
+          TEST_ASSERT_EQUALS(peeked, spanReader.peek(numBits));
+        }
+        TEST_ASSERT_EQUALS(bitReader.read(numBits), spanReader.read(numBits));
+      }
+      TEST_ASSERT_EQUALS(bitReader.position(), spanReader.position());
+      TEST_ASSERT_EQUALS(4_bits, spanReader.remainingBits());
+      TEST_ASSERT_FALSE(spanReader.hasMoreBytes());
+      TEST_ASSERT_FALSE(spanReader.peek(5_bits));
+      TEST_THROWS(spanReader.read(5_bits), EndOfStreamError);
+      TEST_ASSERT_EQUALS(0x5U, spanReader.read(4_bits));
+    }
+
+    {
+      SpanReader reader{data};
+      TEST_ASSERT_EQUALS(0x12U, reader.readBytes(1_bytes));
+      TEST_ASSERT_FALSE(reader.read());
+      TEST_THROWS(reader.readBytes(1_bytes), std::invalid_argument);
+      TEST_ASSERT_EQUALS(2_bytes, reader.position());
+      TEST_ASSERT_EQUALS(0x56U, reader.peek(1_bytes));
+      TEST_THROWS_NOTHING(reader.skip(11_bits));
+      TEST_ASSERT_EQUALS(0x18U, reader.read(5_bits));
+      TEST_ASSERT_EQUALS(4_bytes, reader.position());
+      std::array<std::byte, 5> bytes{};
+      TEST_THROWS_NOTHING(reader.readBytesInto(bytes));
+      TEST_ASSERT_EQUALS(std::span{data}.subspan(4, 5), bytes);
+      TEST_ASSERT_EQUALS(std::byte{0xED}, reader.readByte());
+      TEST_THROWS_NOTHING(reader.skip(9_bytes + 4_bits));
+      TEST_ASSERT_EQUALS(0x5U, reader.read(4_bits));
+      TEST_ASSERT_EQUALS(ByteCount{data.size()}, reader.position());
+      TEST_THROWS(reader.skip(1_bits), EndOfStreamError);
+      TEST_THROWS(reader.readBytesInto(bytes), EndOfStreamError);
+      TEST_THROWS(reader.readByte(), EndOfStreamError);
+    }
+
+    {
+      SpanReader reader{};
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+      TEST_ASSERT_EQUALS(0_bits, reader.position());
+      TEST_ASSERT_FALSE(reader.peek(7_bits));
+      TEST_THROWS(reader.read(), EndOfStreamError);
+      TEST_THROWS(reader.read(65_bits), std::out_of_range);
+    }
+  }
+
+  void testSpanWriter() {
+    const auto expectedData = toBytes({0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xA0, 0x12, 0x34, 0x56, 0x78,
+                                       0x9A, 0xBC, 0xDE, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x42, 0x00, 0x17, 0xC0});
+    const auto writeData = [](auto &writer) {
+      writer.write(0x0123456789ABCDEFU, 8_bytes);
+      writer.write(0x5, 3_bits);
+      writer.write(false);
+      writer.write(0x0123456789ABCDEFU, 8_bytes);
+      writer.write(0x0, 4_bits);
+      writer.fillBytes(std::byte{0xFF}, 4_bytes);
+      writer.writeByte(std::byte{0x42});
+      const std::array<uint16_t, 1> values{0x0017};
+      writer.writeBigEndian(std::span<const uint16_t>{values});
+      writer.write(true);
+      writer.fillToAligment(2_bits, true);
+      writer.flush();
+    };
+
+    {
+      // Compare with BitWriter for the same output
+      std::vector<std::byte> bitData{};
+      BitWriter bitWriter{bitData, BitWriter::GROW};
+      TEST_THROWS_NOTHING(writeData(bitWriter));
+
+      std::vector<std::byte> data(expectedData.size() + 1U, std::byte{0x42});
+      SpanWriter writer{std::span{data}};
+      TEST_THROWS_NOTHING(writeData(writer));
+      TEST_ASSERT_EQUALS(ByteCount{expectedData.size()}, writer.position());
+      TEST_ASSERT_EQUALS(1_bytes, writer.remainingBits());
+      TEST_ASSERT_EQUALS(expectedData, std::span{data}.first(expectedData.size()));
+      TEST_ASSERT_EQUALS(bitData, std::span{data}.first(expectedData.size()));
+      // The byte after the written data is untouched
+      TEST_ASSERT_EQUALS(std::byte{0x42}, data.back());
+    }
+
+    {
+      std::array<std::byte, 2> data{};
+      SpanWriter writer{data};
+      TEST_THROWS_NOTHING(writer.write(0x3, 3_bits));
+      TEST_THROWS(writer.writeByte(std::byte{17}), std::invalid_argument);
+      TEST_THROWS(writer.write(0, 65_bits), std::out_of_range);
+      TEST_THROWS(writer.write(42, 14_bits), EndOfStreamError);
+      TEST_ASSERT_EQUALS(3_bits, writer.remainingBits() - 10_bits);
+      TEST_THROWS_NOTHING(writer.flush());
+      TEST_THROWS(writer.writeBytes(42, 2_bytes), EndOfStreamError);
+      TEST_THROWS(writer.fillBytes(std::byte{0xFF}, 2_bytes), EndOfStreamError);
+      TEST_THROWS_NOTHING(writer.writeBytes(std::span{data}.first(1)));
+      TEST_ASSERT_EQUALS(0_bits, writer.remainingBits());
+      TEST_ASSERT_EQUALS(std::byte{0x60}, data[0]);
+      TEST_ASSERT_EQUALS(std::byte{0x60}, data[1]);
+    }
+  }
+
+  void testSpanConstantEvaluation() {
+    // POD{-2, 0x12345678, 'x'}, EnumType::BAR, std::array<uint8_t, 2>{0x20, 0xA5}, std::tuple<bool, bool>{true, false}
+    static constexpr std::array<std::byte, 13> DATA{std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFE},
+                                                    std::byte{0x12}, std::byte{0x34}, std::byte{0x56}, std::byte{0x78},
+                                                    std::byte{0x78}, std::byte{0x11}, std::byte{0x20}, std::byte{0xA5},
+                                                    std::byte{0x80}};
+
+    static constexpr auto VALUES = [] {
+      SpanReader reader{DATA};
+      auto pod = bml::read<POD>(reader);
+      auto enumValue = bml::read<EnumType>(reader);
+      auto array = bml::read<std::array<uint8_t, 2>>(reader);
+      auto tuple = bml::read<std::tuple<bool, bool>>(reader);
+      return std::make_tuple(pod, enumValue, array, tuple);
+    }();
+    static_assert(std::get<0>(VALUES).a == -2 && std::get<0>(VALUES).foo == 0x12345678U);
+    static_assert(std::get<0>(VALUES).c == 'x');
+    static_assert(std::get<1>(VALUES) == EnumType::BAR);
+    static_assert(std::get<2>(VALUES) == std::array<uint8_t, 2>{0x20, 0xA5});
+    static_assert(std::get<3>(VALUES) == std::tuple<bool, bool>{true, false});
+
+    static constexpr auto ENCODED = [] {
+      std::array<std::byte, DATA.size()> result{};
+      SpanWriter writer{result};
+      std::apply([&writer](const auto &...values) { (bml::write(writer, values), ...); }, VALUES);
+      writer.flush();
+      return result;
+    }();
+    static_assert(ENCODED == DATA);
+
+    // Types with custom read()/write() members are never mapped member-wise, even if these members do not accept the
+    // span reader/writer
+    static_assert(ReadableWith<BitReader, Nibbles> && !ReadableWith<SpanReader, Nibbles>);
+    static_assert(WritableWith<BitWriter, Nibbles> && !WritableWith<SpanWriter, Nibbles>);
+
+    // Same results at run-time
+    SpanReader reader{DATA};
+    TEST_ASSERT_EQUALS(std::get<0>(VALUES), bml::read<POD>(reader));
+    TEST_ASSERT_EQUALS(std::get<1>(VALUES), bml::read<EnumType>(reader));
+    std::array<std::byte, DATA.size()> data{};
+    SpanWriter writer{data};
+    TEST_THROWS_NOTHING(
+        std::apply([&writer](const auto &...values) { (bml::write(writer, values), ...); }, VALUES));
+    TEST_THROWS_NOTHING(writer.flush());
+    TEST_ASSERT_EQUALS(std::span{DATA}, data);
+  }
+
+  void testBufferedReader() {
+    const auto data = toBytes({0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0, 0x0F, 0xED, 0xCB, 0xA9, 0x87, 0x65,
+                               0x43, 0x21, 0xFF, 0x00, 0xAA, 0x55});
+    const std::string input(reinterpret_cast<const char *>(data.data()), data.size());
+
+    for (auto readAheadSize : {1_bytes, 3_bytes, 8_bytes, BitReader::DEFAULT_READ_AHEAD}) {
+      std::stringstream stream{input};
+      BitReader streamReader{stream, readAheadSize};
+      BitReader generatorReader{[remaining{std::span{data}}](std::span<std::byte> out) mutable {
+                                  auto numBytes = std::min(out.size(), remaining.size());
+                                  std::copy_n(remaining.begin(), numBytes, out.begin());
+                                  remaining = remaining.subspan(numBytes);
+                                  return numBytes;
+                                },
+                                readAheadSize};
+
+      for (auto *reader : {&streamReader, &generatorReader}) {
+        TEST_ASSERT(reader->hasMoreBytes());
+        TEST_ASSERT_EQUALS(0x0U, reader->read(3_bits));
+        TEST_ASSERT_EQUALS(0x12345U, reader->read(17_bits));
+        TEST_ASSERT_EQUALS(0x6U, reader->peek(4_bits));
+        TEST_ASSERT_EQUALS(20_bits, reader->position());
+        TEST_THROWS_NOTHING(reader->skipToAligment(1_bytes));
+        TEST_ASSERT_EQUALS(0x789ABCDEF0U, reader->readBytes(5_bytes));
+        std::array<std::byte, 4> bytes{};
+        TEST_THROWS_NOTHING(reader->readBytesInto(bytes));
+        TEST_ASSERT_EQUALS(std::span{data}.subspan(8, 4), bytes);
+        TEST_THROWS_NOTHING(reader->skip(2_bytes));
+        TEST_ASSERT_EQUALS(2_bytes, reader->skipBytesUntil(toBytes({0xFF, 0x00})));
+        TEST_ASSERT_EQUALS(0xFF00U, reader->readBytes(2_bytes));
+        TEST_THROWS_NOTHING(reader->skip(9_bits));
+        TEST_ASSERT_EQUALS(0x55U, reader->read(7_bits));
+        TEST_ASSERT_EQUALS(ByteCount{data.size()}, reader->position());
+        TEST_ASSERT_FALSE(reader->hasMoreBytes());
+        TEST_THROWS(reader->read(), EndOfStreamError);
+        TEST_THROWS(reader->skip(1_bytes), EndOfStreamError);
+      }
+    }
+
+    {
+      // Unread buffered bytes are returned to the stream
+      std::stringstream stream{input};
+      {
+        BitReader reader{stream, BitReader::DEFAULT_READ_AHEAD};
+        std::array<std::byte, 3> bytes{};
+        TEST_THROWS_NOTHING(reader.readBytesInto(bytes));
+      }
+      TEST_ASSERT_EQUALS(3, stream.tellg());
+      char c{};
+      TEST_ASSERT(stream.get(c));
+      TEST_ASSERT_EQUALS('\x78', c);
+    }
+
+    {
+      // Bytes already loaded into the cache are also returned to the stream
+      std::stringstream stream{input};
+      {
+        BitReader reader{stream, BitReader::DEFAULT_READ_AHEAD};
+        TEST_ASSERT_EQUALS(0x12U, reader.read(8_bits));
+        TEST_ASSERT_EQUALS(0x3U, reader.read(4_bits));
+      }
+      TEST_ASSERT_EQUALS(2, stream.tellg());
+    }
+  }
+
+  void testPrefetchingReader() {
+    std::vector<std::byte> data(100000);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      data[i] = static_cast<std::byte>(i * 13U);
+    }
+    const std::string input(reinterpret_cast<const char *>(data.data()), data.size());
+
+    for (auto [readAheadSize, numChunks] : {std::pair{1_bytes, 1U}, {7_bytes, 3U}, {4096_bytes, 4U}}) {
+      std::stringstream stream{input};
+      BitReader streamReader{stream, readAheadSize, numChunks};
+      BitReader generatorReader{[remaining{std::span{data}}](std::span<std::byte> out) mutable {
+                                  auto numBytes = std::min(out.size(), remaining.size());
+                                  std::copy_n(remaining.begin(), numBytes, out.begin());
+                                  remaining = remaining.subspan(numBytes);
+                                  return numBytes;
+                                },
+                                readAheadSize, numChunks};
+
+      for (auto *reader : {&streamReader, &generatorReader}) {
+        TEST_ASSERT_EQUALS(static_cast<uintmax_t>(data[0]) >> 5U, reader->read(3_bits));
+        TEST_THROWS_NOTHING(reader->skipToAligment(1_bytes));
+        TEST_ASSERT_EQUALS(static_cast<uintmax_t>(data[1]), reader->readBytes(1_bytes));
+        std::vector<std::byte> bytes(20000);
+        TEST_THROWS_NOTHING(reader->readBytesInto(bytes));
+        TEST_ASSERT(std::equal(bytes.begin(), bytes.end(), data.begin() + 2));
+        TEST_THROWS_NOTHING(reader->skip(ByteCount{50000}));
+        TEST_ASSERT_EQUALS(static_cast<uintmax_t>(data[70002]), reader->readBytes(1_bytes));
+        TEST_THROWS_NOTHING(reader->skip(ByteCount{data.size() - 70004}));
+        TEST_ASSERT_EQUALS(static_cast<uintmax_t>(data.back()), reader->readBytes(1_bytes));
+        TEST_ASSERT_FALSE(reader->hasMoreBytes());
+        TEST_THROWS(reader->read(), EndOfStreamError);
+      }
+
+      TEST_ASSERT(streamReader.isSeekable());
+      TEST_THROWS_NOTHING(streamReader.seek(ByteCount{12345}));
+      TEST_ASSERT_EQUALS(static_cast<uintmax_t>(data[12345]), streamReader.readBytes(1_bytes));
+      TEST_ASSERT_FALSE(generatorReader.isSeekable());
+    }
+
+    {
+      // Errors of the source are rethrown on the reading thread
+      BitReader reader{[](std::span<std::byte>) -> std::size_t { throw std::runtime_error("source failed"); }, 8_bytes,
+                       2};
+      TEST_THROWS(reader.read(), std::runtime_error);
+      TEST_THROWS(reader.read(), std::runtime_error);
+    }
+
+    {
+      // Unread prefetched bytes are returned to the stream
+      std::stringstream stream{input};
+      {
+        BitReader reader{stream, 1000_bytes, 4};
+        std::array<std::byte, 3> bytes{};
+        TEST_THROWS_NOTHING(reader.readBytesInto(bytes));
+      }
+      TEST_ASSERT_EQUALS(3, stream.tellg());
+    }
+
+    {
+      // Bytes already loaded into the cache are also returned to the stream
+      std::stringstream stream{input};
+      {
+        BitReader reader{stream, 1000_bytes, 4};
+        TEST_ASSERT_EQUALS(static_cast<uintmax_t>(data[0]), reader.read(8_bits));
+      }
+      TEST_ASSERT_EQUALS(1, stream.tellg());
+    }
+
+    {
+      // Sub-readers access the stream shared with the background thread without interfering with it
+      std::vector<std::byte> largeData(1024U * 1024U);
+      for (std::size_t i = 0; i < largeData.size(); ++i) {
+        largeData[i] = static_cast<std::byte>(i * 7U + i / 251U);
+      }
+      SlowStreamBuffer streamBuffer{largeData};
+      std::istream stream{&streamBuffer};
+      BitReader reader{stream, 4096_bytes, 2};
+      const auto half = largeData.size() / 2U;
+      auto sub = reader.subReader(ByteRange{ByteCount{half}, ByteCount{half}});
+      std::vector<std::byte> mainBytes(1000);
+      std::vector<std::byte> subBytes(1000);
+      bool mainMatches = true;
+      bool subMatches = true;
+      for (std::size_t offset = 0; offset + mainBytes.size() <= half; offset += mainBytes.size()) {
+        reader.readBytesInto(mainBytes);
+        sub.readBytesInto(subBytes);
+        mainMatches &= std::equal(mainBytes.begin(), mainBytes.end(), largeData.begin() + offset);
+        subMatches &= std::equal(subBytes.begin(), subBytes.end(), largeData.begin() + half + offset);
+      }
+      TEST_ASSERT(mainMatches);
+      TEST_ASSERT(subMatches);
+    }
+  }
+
+  void testBytesUntil() {
+    const auto DATA = toBytes({0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x01, 0x00, 0x00});
+    const auto PATTERN = toBytes({0x00, 0x00, 0x01});
+    const std::string input(reinterpret_cast<const char *>(DATA.data()), DATA.size());
+
+    const auto checkBytesUntil = [&](BitReader &reader) {
+      TEST_ASSERT_EQUALS(std::span{DATA}.first(4), reader.readBytesUntil(PATTERN));
+      TEST_ASSERT_EQUALS(0x000001U, reader.readBytes(3_bytes));
+      TEST_ASSERT_EQUALS(std::span{DATA}.subspan(7), reader.readBytesUntil(PATTERN));
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+    };
+    const auto checkSkipBytesUntil = [&](BitReader &reader) {
+      TEST_ASSERT_EQUALS(4_bytes, reader.skipBytesUntil(PATTERN));
+      TEST_ASSERT_EQUALS(4_bytes, reader.position());
+      TEST_ASSERT_EQUALS(0_bytes, reader.skipBytesUntil(PATTERN));
+      TEST_ASSERT_EQUALS(0x00000165U, reader.readBytes(4_bytes));
+      TEST_ASSERT_EQUALS(4_bytes, reader.skipBytesUntil(PATTERN));
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+    };
+
+    const auto checkReaders = [&](const auto &check) {
+      {
+        BitReader reader{std::span{DATA}};
+        check(reader);
+      }
+      {
+        std::stringstream stream{input};
+        BitReader reader{stream};
+        check(reader);
+      }
+      for (auto readAheadSize : {1_bytes, 2_bytes, 3_bytes, 5_bytes, BitReader::DEFAULT_READ_AHEAD}) {
+        std::stringstream stream{input};
+        BitReader reader{stream, readAheadSize};
+        check(reader);
+      }
+    };
+    checkReaders(checkBytesUntil);
+    checkReaders(checkSkipBytesUntil);
+  }
+
+  void testSeek() {
+    const auto DATA = toBytes({0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xA0, 0x12, 0x34, 0x56, 0x78});
+    const auto checkSeek = [&DATA](BitReader &reader) {
+      TEST_ASSERT(reader.isSeekable());
+      TEST_ASSERT_EQUALS(0x0123U, reader.read(2_bytes));
+      TEST_THROWS_NOTHING(reader.seek(9_bytes));
+      TEST_ASSERT_EQUALS(9_bytes, reader.position());
+      TEST_ASSERT_EQUALS(0x12U, reader.read(1_bytes));
+      // backwards into the cache contents already read
+      TEST_THROWS_NOTHING(reader.seek(1_bytes));
+      TEST_ASSERT_EQUALS(0x23U, reader.read(1_bytes));
+      // forward within the cached contents
+      TEST_THROWS_NOTHING(reader.seek(20_bits));
+      TEST_ASSERT_EQUALS(20_bits, reader.position());
+      TEST_ASSERT_EQUALS(0x567U, reader.read(12_bits));
+      // not byte-aligned
+      TEST_THROWS_NOTHING(reader.seek(12_bits));
+      TEST_ASSERT_EQUALS(0x3U, reader.read(4_bits));
+      TEST_THROWS_NOTHING(reader.seek(ByteCount{DATA.size()}));
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+      TEST_THROWS_NOTHING(reader.seek(0_bits));
+      TEST_ASSERT_EQUALS(0x01234567U, reader.read(4_bytes));
+    };
+
+    {
+      BitReader reader{DATA};
+      checkSeek(reader);
+      TEST_THROWS(reader.seek(ByteCount{DATA.size() + 1U}), EndOfStreamError);
+    }
+
+    {
+      std::stringstream ss{std::string{reinterpret_cast<const char *>(DATA.data()), DATA.size()}};
+      BitReader reader{ss};
+      checkSeek(reader);
+    }
+
+    {
+      std::stringstream ss{std::string{reinterpret_cast<const char *>(DATA.data()), DATA.size()}};
+      BitReader reader{ss, 4_bytes};
+      checkSeek(reader);
+    }
+
+    {
+      std::size_t index = 0;
+      BitReader reader{[&](std::byte &out) {
+        if (index >= DATA.size()) {
+          return false;
+        }
+        out = DATA[index++];
+        return true;
+      }};
+      TEST_ASSERT_FALSE(reader.isSeekable());
+      TEST_ASSERT_EQUALS(0x0123U, reader.read(2_bytes));
+      // forward seeking skips the data
+      TEST_THROWS_NOTHING(reader.seek(9_bytes));
+      TEST_ASSERT_EQUALS(0x12U, reader.read(1_bytes));
+      TEST_THROWS(reader.seek(1_bytes), std::runtime_error);
+    }
+  }
+
+  void testSubReader() {
+    const auto DATA = toBytes({0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xA0, 0x12, 0x34, 0x56, 0x78});
+    const auto checkSubReader = [](BitReader &reader) {
+      TEST_ASSERT_EQUALS(0x0123U, reader.read(2_bytes));
+      auto sub = reader.subReader(ByteRange{4_bytes, 6_bytes});
+      TEST_ASSERT_EQUALS(0_bits, sub.position());
+      TEST_ASSERT_EQUALS(0x89ABU, sub.read(2_bytes));
+      // the readers are independent of each other
+      TEST_ASSERT_EQUALS(0x45U, reader.read(1_bytes));
+      TEST_ASSERT_EQUALS(0xCDEFU, sub.read(2_bytes));
+      TEST_ASSERT_EQUALS(0x67U, reader.read(1_bytes));
+      TEST_ASSERT(sub.isSeekable());
+      TEST_THROWS_NOTHING(sub.seek(1_bytes));
+      TEST_ASSERT_EQUALS(0xABCDU, sub.read(2_bytes));
+      auto nested = sub.subReader(ByteRange{3_bytes, 2_bytes});
+      TEST_ASSERT_EQUALS(0xEFA0U, nested.read(2_bytes));
+      TEST_ASSERT_FALSE(nested.hasMoreBytes());
+      TEST_THROWS(nested.read(1_bytes), EndOfStreamError);
+      TEST_ASSERT_EQUALS(0xEFA012U, sub.read(3_bytes));
+      TEST_ASSERT_FALSE(sub.hasMoreBytes());
+      TEST_THROWS(sub.read(1_bytes), EndOfStreamError);
+      TEST_ASSERT_EQUALS(4_bytes, reader.position());
+      TEST_ASSERT_EQUALS(0x89ABCDEFU, reader.read(4_bytes));
+      TEST_THROWS(sub.subReader(ByteRange{4_bytes, 3_bytes}), EndOfStreamError);
+    };
+
+    {
+      BitReader reader{DATA};
+      checkSubReader(reader);
+      TEST_THROWS(reader.subReader(ByteRange{10_bytes, 4_bytes}), EndOfStreamError);
+    }
+
+    {
+      std::stringstream ss{std::string{reinterpret_cast<const char *>(DATA.data()), DATA.size()}};
+      BitReader reader{ss};
+      checkSubReader(reader);
+      TEST_ASSERT_EQUALS(0xA0123456U, reader.read(4_bytes));
+    }
+
+    {
+      std::stringstream ss{std::string{reinterpret_cast<const char *>(DATA.data()), DATA.size()}};
+      BitReader reader{ss, 4_bytes};
+      checkSubReader(reader);
+      TEST_ASSERT_EQUALS(0xA0123456U, reader.read(4_bytes));
+    }
+
+    {
+      BitReader reader{[](std::byte &) { return false; }};
+      TEST_THROWS(reader.subReader(ByteRange{0_bytes, 1_bytes}), std::runtime_error);
+      BitReader empty{};
+      TEST_THROWS(empty.subReader(ByteRange{0_bytes, 1_bytes}), std::runtime_error);
+    }
+  }
+
+  void testReaderStatistics() {
+    std::vector<std::byte> data(16);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      data[i] = static_cast<std::byte>(i);
+    }
+
+    {
+      BitReader reader{std::span{data}};
+      TEST_ASSERT_EQUALS(nullptr, reader.statistics());
+      ReaderStatistics stats{};
+      reader.setStatistics(&stats);
+      TEST_ASSERT_EQUALS(&stats, reader.statistics());
+      TEST_ASSERT_EQUALS(0x0001U, reader.read(2_bytes));
+      // The whole cache is filled from in-memory ranges
+      TEST_ASSERT_EQUALS(8_bytes, stats.bytesRead);
+      TEST_THROWS_NOTHING(reader.skip(10_bytes));
+      // The remaining 6 bytes of the cache are consumed, the rest is skipped in the source
+      TEST_ASSERT_EQUALS(4_bytes, stats.bytesSkipped);
+      TEST_ASSERT_EQUALS(0x0CU, reader.read(1_bytes));
+      TEST_THROWS_NOTHING(reader.seek(0_bits));
+      TEST_ASSERT_EQUALS(1U, stats.numSeeks);
+      TEST_ASSERT_EQUALS(0U, stats.numSourceReads);
+      TEST_ASSERT_EQUALS(0_bytes, stats.sourceBytesRead);
+
+      // Not inherited by sub-readers
+      auto sub = reader.subReader(ByteRange{0_bytes, 4_bytes});
+      TEST_ASSERT_EQUALS(nullptr, sub.statistics());
+
+      reader.setStatistics(nullptr);
+      TEST_ASSERT_EQUALS(0x00U, reader.read(1_bytes));
+      TEST_ASSERT_EQUALS(12_bytes, stats.bytesRead);
+    }
+
+    {
+      BitReader reader{[remaining{std::span{data}}](std::span<std::byte> out) mutable {
+                         auto numBytes = std::min(out.size(), remaining.size());
+                         std::copy_n(remaining.begin(), numBytes, out.begin());
+                         remaining = remaining.subspan(numBytes);
+                         return numBytes;
+                       },
+                       4_bytes};
+      ReaderStatistics stats{};
+      reader.setStatistics(&stats);
+      std::vector<std::byte> bytes(data.size());
+      // Large reads bypass the read-ahead buffer
+      TEST_THROWS_NOTHING(reader.readBytesInto(bytes));
+      TEST_ASSERT_EQUALS(1U, stats.numSourceReads);
+      TEST_ASSERT_EQUALS(16_bytes, stats.sourceBytesRead);
+      TEST_ASSERT_EQUALS(16_bytes, stats.bytesRead);
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+      TEST_ASSERT_EQUALS(2U, stats.numSourceReads);
+      TEST_ASSERT_EQUALS(16_bytes, stats.sourceBytesRead);
+    }
+
+    {
+      std::stringstream ss{std::string{reinterpret_cast<const char *>(data.data()), data.size()}};
+      BitReader reader{ss, 4_bytes};
+      ReaderStatistics stats{};
+      reader.setStatistics(&stats);
+      TEST_ASSERT_EQUALS(0x00U, reader.readBytes(1_bytes));
+      TEST_ASSERT_EQUALS(1U, stats.numSourceReads);
+      TEST_ASSERT_EQUALS(4_bytes, stats.sourceBytesRead);
+      TEST_THROWS_NOTHING(reader.skip(ByteCount{data.size() - 2U}));
+      TEST_ASSERT_EQUALS(0x0FU, reader.readBytes(1_bytes));
+      // Skipping directly in the stream does not read the skipped bytes
+      TEST_ASSERT(stats.sourceBytesRead < 16_bytes);
+      TEST_ASSERT(stats.bytesSkipped > 0_bytes);
+      TEST_ASSERT_EQUALS(16_bytes, stats.bytesRead + stats.bytesSkipped);
+    }
+
+    {
+      BitReader empty{};
+      TEST_ASSERT_EQUALS(nullptr, empty.statistics());
+      ReaderStatistics stats{};
+      TEST_THROWS(empty.setStatistics(&stats), std::runtime_error);
+    }
+  }
+
+  void testBaseReader() {
+    using Access = bml::detail::BaseReaderAccess;
+    const auto DATA = toBytes({0x01, 0x23, 0x45, 0x67});
+    BitReader base{DATA};
+    TEST_ASSERT_EQUALS(&base, &Access::baseReader(base));
+
+    BitReader decorator{[&base](std::byte &out) {
+      out = base.readByte();
+      return true;
+    }};
+    TEST_ASSERT_EQUALS(&decorator, &Access::baseReader(decorator));
+    Access::setBaseReader(decorator, base);
+    TEST_ASSERT_EQUALS(&base, &Access::baseReader(decorator));
+
+    // Nested decorating readers directly refer to the base reader
+    BitReader nested{[&decorator](std::byte &out) {
+      out = decorator.readByte();
+      return true;
+    }};
+    Access::setBaseReader(nested, decorator);
+    TEST_ASSERT_EQUALS(&base, &Access::baseReader(nested));
+    TEST_ASSERT_EQUALS(0x01U, nested.read(1_bytes));
+    TEST_ASSERT_EQUALS(1_bytes, Access::baseReader(nested).position());
+
+    BitReader empty{};
+    TEST_ASSERT_EQUALS(&empty, &Access::baseReader(empty));
+    TEST_THROWS(Access::setBaseReader(empty, base), std::runtime_error);
+  }
+
   void testWriterEos() {
     std::vector<std::byte> buffer{};
     BitWriter writer1{std::span{buffer}};
@@ -269,6 +941,265 @@ public:
       TEST_THROWS(writer->flush(), EndOfStreamError);
     }
   }
+  void testWriterBulk() {
+    const auto expectedData = toBytes({0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xA0, 0x12, 0x34, 0x56, 0x78,
+                                       0x9A, 0xBC, 0xDE, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF});
+    const auto writeData = [](BitWriter &writer) {
+      writer.write(0x0123456789ABCDEFU, 8_bytes);
+      writer.write(0x5, 3_bits);
+      writer.write(0x0, 1_bits);
+      writer.write(0x0123456789ABCDEFU, 8_bytes);
+      writer.write(0x0, 4_bits);
+      writer.fillBytes(std::byte{0xFF}, 8_bytes);
+      writer.flush();
+    };
+
+    {
+      std::vector<std::byte> data(expectedData.size() + 1U, std::byte{0x42});
+      BitWriter writer{std::span{data}};
+      TEST_THROWS_NOTHING(writeData(writer));
+      TEST_ASSERT_EQUALS(ByteCount{expectedData.size()}, writer.position());
+      TEST_ASSERT_EQUALS(expectedData, std::span{data}.first(expectedData.size()));
+      // The byte after the written data is untouched
+      TEST_ASSERT_EQUALS(std::byte{0x42}, data.back());
+    }
+
+    {
+      std::vector<std::byte> data{};
+      BitWriter writer{data, BitWriter::GROW};
+      TEST_THROWS_NOTHING(writeData(writer));
+      TEST_ASSERT_EQUALS(ByteCount{expectedData.size()}, writer.position());
+      TEST_ASSERT_EQUALS(expectedData, data);
+    }
+
+    {
+      BitWriter writer{BitWriter::DISCARD};
+      TEST_THROWS_NOTHING(writeData(writer));
+      TEST_ASSERT_EQUALS(ByteCount{expectedData.size()}, writer.position());
+    }
+
+    {
+      std::stringstream output{};
+      BitWriter writer{output};
+      TEST_THROWS_NOTHING(writeData(writer));
+      TEST_THROWS_NOTHING(writer.fillBytes(std::byte{0x17}, 1000_bytes));
+      TEST_ASSERT_EQUALS(ByteCount{expectedData.size() + 1000U}, writer.position());
+      auto data = output.str();
+      TEST_ASSERT_EQUALS(expectedData.size() + 1000U, data.size());
+      TEST_ASSERT(std::equal(expectedData.begin(), expectedData.end(),
+                             reinterpret_cast<const std::byte *>(data.data())));
+      TEST_ASSERT(std::all_of(data.begin() + static_cast<std::ptrdiff_t>(expectedData.size()), data.end(),
+                              [](char c) { return c == 0x17; }));
+    }
+  }
+
+  void testWriteBufferPool() {
+    WriteBufferPool pool{2, 64_bytes};
+    TEST_ASSERT_EQUALS(0U, pool.numIdle());
+
+    const std::byte *firstData = nullptr;
+    {
+      auto buffer = pool.acquire(32_bytes);
+      TEST_ASSERT(buffer->empty());
+      TEST_ASSERT(buffer->capacity() >= 32U);
+      BitWriter writer{*buffer, BitWriter::GROW};
+      writer.write(0x0123456789ABCDEFU, 8_bytes);
+      writer.write(0x5, 3_bits);
+      writer.flush();
+      TEST_ASSERT_EQUALS(toBytes({0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xA0}), buffer.bytes());
+      firstData = buffer->data();
+    }
+    TEST_ASSERT_EQUALS(1U, pool.numIdle());
+
+    {
+      // Reuses the memory of the released buffer, but starts empty
+      auto buffer = pool.acquire(3_bits);
+      TEST_ASSERT_EQUALS(0U, pool.numIdle());
+      TEST_ASSERT(buffer->empty());
+      TEST_ASSERT_EQUALS(firstData, buffer->data());
+
+      // Moved-from buffers are not returned to the pool
+      auto other = std::move(buffer);
+      TEST_ASSERT_EQUALS(firstData, other->data());
+    }
+    TEST_ASSERT_EQUALS(1U, pool.numIdle());
+
+    pool.clear();
+    const std::byte *largeData = nullptr;
+    {
+      // Prefers a buffer large enough for the requested capacity over the most recently released one
+      auto large = pool.acquire(48_bytes);
+      auto small = pool.acquire(8_bytes);
+      largeData = large->data();
+      large = pool.acquire();
+      TEST_ASSERT_EQUALS(1U, pool.numIdle());
+    }
+    TEST_ASSERT_EQUALS(2U, pool.numIdle());
+    {
+      auto buffer = pool.acquire(40_bytes);
+      TEST_ASSERT_EQUALS(largeData, buffer->data());
+    }
+
+    {
+      // Does not keep more than the maximum number of buffers
+      auto first = pool.acquire(8_bytes);
+      auto second = pool.acquire(8_bytes);
+      auto third = pool.acquire(8_bytes);
+      TEST_ASSERT_EQUALS(0U, pool.numIdle());
+    }
+    TEST_ASSERT_EQUALS(2U, pool.numIdle());
+
+    pool.clear();
+    TEST_ASSERT_EQUALS(0U, pool.numIdle());
+    {
+      // Does not keep too large or empty buffers
+      auto large = pool.acquire(65_bytes);
+      auto empty = pool.acquire();
+      TEST_ASSERT_EQUALS(0U, empty->capacity());
+    }
+    TEST_ASSERT_EQUALS(0U, pool.numIdle());
+
+    TEST_ASSERT_EQUALS(&WriteBufferPool::threadLocal(), &WriteBufferPool::threadLocal());
+  }
+
+  void testCopyBytes() {
+    std::vector<std::byte> input(50000);
+    for (std::size_t i = 0; i < input.size(); ++i) {
+      input[i] = static_cast<std::byte>(i * 7U);
+    }
+    const auto checkCopy = [this, &input](BitReader &reader) {
+      std::vector<std::byte> output{};
+      BitWriter writer{output, BitWriter::GROW};
+      // Fill the read cache, which is copied first
+      TEST_ASSERT_EQUALS(static_cast<uintmax_t>(input[0]), reader.peek(1_bytes));
+      TEST_THROWS_NOTHING(reader.copyBytesTo(writer, ByteCount{input.size() - 1U}));
+      TEST_ASSERT_EQUALS(ByteCount{input.size() - 1U}, reader.position());
+      TEST_ASSERT_EQUALS(static_cast<uintmax_t>(input.back()), reader.readBytes(1_bytes));
+      TEST_THROWS(reader.copyBytesTo(writer, 1_bytes), EndOfStreamError);
+      writer.flush();
+      TEST_ASSERT(std::equal(output.begin(), output.end(), input.begin()));
+    };
+
+    {
+      BitReader reader{std::span{input}};
+      checkCopy(reader);
+    }
+    {
+      std::stringstream stream{};
+      stream.write(reinterpret_cast<const char *>(input.data()), static_cast<std::streamsize>(input.size()));
+      BitReader reader{stream, 1000_bytes};
+      checkCopy(reader);
+    }
+    {
+      std::size_t index = 0;
+      BitReader reader{[&input, &index](std::byte &out) {
+        if (index >= input.size()) {
+          return false;
+        }
+        out = input[index++];
+        return true;
+      }};
+      checkCopy(reader);
+    }
+
+    {
+      // Not aligned
+      BitReader reader{std::span{input}};
+      std::vector<std::byte> output{};
+      BitWriter writer{output, BitWriter::GROW};
+      reader.read(3_bits);
+      writer.write(0x5, 3_bits);
+      TEST_THROWS_NOTHING(copyBits(reader, writer, 1000_bytes));
+      TEST_ASSERT_EQUALS(BitCount{1000_bytes} + 3_bits, reader.position());
+      TEST_THROWS(reader.copyBytesTo(writer, 1_bytes), std::invalid_argument);
+      writer.write(0x0, 5_bits);
+      writer.flush();
+      TEST_ASSERT_EQUALS(1001U, output.size());
+      TEST_ASSERT(std::equal(output.begin() + 1, output.end() - 1, input.begin() + 1));
+    }
+  }
+
+  void testBatchCodes() {
+    // includes values with encodings larger than the remaining cache
+    const std::vector<std::uintmax_t> unsignedValues{0, 1, 2, 17, 0x7FFFFFFFU, 3, 0, 1000, 0x1234567U, 0, 0, 42, 1};
+    const std::vector<std::intmax_t> signedValues{0, -1, 1, -17, 0x3FFFFFFF, -3, 0, 1000, -0x1234567, 0, 0, 42, -1};
+    const std::vector<uint32_t> fibonacciValues{1, 2, 3, 17, 0x7FFFFFFFU, 3, 1, 1000, 0x1234567U, 1, 1, 42, 4};
+    const std::vector<int32_t> negaFibonacciValues{1, -1, 2, -17, 0x3FFFFFF, -3, 1, 1000, -0x123456, 1, -2, 42, 4};
+
+    std::vector<std::byte> expectedData{};
+    {
+      BitWriter writer{expectedData, BitWriter::GROW};
+      for (auto value : unsignedValues) {
+        writer.writeExpGolomb(value);
+      }
+      for (auto value : signedValues) {
+        writer.writeSignedExpGolomb(value);
+      }
+      for (auto value : fibonacciValues) {
+        writer.writeFibonacci(value);
+      }
+      for (auto value : negaFibonacciValues) {
+        writer.writeSignedFibonacci(value);
+      }
+      writer.flush();
+    }
+
+    {
+      std::vector<std::byte> data{};
+      BitWriter writer{data, BitWriter::GROW};
+      TEST_THROWS_NOTHING(writer.writeExpGolomb(std::span{unsignedValues}));
+      TEST_THROWS_NOTHING(writer.writeSignedExpGolomb(std::span{signedValues}));
+      TEST_THROWS_NOTHING(writer.writeFibonacci(std::span{fibonacciValues}));
+      TEST_THROWS_NOTHING(writer.writeSignedFibonacci(std::span{negaFibonacciValues}));
+      writer.flush();
+      TEST_ASSERT_EQUALS(expectedData, data);
+    }
+
+    {
+      BitReader reader{std::span{expectedData}};
+      std::vector<std::uintmax_t> unsignedResult(unsignedValues.size());
+      TEST_THROWS_NOTHING(reader.readExpGolombInto(unsignedResult));
+      TEST_ASSERT_EQUALS(unsignedValues, unsignedResult);
+      std::vector<std::intmax_t> signedResult(signedValues.size());
+      TEST_THROWS_NOTHING(reader.readSignedExpGolombInto(signedResult));
+      TEST_ASSERT_EQUALS(signedValues, signedResult);
+      std::vector<uint32_t> fibonacciResult(fibonacciValues.size());
+      TEST_THROWS_NOTHING(reader.readFibonacciInto(fibonacciResult));
+      TEST_ASSERT_EQUALS(fibonacciValues, fibonacciResult);
+      std::vector<int32_t> negaFibonacciResult(negaFibonacciValues.size());
+      TEST_THROWS_NOTHING(reader.readSignedFibonacciInto(negaFibonacciResult));
+      TEST_ASSERT_EQUALS(negaFibonacciValues, negaFibonacciResult);
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+
+      std::uintmax_t tooMany{};
+      TEST_THROWS(reader.readExpGolombInto(std::span{&tooMany, 1}), EndOfStreamError);
+    }
+
+    {
+      // byte-wise source without word refill
+      std::size_t index = 0;
+      BitReader reader{[&](std::byte &out) {
+        if (index >= expectedData.size()) {
+          return false;
+        }
+        out = expectedData[index++];
+        return true;
+      }};
+      std::vector<std::uintmax_t> unsignedResult(unsignedValues.size());
+      TEST_THROWS_NOTHING(reader.readExpGolombInto(unsignedResult));
+      TEST_ASSERT_EQUALS(unsignedValues, unsignedResult);
+      std::vector<std::intmax_t> signedResult(signedValues.size());
+      TEST_THROWS_NOTHING(reader.readSignedExpGolombInto(signedResult));
+      TEST_ASSERT_EQUALS(signedValues, signedResult);
+      std::vector<uint32_t> fibonacciResult(fibonacciValues.size());
+      TEST_THROWS_NOTHING(reader.readFibonacciInto(fibonacciResult));
+      TEST_ASSERT_EQUALS(fibonacciValues, fibonacciResult);
+      std::vector<int32_t> negaFibonacciResult(negaFibonacciValues.size());
+      TEST_THROWS_NOTHING(reader.readSignedFibonacciInto(negaFibonacciResult));
+      TEST_ASSERT_EQUALS(negaFibonacciValues, negaFibonacciResult);
+    }
+  }
+
 
   void testBool() {
     const auto DATA = toBytes({0xD0});
@@ -471,6 +1402,70 @@ public:
     checkSize(std::vector<uint32_t>{INPUT.begin(), INPUT.end()}, 4 * 4_bytes, false);
   }
 
+  void testBulkIntegral() {
+    // Large enough to be written in multiple chunks
+    std::vector<int16_t> values(5000);
+    std::vector<std::byte> expected(values.size() * sizeof(int16_t));
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      values[i] = static_cast<int16_t>(i * 7919U);
+      expected[2 * i] = static_cast<std::byte>(values[i] >> 8);
+      expected[2 * i + 1] = static_cast<std::byte>(values[i] & 0xFF);
+    }
+
+    {
+      std::vector<std::byte> output{};
+      BitWriter writer{output, BitWriter::GROW};
+      TEST_THROWS_NOTHING(bml::write(writer, values));
+      writer.flush();
+      TEST_ASSERT_EQUALS(expected, output);
+
+      BitReader reader{std::span{output}};
+      std::vector<int16_t> result(values.size());
+      TEST_THROWS_NOTHING(reader.readBigEndianInto(std::span{result}));
+      TEST_ASSERT_EQUALS(values, result);
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+    }
+
+    {
+      // Unaligned values are read/written element-wise
+      std::vector<std::byte> output{};
+      BitWriter writer{output, BitWriter::GROW};
+      writer.write(true);
+      TEST_THROWS(writer.writeBigEndian(std::span<const int16_t>{values}), std::invalid_argument);
+      TEST_THROWS_NOTHING(bml::write(writer, values));
+      writer.fillToAligment(1_bytes, false);
+      writer.flush();
+      TEST_ASSERT_EQUALS(expected.size() + 1U, output.size());
+
+      BitReader reader{std::span{output}};
+      TEST_ASSERT(reader.read());
+      std::array<int16_t, 3> result{};
+      TEST_THROWS_NOTHING(bml::read(reader, result));
+      TEST_ASSERT(std::equal(result.begin(), result.end(), values.begin()));
+    }
+
+    {
+      const std::array<EnumType, 3> enums{EnumType::BAZ, EnumType::FOO, EnumType::BAR};
+      const std::array<uint64_t, 2> words{0x0102030405060708, 0xF0E0D0C0B0A09080};
+      std::vector<std::byte> output{};
+      BitWriter writer{output, BitWriter::GROW};
+      TEST_THROWS_NOTHING(bml::write(writer, enums));
+      TEST_THROWS_NOTHING(bml::write(writer, words));
+      writer.flush();
+      TEST_ASSERT_EQUALS(toBytes({0x20, 0x01, 0x11, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0xF0, 0xE0, 0xD0,
+                                  0xC0, 0xB0, 0xA0, 0x90, 0x80}),
+                         output);
+
+      BitReader reader{std::span{output}};
+      std::array<EnumType, 3> enumsResult{};
+      std::array<uint64_t, 2> wordsResult{};
+      TEST_THROWS_NOTHING(bml::read(reader, enumsResult));
+      TEST_THROWS_NOTHING(bml::read(reader, wordsResult));
+      TEST_ASSERT(enums == enumsResult);
+      TEST_ASSERT(words == wordsResult);
+    }
+  }
+
   void testEnum() {
     const std::array<EnumType, 5> DATA_BUFFER{EnumType::BAR, EnumType::FOO, EnumType::BAZ, EnumType::FOO,
                                               EnumType::BAR};
@@ -901,6 +1896,45 @@ public:
     TEST_ASSERT_EQUALS(0x14041011U, readOptional<uint32_t>(reader, true));
     TEST_ASSERT_EQUALS(4_bytes, reader.position());
   }
+
+  void testMappedFile() {
+    const auto path = std::filesystem::temp_directory_path() / "bml_test_mapped_file.bin";
+    const std::array<std::byte, 5> DATA{std::byte{0x14}, std::byte{0x04}, std::byte{0x10}, std::byte{0x11},
+                                        std::byte{0xFF}};
+    {
+      std::ofstream out{path, std::ios::binary | std::ios::trunc};
+      out.write(reinterpret_cast<const char *>(DATA.data()), DATA.size());
+    }
+
+    {
+      MappedFile mapped{path};
+      TEST_ASSERT_EQUALS(DATA.size(), mapped.size());
+      TEST_ASSERT_FALSE(mapped.empty());
+      TEST_ASSERT_EQUALS((ByteRange{0_bytes, 5_bytes}), mapped.byteRange());
+      TEST_ASSERT(std::ranges::equal(DATA, mapped.data()));
+
+      MappedFile moved{std::move(mapped)};
+      TEST_ASSERT(mapped.empty());
+      TEST_ASSERT_EQUALS(DATA.size(), moved.size());
+
+      BitReader reader{moved.data()};
+      TEST_ASSERT_EQUALS(0x14041011U, reader.readBytes<uint32_t>(4_bytes));
+      TEST_ASSERT_EQUALS(std::byte{0xFF}, reader.readByte());
+      TEST_ASSERT_FALSE(reader.hasMoreBytes());
+    }
+
+    {
+      std::ofstream out{path, std::ios::binary | std::ios::trunc};
+    }
+    {
+      MappedFile mapped{path};
+      TEST_ASSERT(mapped.empty());
+      TEST_ASSERT_EQUALS(0U, mapped.size());
+    }
+
+    std::filesystem::remove(path);
+    TEST_THROWS(MappedFile{path}, std::system_error);
+  }
 };
 
 class TestTypes : public TestBase {